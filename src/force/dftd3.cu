@@ -28,6 +28,7 @@ J. Comput. Chem., 32, 1456 (2011).
 ------------------------------------------------------------------------------*/
 
 #include "dftd3.cuh"
+#include "dftd3_c6.cuh"
 #include "dftd3para.cuh"
 #include "model/box.cuh"
 #include "neighbor.cuh"
@@ -59,7 +60,10 @@ void __global__ find_dftd3_coordination_number_small_box(
   const float* g_x12,
   const float* g_y12,
   const float* g_z12,
-  float* g_cn)
+  float* g_cn,
+  float* g_cn_weight,
+  float* g_cn_weight_derivative,
+  float* g_cn_log_weight_sum)
 {
   int n1 = blockIdx.x * blockDim.x + threadIdx.x;
   if (n1 < N) {
@@ -76,6 +80,15 @@ void __global__ find_dftd3_coordination_number_small_box(
       cn_temp += 1.0f / (exp(-16.0f * ((R_cov_1 + R_cov_2) / d12 - 1.0f)) + 1.0f);
     }
     g_cn[n1] = cn_temp;
+    find_cn_weights(
+      z1,
+      dftd3_para.num_cn[g_type[n1]],
+      cn_temp,
+      N,
+      n1,
+      g_cn_weight,
+      g_cn_weight_derivative,
+      g_cn_log_weight_sum);
   }
 }
 
@@ -101,7 +114,9 @@ void __global__ add_dftd3_force_small_box(
   const int* g_NL_radial,
   const int* g_type,
   const float* g_c6_ref,
-  const float* g_cn,
+  const float* g_cn_weight,
+  const float* g_cn_weight_derivative,
+  const float* g_cn_log_weight_sum,
   const float* g_x12,
   const float* g_y12,
   const float* g_z12,
@@ -115,61 +130,44 @@ void __global__ add_dftd3_force_small_box(
 {
   int n1 = blockIdx.x * blockDim.x + threadIdx.x;
   if (n1 < N) {
-    int z1 = dftd3_para.atomic_number[g_type[n1]];
-    int num_cn_1 = num_cn[z1];
+    int type_1 = g_type[n1];
+    int z1 = dftd3_para.atomic_number[type_1];
+    int num_cn_1 = dftd3_para.num_cn[type_1];
+    float weight_1[max_cn];
+    float weight_derivative_1[max_cn];
+    for (int i = 0; i < num_cn_1; ++i) {
+      weight_1[i] = g_cn_weight[i * N + n1];
+      weight_derivative_1[i] = g_cn_weight_derivative[i * N + n1];
+    }
+    float log_weight_sum_1 = g_cn_log_weight_sum[n1];
     float dc6_sum = 0.0f;
     float dc8_sum = 0.0f;
     float s_potential = 0.0f;
     for (int i1 = 0; i1 < g_NN_radial[n1]; ++i1) {
       int index = i1 * N + n1;
       int n2 = g_NL_radial[index];
-      int z2 = dftd3_para.atomic_number[g_type[n2]];
-      int z_small = z1, z_large = z2;
-      if (z1 > z2) {
-        z_small = z2;
-        z_large = z1;
-      }
-      int z12 = z_small * max_elem - (z_small * (z_small - 1)) / 2 + (z_large - z_small);
+      int type_2 = g_type[n2];
+      int z2 = dftd3_para.atomic_number[type_2];
       float r12[3] = {g_x12[index], g_y12[index], g_z12[index]};
       float d12_2 = r12[0] * r12[0] + r12[1] * r12[1] + r12[2] * r12[2];
       float d12_4 = d12_2 * d12_2;
       float d12_6 = d12_4 * d12_2;
       float d12_8 = d12_6 * d12_2;
-      float c6 = 0.0f;
-      float dc6 = 0.0f;
-      int num_cn_2 = num_cn[z2];
-      if (num_cn_1 == 1 && num_cn_2 == 1) {
-        c6 = g_c6_ref[z12 * max_cn2];
-      } else {
-        float W = 0.0f;
-        float dW = 0.0f;
-        float Z = 0.0f;
-        float dZ = 0.0f;
-        for (int i = 0; i < num_cn_1; ++i) {
-          for (int j = 0; j < num_cn_2; ++j) {
-            float diff_i = g_cn[n1] - cn_ref[z1 * max_cn + i];
-            float diff_j = g_cn[n2] - cn_ref[z2 * max_cn + j];
-            float L_ij = exp(-4.0f * (diff_i * diff_i + diff_j * diff_j));
-            W += L_ij;
-            dW += L_ij * (-8.0f * diff_i);
-            float c6_ref_ij = (z1 < z2) ? g_c6_ref[z12 * max_cn2 + i * max_cn + j]
-                                        : g_c6_ref[z12 * max_cn2 + j * max_cn + i];
-            Z += c6_ref_ij * L_ij;
-            dZ += c6_ref_ij * L_ij * (-8.0f * diff_i);
-          }
-        }
-
-        if (W < 1.0e-30f) {
-          int i = num_cn_1 - 1;
-          int j = num_cn_2 - 1;
-          c6 = (z1 < z2) ? g_c6_ref[z12 * max_cn2 + i * max_cn + j]
-                         : g_c6_ref[z12 * max_cn2 + j * max_cn + i];
-        } else {
-          W = 1.0f / W;
-          c6 = Z * W;
-          dc6 = dZ * W - c6 * dW * W;
-        }
-      }
+      float c6;
+      float dc6;
+      find_c6(
+        num_cn_1,
+        dftd3_para.num_cn[type_2],
+        g_c6_ref + (type_1 * dftd3_para.num_types + type_2) * max_cn2,
+        weight_1,
+        weight_derivative_1,
+        log_weight_sum_1,
+        N,
+        n2,
+        g_cn_weight,
+        g_cn_log_weight_sum,
+        c6,
+        dc6);
       c6 *= HartreeBohr6;
       dc6 *= HartreeBohr6;
 
@@ -464,7 +462,7 @@ std::string get_potential_file_name()
   return potential_file_name;
 }
 
-void find_atomic_number(std::string& potential_file_name, int* atomic_number)
+int find_atomic_number(std::string& potential_file_name, int* atomic_number)
 {
   std::ifstream input_potential(potential_file_name);
   if (!input_potential.is_open()) {
@@ -499,6 +497,7 @@ void find_atomic_number(std::string& potential_file_name, int* atomic_number)
   }
 
   input_potential.close();
+  return num_types;
 }
 
 __device__ int find_neighbor_cell(
@@ -545,7 +544,10 @@ __global__ void find_dftd3_coordination_number_large_box(
   const double* g_x,
   const double* g_y,
   const double* g_z,
-  float* g_cn)
+  float* g_cn,
+  float* g_cn_weight,
+  float* g_cn_weight_derivative,
+  float* g_cn_log_weight_sum)
 {
   int n1 = blockIdx.x * blockDim.x + threadIdx.x;
   if (n1 >= N) {
@@ -596,6 +598,15 @@ __global__ void find_dftd3_coordination_number_large_box(
     }
   }
   g_cn[n1] = cn_temp;
+  find_cn_weights(
+    atomic_number_1,
+    dftd3_para.num_cn[g_type[n1]],
+    cn_temp,
+    N,
+    n1,
+    g_cn_weight,
+    g_cn_weight_derivative,
+    g_cn_log_weight_sum);
 }
 
 __global__ void find_dftd3_force_large_box(
@@ -611,7 +622,9 @@ __global__ void find_dftd3_force_large_box(
   const int* g_cell_count_sum,
   const int* g_cell_contents,
   const float* g_c6_ref,
-  const float* g_cn,
+  const float* g_cn_weight,
+  const float* g_cn_weight_derivative,
+  const float* g_cn_log_weight_sum,
   const double* g_x,
   const double* g_y,
   const double* g_z,
@@ -627,8 +640,16 @@ __global__ void find_dftd3_force_large_box(
   if (n1 >= N) {
     return;
   }
-  int atomic_number_1 = dftd3_para.atomic_number[g_type[n1]];
-  int num_cn_1 = num_cn[atomic_number_1];
+  int type_1 = g_type[n1];
+  int atomic_number_1 = dftd3_para.atomic_number[type_1];
+  int num_cn_1 = dftd3_para.num_cn[type_1];
+  float weight_1[max_cn];
+  float weight_derivative_1[max_cn];
+  for (int i = 0; i < num_cn_1; ++i) {
+    weight_1[i] = g_cn_weight[i * N + n1];
+    weight_derivative_1[i] = g_cn_weight_derivative[i * N + n1];
+  }
+  float log_weight_sum_1 = g_cn_log_weight_sum[n1];
   float dc6_sum = 0.0f;
   float dc8_sum = 0.0f;
   float s_pe = 0.0f;
@@ -676,51 +697,26 @@ __global__ void find_dftd3_force_large_box(
           float r12[3] = {float(x12double), float(y12double), float(z12double)};
           float d12_2 = r12[0] * r12[0] + r12[1] * r12[1] + r12[2] * r12[2];
           if (d12_2 < rc * rc) {
-            int atomic_number_2 = dftd3_para.atomic_number[g_type[n2]];
-            int z_small = atomic_number_1, z_large = atomic_number_2;
-            if (atomic_number_1 > atomic_number_2) {
-              z_small = atomic_number_2;
-              z_large = atomic_number_1;
-            }
-            int z12 = z_small * max_elem - (z_small * (z_small - 1)) / 2 + (z_large - z_small);
+            int type_2 = g_type[n2];
+            int atomic_number_2 = dftd3_para.atomic_number[type_2];
             float d12_4 = d12_2 * d12_2;
             float d12_6 = d12_4 * d12_2;
             float d12_8 = d12_6 * d12_2;
-            float c6 = 0.0f;
-            float dc6 = 0.0f;
-            int num_cn_2 = num_cn[atomic_number_2];
-            if (num_cn_1 == 1 && num_cn_2 == 1) {
-              c6 = g_c6_ref[z12 * max_cn2];
-            } else {
-              float W = 0.0f;
-              float dW = 0.0f;
-              float Z = 0.0f;
-              float dZ = 0.0f;
-              for (int i = 0; i < num_cn_1; ++i) {
-                for (int j = 0; j < num_cn_2; ++j) {
-                  float diff_i = g_cn[n1] - cn_ref[atomic_number_1 * max_cn + i];
-                  float diff_j = g_cn[n2] - cn_ref[atomic_number_2 * max_cn + j];
-                  float L_ij = exp(-4.0f * (diff_i * diff_i + diff_j * diff_j));
-                  W += L_ij;
-                  dW += L_ij * (-8.0f * diff_i);
-                  float c6_ref_ij = (atomic_number_1 < atomic_number_2)
-                                      ? g_c6_ref[z12 * max_cn2 + i * max_cn + j]
-                                      : g_c6_ref[z12 * max_cn2 + j * max_cn + i];
-                  Z += c6_ref_ij * L_ij;
-                  dZ += c6_ref_ij * L_ij * (-8.0f * diff_i);
-                }
-              }
-              if (W < 1.0e-30f) {
-                int i = num_cn_1 - 1;
-                int j = num_cn_2 - 1;
-                c6 = (atomic_number_1 < atomic_number_2) ? g_c6_ref[z12 * max_cn2 + i * max_cn + j]
-                                                         : g_c6_ref[z12 * max_cn2 + j * max_cn + i];
-              } else {
-                W = 1.0f / W;
-                c6 = Z * W;
-                dc6 = dZ * W - c6 * dW * W;
-              }
-            }
+            float c6;
+            float dc6;
+            find_c6(
+              num_cn_1,
+              dftd3_para.num_cn[type_2],
+              g_c6_ref + (type_1 * dftd3_para.num_types + type_2) * max_cn2,
+              weight_1,
+              weight_derivative_1,
+              log_weight_sum_1,
+              N,
+              n2,
+              g_cn_weight,
+              g_cn_log_weight_sum,
+              c6,
+              dc6);
             c6 *= HartreeBohr6;
             dc6 *= HartreeBohr6;
 
@@ -919,6 +915,9 @@ void DFTD3::compute_small_box(
   const int size_x12 = N * MN;
   if (NN_radial.size() == 0) {
     cn.resize(N);
+    cn_weight.resize(N * max_cn);
+    cn_weight_derivative.resize(N * max_cn);
+    cn_log_weight_sum.resize(N);
     dc6_sum.resize(N);
     dc8_sum.resize(N);
 
@@ -959,7 +958,10 @@ void DFTD3::compute_small_box(
     r12.data() + size_x12 * 3,
     r12.data() + size_x12 * 4,
     r12.data() + size_x12 * 5,
-    cn.data());
+    cn.data(),
+    cn_weight.data(),
+    cn_weight_derivative.data(),
+    cn_log_weight_sum.data());
   CUDA_CHECK_KERNEL
 
   add_dftd3_force_small_box<<<(N - 1) / 64 + 1, 64>>>(
@@ -969,7 +971,9 @@ void DFTD3::compute_small_box(
     NL_radial.data(),
     type.data(),
     c6_ref.data(),
-    cn.data(),
+    cn_weight.data(),
+    cn_weight_derivative.data(),
+    cn_log_weight_sum.data(),
     r12.data(),
     r12.data() + size_x12,
     r12.data() + size_x12 * 2,
@@ -1011,6 +1015,9 @@ void DFTD3::compute_large_box(
   const int N = type.size();
   if (cn.size() == 0) {
     cn.resize(N);
+    cn_weight.resize(N * max_cn);
+    cn_weight_derivative.resize(N * max_cn);
+    cn_log_weight_sum.resize(N);
     dc6_sum.resize(N);
     dc8_sum.resize(N);
     cell_count_radial.resize(N);
@@ -1058,7 +1065,10 @@ void DFTD3::compute_large_box(
     position_per_atom.data(),
     position_per_atom.data() + N,
     position_per_atom.data() + N * 2,
-    cn.data());
+    cn.data(),
+    cn_weight.data(),
+    cn_weight_derivative.data(),
+    cn_log_weight_sum.data());
   CUDA_CHECK_KERNEL
 
   find_dftd3_force_large_box<<<(N - 1) / 64 + 1, 64>>>(
@@ -1074,7 +1084,9 @@ void DFTD3::compute_large_box(
     cell_count_sum_radial.data(),
     cell_contents_radial.data(),
     c6_ref.data(),
-    cn.data(),
+    cn_weight.data(),
+    cn_weight_derivative.data(),
+    cn_log_weight_sum.data(),
     position_per_atom.data(),
     position_per_atom.data() + N,
     position_per_atom.data() + N * 2,
@@ -1210,9 +1222,21 @@ void DFTD3::initialize(
   std::cout << "            a1 = " << dftd3_para.a1 << std::endl;
   std::cout << "            a2 = " << dftd3_para.a2 << " Angstrom" << std::endl;
 
-  c6_ref.resize(111625);
-  c6_ref.copy_from_host(c6_ref_cpu);
-
   std::string potential_file_name = get_potential_file_name();
-  find_atomic_number(potential_file_name, dftd3_para.atomic_number);
+  const int num_types = find_atomic_number(potential_file_name, dftd3_para.atomic_number);
+  dftd3_para.num_types = num_types;
+
+  // only the C6 references of the pairs of types in the model are needed on the device
+  std::vector<float> c6_ref_cpu(num_types * num_types * max_cn2);
+  for (int t1 = 0; t1 < num_types; ++t1) {
+    dftd3_para.num_cn[t1] = get_dftd3_num_references(dftd3_para.atomic_number[t1]);
+    for (int t2 = 0; t2 < num_types; ++t2) {
+      get_dftd3_c6_references(
+        dftd3_para.atomic_number[t1],
+        dftd3_para.atomic_number[t2],
+        c6_ref_cpu.data() + (t1 * num_types + t2) * max_cn2);
+    }
+  }
+  c6_ref.resize(c6_ref_cpu.size());
+  c6_ref.copy_from_host(c6_ref_cpu.data());
 }
\ No newline at end of file
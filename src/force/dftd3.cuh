@@ -27,7 +27,9 @@ public:
     float s8 = 0.0;
     float a1 = 0.0;
     float a2 = 0.0;
+    int num_types = 0;
     int atomic_number[94];
+    int num_cn[94]; // number of reference coordination numbers of each type
   };
 
   DFTD3_Para dftd3_para;
@@ -36,7 +38,10 @@ public:
   float rc_radial = 15.0;
   float rc_angular = 10.0;
   GPU_Vector<float> cn;
-  GPU_Vector<float> c6_ref;
+  GPU_Vector<float> cn_weight;            // normalized weights of the references of each atom
+  GPU_Vector<float> cn_weight_derivative; // derivatives of cn_weight with respect to cn
+  GPU_Vector<float> cn_log_weight_sum;    // logarithm of the sum of the unnormalized weights
+  GPU_Vector<float> c6_ref;               // C6 of the references of each pair of types
   GPU_Vector<float> dc6_sum;
   GPU_Vector<float> dc8_sum;
 
@@ -0,0 +1,104 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+The C6 coefficients of DFT-D3 as functions of the coordination numbers, used by
+the kernels in dftd3.cu: the normalized Gaussian weights of the references of
+each atom (find_cn_weights) and the C6 of a pair from them (find_c6).
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include "dftd3para.cuh"
+#include <cmath>
+
+namespace
+{
+// ln(1e-30): for a smaller sum of the Gaussian weights of a pair, the last references are used
+const float LOG_MIN_WEIGHT_SUM = -69.0775528f;
+
+// The Gaussian weight of a pair of references factorizes as L_ij = L_i * L_j, such that the
+// normalized weights of the references of an atom and their derivatives with respect to its
+// coordination number are found once per atom, and the C6 of a pair needs no exponentials.
+inline __host__ __device__ void find_cn_weights(
+  const int z,
+  const int num_references,
+  const float cn,
+  const int N,
+  const int n,
+  float* g_weight,
+  float* g_weight_derivative,
+  float* g_log_weight_sum)
+{
+  float diff[max_cn];
+  float min_diff_square = 1.0e30f;
+  for (int i = 0; i < num_references; ++i) {
+    diff[i] = cn - cn_ref[z * max_cn + i];
+    min_diff_square = fminf(min_diff_square, diff[i] * diff[i]);
+  }
+  // scaled by exp(4 * min_diff_square) to avoid underflow
+  float weight[max_cn];
+  float weight_sum = 0.0f;
+  for (int i = 0; i < num_references; ++i) {
+    weight[i] = expf(-4.0f * (diff[i] * diff[i] - min_diff_square));
+    weight_sum += weight[i];
+  }
+  float mean_derivative = 0.0f;
+  for (int i = 0; i < num_references; ++i) {
+    weight[i] /= weight_sum;
+    mean_derivative += weight[i] * (-8.0f * diff[i]);
+  }
+  for (int i = 0; i < num_references; ++i) {
+    g_weight[i * N + n] = weight[i];
+    g_weight_derivative[i * N + n] = weight[i] * (-8.0f * diff[i] - mean_derivative);
+  }
+  g_log_weight_sum[n] = logf(weight_sum) - 4.0f * min_diff_square;
+}
+
+// C6 of a pair and its derivative with respect to the coordination number of atom 1
+inline __host__ __device__ void find_c6(
+  const int num_references_1,
+  const int num_references_2,
+  const float* c6_ref,
+  const float* weight_1,
+  const float* weight_derivative_1,
+  const float log_weight_sum_1,
+  const int N,
+  const int n2,
+  const float* g_weight,
+  const float* g_log_weight_sum,
+  float& c6,
+  float& dc6)
+{
+  c6 = 0.0f;
+  dc6 = 0.0f;
+  if (num_references_1 == 1 && num_references_2 == 1) {
+    c6 = c6_ref[0];
+  } else if (log_weight_sum_1 + g_log_weight_sum[n2] < LOG_MIN_WEIGHT_SUM) {
+    c6 = c6_ref[(num_references_1 - 1) * max_cn + num_references_2 - 1];
+  } else {
+    for (int j = 0; j < num_references_2; ++j) {
+      float c6_j = 0.0f;
+      float dc6_j = 0.0f;
+      for (int i = 0; i < num_references_1; ++i) {
+        c6_j += weight_1[i] * c6_ref[i * max_cn + j];
+        dc6_j += weight_derivative_1[i] * c6_ref[i * max_cn + j];
+      }
+      const float weight_2 = g_weight[j * N + n2];
+      c6 += c6_j * weight_2;
+      dc6 += dc6_j * weight_2;
+    }
+  }
+}
+} // namespace
@@ -0,0 +1,31 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Reference data of DFT-D3, which only live on the host: the C6 of the element
+pairs used in a simulation are copied to the device by DFTD3::initialize.
+------------------------------------------------------------------------------*/
+
+#pragma once
+
+const int DFTD3_NUM_ELEMENTS = 94;  // H to Pu
+const int DFTD3_MAX_REFERENCES = 5; // maximum number of reference coordination numbers
+
+// number of reference coordination numbers of the element with atomic number z + 1
+int get_dftd3_num_references(const int z);
+
+// c6[i * DFTD3_MAX_REFERENCES + j] is the C6 (in Hartree Bohr^6) of the reference i of z1 and the
+// reference j of z2, and zero for the references an element does not have
+void get_dftd3_c6_references(const int z1, const int z2, float* c6);
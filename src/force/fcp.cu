@@ -19,7 +19,9 @@ The force constant potential (FCP)
 
 #include "fcp.cuh"
 #include "utilities/error.cuh"
+#include <chrono>
 #include <cstring>
+#include <string>
 #include <vector>
 
 FCP::FCP(FILE* fid, const int num_types, const int N, const Box& box)
@@ -39,6 +41,9 @@ FCP::FCP(FILE* fid, const int num_types, const int N, const Box& box)
 
   printf("    up to order-%d.\n", order);
   printf("    and compute heat current up to order-%d.\n", heat_order);
+  if (order < 2 || order > FCP_MAX_ORDER) {
+    PRINT_INPUT_ERROR("force constant order should be 2 to 6.");
+  }
   if (heat_order != 2 && heat_order != 3) {
     PRINT_INPUT_ERROR("heat current order should be 2 or 3.");
   }
@@ -48,22 +53,35 @@ FCP::FCP(FILE* fid, const int num_types, const int N, const Box& box)
   PRINT_SCANF_ERROR(count, 1, "Reading error for force constant potential.");
   printf("    Use the force constant data in %s.\n", file_path);
 
+  // read in the equilibrium positions and force constants, from fcp.bin if it exists
+  const auto time_begin = std::chrono::high_resolution_clock::now();
+  FCP_Input input;
+  const std::string file_binary = std::string(file_path) + "/" + FCP_BINARY_FILE;
+  FILE* fid_binary = fopen(file_binary.c_str(), "rb");
+  if (fid_binary != nullptr) {
+    fclose(fid_binary);
+    printf("    Reading data from %s\n", file_binary.c_str());
+    input.read_binary(file_binary.c_str(), order);
+  } else {
+    input.read_text(file_path, order);
+  }
+  if (input.number_of_atoms() != N) {
+    PRINT_INPUT_ERROR("Number of atoms in r0.in (or fcp.bin) differs from that in the model.");
+  }
+
   // allocate memeory
   fcp_data.u.resize(N * 3);
-  fcp_data.r0.resize(N * 3, Memory_Type::managed);
+  fcp_data.r0.resize(N * 3);
   fcp_data.pfv.resize(N * 13);
 
-  // read in the equilibrium positions and force constants
-  read_r0(N);
-  read_fc2(N, box);
-  if (order >= 3)
-    read_fc3(N, box);
-  if (order >= 4)
-    read_fc4(N);
-  if (order >= 5)
-    read_fc5(N);
-  if (order >= 6)
-    read_fc6(N);
+  fcp_data.r0.copy_from_host(input.r0());
+  for (int p = 2; p <= order; ++p) {
+    set_clusters(input, p, box);
+  }
+
+  const auto time_finish = std::chrono::high_resolution_clock::now();
+  const std::chrono::duration<double> time_used = time_finish - time_begin;
+  printf("    Force constants loaded in %f s.\n", time_used.count());
 }
 
 FCP::~FCP(void)
@@ -71,653 +89,126 @@ FCP::~FCP(void)
   // nothing
 }
 
-void FCP::read_r0(const int N)
+// 1 / (n_1! n_2! ...) for the runs of n_1, n_2, ... identical atoms in a cluster of sorted atoms
+static float get_weight(const int* atoms, const int order)
 {
-  char file[200];
-  strcpy(file, file_path);
-  strcat(file, "/r0.in");
-  FILE* fid = my_fopen(file, "r");
-
-  for (int n = 0; n < N; n++) {
-    int count =
-      fscanf(fid, "%f%f%f", &fcp_data.r0[n], &fcp_data.r0[n + N], &fcp_data.r0[n + N + N]);
-    PRINT_SCANF_ERROR(count, 3, "Reading error for r0.in.");
+  int factor = 1;
+  int run_length = 1;
+  for (int p = 1; p < order; ++p) {
+    run_length = (atoms[p] == atoms[p - 1]) ? run_length + 1 : 1;
+    factor *= run_length;
   }
-  fclose(fid);
-  printf("    Data in r0.in have been read in.\n");
+  return 1.0f / factor;
 }
 
-void FCP::read_fc2(const int N, const Box& box)
+// Copy the data of one order to the device. The first atom of each cluster is expanded from the
+// compressed layout of FCP_Input, and the weights (order >= 4) or the half and third distances
+// for the heat current (order 2 and 3) are computed here.
+void FCP::set_clusters(const FCP_Input& input, const int p, const Box& box)
 {
-  // reading fcs_order2.in
-  char file_fc[200];
-  strcpy(file_fc, file_path);
-  strcat(file_fc, "/fcs_order2.in");
-  FILE* fid_fc = my_fopen(file_fc, "r");
-
-  printf("    Reading data from %s\n", file_fc);
-
-  int num_fcs = 0;
-  int count = fscanf(fid_fc, "%d", &num_fcs);
-  PRINT_SCANF_ERROR(count, 1, "Reading error for fcs_order2.in.");
-  if (num_fcs <= 0) {
-    PRINT_INPUT_ERROR("number of force constant matrix should > 0.");
+  GPU_Vector<int>* atoms[FCP_MAX_ORDER + 1][FCP_MAX_ORDER] = {
+    {},
+    {},
+    {&fcp_data.i2, &fcp_data.j2},
+    {&fcp_data.i3, &fcp_data.j3, &fcp_data.k3},
+    {&fcp_data.i4, &fcp_data.j4, &fcp_data.k4, &fcp_data.l4},
+    {&fcp_data.i5, &fcp_data.j5, &fcp_data.k5, &fcp_data.l5, &fcp_data.m5},
+    {&fcp_data.i6, &fcp_data.j6, &fcp_data.k6, &fcp_data.l6, &fcp_data.m6, &fcp_data.n6}};
+  GPU_Vector<int>* index[FCP_MAX_ORDER + 1] = {
+    nullptr,
+    nullptr,
+    &fcp_data.index2,
+    &fcp_data.index3,
+    &fcp_data.index4,
+    &fcp_data.index5,
+    &fcp_data.index6};
+  GPU_Vector<float>* phi[FCP_MAX_ORDER + 1] = {
+    nullptr,
+    nullptr,
+    &fcp_data.phi2,
+    &fcp_data.phi3,
+    &fcp_data.phi4,
+    &fcp_data.phi5,
+    &fcp_data.phi6};
+  int* number[FCP_MAX_ORDER + 1] = {
+    nullptr, nullptr, &number2, &number3, &number4, &number5, &number6};
+
+  const int N = input.number_of_atoms();
+  const FCP_Clusters& clusters = input.clusters(p);
+  const int num_clusters = clusters.num_clusters;
+  *number[p] = num_clusters;
+
+  int num_components = 1;
+  for (int a = 0; a < p; ++a) {
+    num_components *= 3;
   }
-
-  fcp_data.phi2.resize(num_fcs * 9, Memory_Type::managed);
-  for (int n = 0; n < num_fcs; ++n)
-    for (int a = 0; a < 3; ++a)
-      for (int b = 0; b < 3; ++b) {
-        int index = n * 9 + a * 3 + b;
-        int aa, bb; // not used
-        count = fscanf(fid_fc, "%d%d%f", &aa, &bb, &fcp_data.phi2[index]);
-        PRINT_SCANF_ERROR(count, 3, "Reading error for fcs_order2.in.");
-      }
-
-  // reading clusters_order2.in
-  char file_cluster[200];
-  strcpy(file_cluster, file_path);
-  strcat(file_cluster, "/clusters_order2.in");
-  FILE* fid_cluster = my_fopen(file_cluster, "r");
-
-  printf("    Reading data from %s\n", file_cluster);
-
-  count = fscanf(fid_cluster, "%d", &number2);
-  PRINT_SCANF_ERROR(count, 1, "Reading error for clusters_order2.in.");
-  if (number2 <= 0) {
-    PRINT_INPUT_ERROR("number of clusters should > 0.");
-  }
-
-  fcp_data.i2.resize(number2, Memory_Type::managed);
-  fcp_data.j2.resize(number2, Memory_Type::managed);
-  fcp_data.index2.resize(number2, Memory_Type::managed);
-  fcp_data.xij2.resize(number2, Memory_Type::managed);
-  fcp_data.yij2.resize(number2, Memory_Type::managed);
-  fcp_data.zij2.resize(number2, Memory_Type::managed);
-
-  for (int nc = 0; nc < number2; nc++) {
-    int i, j, index;
-    count = fscanf(fid_cluster, "%d%d%d", &i, &j, &index);
-    PRINT_SCANF_ERROR(count, 3, "Reading error for clusters_order2.in.");
-
-    if (i < 0 || i >= N) {
-      PRINT_INPUT_ERROR("i < 0 or >= N.");
-    }
-    if (j < 0 || j >= N) {
-      PRINT_INPUT_ERROR("j < 0 or >= N.");
-    }
-    if (index < 0 || index >= num_fcs) {
-      PRINT_INPUT_ERROR("idx_fcs < 0 or >= num_fcs");
-    }
-
-    fcp_data.i2[nc] = i;
-    fcp_data.j2[nc] = j;
-    fcp_data.index2[nc] = index;
-
-    double xij2 = fcp_data.r0[j] - fcp_data.r0[i];
-    double yij2 = fcp_data.r0[j + N] - fcp_data.r0[i + N];
-    double zij2 = fcp_data.r0[j + N * 2] - fcp_data.r0[i + N * 2];
-    apply_mic(box, xij2, yij2, zij2);
-    fcp_data.xij2[nc] = xij2 * 0.5;
-    fcp_data.yij2[nc] = yij2 * 0.5;
-    fcp_data.zij2[nc] = zij2 * 0.5;
+  phi[p]->resize(size_t(clusters.num_fcs) * num_components);
+  phi[p]->copy_from_host(clusters.phi);
+  index[p]->resize(num_clusters);
+  index[p]->copy_from_host(clusters.index);
+  for (int a = 1; a < p; ++a) {
+    atoms[p][a]->resize(num_clusters);
+    atoms[p][a]->copy_from_host(clusters.atoms + size_t(a - 1) * num_clusters);
   }
 
-  fclose(fid_fc);
-  fclose(fid_cluster);
-}
-
-void FCP::read_fc3(const int N, const Box& box)
-{
-  // reading fcs_order3.in
-  char file_fc[200];
-  strcpy(file_fc, file_path);
-  strcat(file_fc, "/fcs_order3.in");
-  FILE* fid_fc = my_fopen(file_fc, "r");
-
-  printf("    Reading data from %s\n", file_fc);
-
-  int num_fcs = 0;
-  int count = fscanf(fid_fc, "%d", &num_fcs);
-  PRINT_SCANF_ERROR(count, 1, "Reading error for fcs_order3.in.");
-  if (num_fcs <= 0) {
-    PRINT_INPUT_ERROR("number of force constant matrix should > 0.");
+  std::vector<int> first_atom(num_clusters);
+  std::vector<float> xij, yij, zij, weight;
+  if (p <= 3) {
+    xij.resize(num_clusters);
+    yij.resize(num_clusters);
+    zij.resize(num_clusters);
+  } else {
+    weight.resize(num_clusters);
   }
-
-  fcp_data.phi3.resize(num_fcs * 27, Memory_Type::managed);
-  for (int n = 0; n < num_fcs; ++n)
-    for (int a = 0; a < 3; ++a)
-      for (int b = 0; b < 3; ++b)
-        for (int c = 0; c < 3; ++c) {
-          int index = n * 27 + a * 9 + b * 3 + c;
-          int aa, bb, cc; // not used
-          count = fscanf(fid_fc, "%d%d%d%f", &aa, &bb, &cc, &fcp_data.phi3[index]);
-          PRINT_SCANF_ERROR(count, 4, "Reading error for fcs_order3.in.");
+  const float* r0 = input.r0();
+  const double factor = 1.0 / p;
+
+#pragma omp parallel for schedule(dynamic, 256)
+  for (int i = 0; i < N; ++i) {
+    for (int nc = clusters.first_cluster[i]; nc < clusters.first_cluster[i + 1]; ++nc) {
+      first_atom[nc] = i;
+      if (p <= 3) {
+        const int j = clusters.atoms[nc];
+        double x = r0[j] - r0[i];
+        double y = r0[j + N] - r0[i + N];
+        double z = r0[j + N * 2] - r0[i + N * 2];
+        apply_mic(box, x, y, z);
+        xij[nc] = x * factor;
+        yij[nc] = y * factor;
+        zij[nc] = z * factor;
+      } else {
+        int a[FCP_MAX_ORDER];
+        a[0] = i;
+        for (int m = 1; m < p; ++m) {
+          a[m] = clusters.atoms[size_t(m - 1) * num_clusters + nc];
         }
-
-  // reading clusters_order3.in
-  char file_cluster[200];
-  strcpy(file_cluster, file_path);
-  strcat(file_cluster, "/clusters_order3.in");
-  FILE* fid_cluster = my_fopen(file_cluster, "r");
-
-  printf("    Reading data from %s\n", file_cluster);
-
-  count = fscanf(fid_cluster, "%d", &number3);
-  PRINT_SCANF_ERROR(count, 1, "Reading error for clusters_order3.in.");
-  if (number3 <= 0) {
-    PRINT_INPUT_ERROR("number of clusters should > 0.");
-  }
-
-  fcp_data.i3.resize(number3, Memory_Type::managed);
-  fcp_data.j3.resize(number3, Memory_Type::managed);
-  fcp_data.k3.resize(number3, Memory_Type::managed);
-  fcp_data.index3.resize(number3, Memory_Type::managed);
-  fcp_data.xij3.resize(number3, Memory_Type::managed);
-  fcp_data.yij3.resize(number3, Memory_Type::managed);
-  fcp_data.zij3.resize(number3, Memory_Type::managed);
-
-  for (int nc = 0; nc < number3; nc++) {
-    int i, j, k, index;
-    count = fscanf(fid_cluster, "%d%d%d%d", &i, &j, &k, &index);
-    PRINT_SCANF_ERROR(count, 4, "Reading error for clusters_order3.in.");
-
-    if (i < 0 || i >= N) {
-      PRINT_INPUT_ERROR("i < 0 or >= N.");
-    }
-    if (j < 0 || j >= N) {
-      PRINT_INPUT_ERROR("j < 0 or >= N.");
-    }
-    if (k < 0 || k >= N) {
-      PRINT_INPUT_ERROR("k < 0 or >= N.");
-    }
-    if (index < 0 || index >= num_fcs) {
-      PRINT_INPUT_ERROR("idx_fcs < 0 or >= num_fcs");
-    }
-
-    fcp_data.i3[nc] = i;
-    fcp_data.j3[nc] = j;
-    fcp_data.k3[nc] = k;
-    fcp_data.index3[nc] = index;
-
-    double xij3 = fcp_data.r0[j] - fcp_data.r0[i];
-    double yij3 = fcp_data.r0[j + N] - fcp_data.r0[i + N];
-    double zij3 = fcp_data.r0[j + N * 2] - fcp_data.r0[i + N * 2];
-    apply_mic(box, xij3, yij3, zij3);
-    fcp_data.xij3[nc] = xij3 / 3.0;
-    fcp_data.yij3[nc] = yij3 / 3.0;
-    fcp_data.zij3[nc] = zij3 / 3.0;
-  }
-
-  fclose(fid_fc);
-  fclose(fid_cluster);
-}
-
-void FCP::read_fc4(const int N)
-{
-  // reading fcs_order4.in
-  char file_fc[200];
-  strcpy(file_fc, file_path);
-  strcat(file_fc, "/fcs_order4.in");
-  FILE* fid_fc = my_fopen(file_fc, "r");
-
-  printf("    Reading data from %s\n", file_fc);
-
-  int num_fcs = 0;
-  int count = fscanf(fid_fc, "%d", &num_fcs);
-  PRINT_SCANF_ERROR(count, 1, "Reading error for fcs_order4.in.");
-  if (num_fcs <= 0) {
-    PRINT_INPUT_ERROR("number of force constant matrix should > 0.");
-  }
-
-  fcp_data.phi4.resize(num_fcs * 81, Memory_Type::managed);
-  for (int n = 0; n < num_fcs; ++n)
-    for (int a = 0; a < 3; ++a)
-      for (int b = 0; b < 3; ++b)
-        for (int c = 0; c < 3; ++c)
-          for (int d = 0; d < 3; ++d) {
-            int index = n * 81 + a * 27 + b * 9 + c * 3 + d;
-            int aa, bb, cc, dd; // not used
-            count = fscanf(fid_fc, "%d%d%d%d%f", &aa, &bb, &cc, &dd, &fcp_data.phi4[index]);
-            PRINT_SCANF_ERROR(count, 5, "Reading error for fcs_order4.in.");
-          }
-
-  // reading clusters_order4.in
-  char file_cluster[200];
-  strcpy(file_cluster, file_path);
-  strcat(file_cluster, "/clusters_order4.in");
-  FILE* fid_cluster = my_fopen(file_cluster, "r");
-
-  printf("    Reading data from %s\n", file_cluster);
-
-  count = fscanf(fid_cluster, "%d", &number4);
-  PRINT_SCANF_ERROR(count, 1, "Reading error for clusters_order4.in.");
-  if (number4 <= 0) {
-    PRINT_INPUT_ERROR("number of clusters should > 0.");
-  }
-
-  fcp_data.i4.resize(number4, Memory_Type::managed);
-  fcp_data.j4.resize(number4, Memory_Type::managed);
-  fcp_data.k4.resize(number4, Memory_Type::managed);
-  fcp_data.l4.resize(number4, Memory_Type::managed);
-  fcp_data.index4.resize(number4, Memory_Type::managed);
-  fcp_data.weight4.resize(number4, 1.0f, Memory_Type::managed);
-
-  for (int nc = 0; nc < number4; nc++) {
-    int i, j, k, l, index;
-    count = fscanf(fid_cluster, "%d%d%d%d%d", &i, &j, &k, &l, &index);
-    PRINT_SCANF_ERROR(count, 5, "Reading error for clusters_order4.in.");
-
-    if (i < 0 || i >= N) {
-      PRINT_INPUT_ERROR("i < 0 or >= N.");
-    }
-    if (j < 0 || j >= N) {
-      PRINT_INPUT_ERROR("j < 0 or >= N.");
-    }
-    if (k < 0 || k >= N) {
-      PRINT_INPUT_ERROR("k < 0 or >= N.");
-    }
-    if (l < 0 || l >= N) {
-      PRINT_INPUT_ERROR("l < 0 or >= N.");
-    }
-    if (i > j) {
-      PRINT_INPUT_ERROR("i > j.");
-    }
-    if (j > k) {
-      PRINT_INPUT_ERROR("j > k.");
-    }
-    if (k > l) {
-      PRINT_INPUT_ERROR("k > l.");
-    }
-    if (index < 0 || index >= num_fcs) {
-      PRINT_INPUT_ERROR("idx_fcs < 0 or >= num_fcs");
-    }
-
-    fcp_data.i4[nc] = i;
-    fcp_data.j4[nc] = j;
-    fcp_data.k4[nc] = k;
-    fcp_data.l4[nc] = l;
-    fcp_data.index4[nc] = index;
-
-    // 2^3-1 = 7 cases:
-    if (i == j && j != k && k != l) {
-      fcp_data.weight4[nc] /= 2;
-    } // 1123
-    if (i != j && j == k && k != l) {
-      fcp_data.weight4[nc] /= 2;
-    } // 1223
-    if (i != j && j != k && k == l) {
-      fcp_data.weight4[nc] /= 2;
-    } // 1233
-    if (i == j && j != k && k == l) {
-      fcp_data.weight4[nc] /= 4;
-    } // 1122
-    if (i == j && j == k && k != l) {
-      fcp_data.weight4[nc] /= 6;
-    } // 1112
-    if (i != j && j == k && k == l) {
-      fcp_data.weight4[nc] /= 6;
-    } // 1222
-    if (i == j && j == k && k == l) {
-      fcp_data.weight4[nc] /= 24;
-    } // 1111
-  }
-
-  fclose(fid_fc);
-  fclose(fid_cluster);
-}
-
-void FCP::read_fc5(const int N)
-{
-  // reading fcs_order5.in
-  char file_fc[200];
-  strcpy(file_fc, file_path);
-  strcat(file_fc, "/fcs_order5.in");
-  FILE* fid_fc = my_fopen(file_fc, "r");
-
-  printf("    Reading data from %s\n", file_fc);
-
-  int num_fcs = 0;
-  int count = fscanf(fid_fc, "%d", &num_fcs);
-  PRINT_SCANF_ERROR(count, 1, "Reading error for fcs_order5.in.");
-  if (num_fcs <= 0) {
-    PRINT_INPUT_ERROR("number of force constant matrix should > 0.");
-  }
-
-  fcp_data.phi5.resize(num_fcs * 243, Memory_Type::managed);
-  for (int n = 0; n < num_fcs; ++n)
-    for (int a = 0; a < 3; ++a)
-      for (int b = 0; b < 3; ++b)
-        for (int c = 0; c < 3; ++c)
-          for (int d = 0; d < 3; ++d)
-            for (int e = 0; e < 3; ++e) {
-              int index = n * 243 + a * 81 + b * 27 + c * 9 + d * 3 + e;
-              int aa, bb, cc, dd, ee; // not used
-              count =
-                fscanf(fid_fc, "%d%d%d%d%d%f", &aa, &bb, &cc, &dd, &ee, &fcp_data.phi5[index]);
-              PRINT_SCANF_ERROR(count, 6, "Reading error for fcs_order5.in.");
-            }
-
-  // reading clusters_order5.in
-  char file_cluster[200];
-  strcpy(file_cluster, file_path);
-  strcat(file_cluster, "/clusters_order5.in");
-  FILE* fid_cluster = my_fopen(file_cluster, "r");
-
-  printf("    Reading data from %s\n", file_cluster);
-
-  count = fscanf(fid_cluster, "%d", &number5);
-  PRINT_SCANF_ERROR(count, 1, "Reading error for clusters_order5.in.");
-  if (number5 <= 0) {
-    PRINT_INPUT_ERROR("number of clusters should > 0.");
-  }
-
-  fcp_data.i5.resize(number5, Memory_Type::managed);
-  fcp_data.j5.resize(number5, Memory_Type::managed);
-  fcp_data.k5.resize(number5, Memory_Type::managed);
-  fcp_data.l5.resize(number5, Memory_Type::managed);
-  fcp_data.m5.resize(number5, Memory_Type::managed);
-  fcp_data.index5.resize(number5, Memory_Type::managed);
-  fcp_data.weight5.resize(number5, 1.0f, Memory_Type::managed);
-
-  for (int nc = 0; nc < number5; nc++) {
-    int i, j, k, l, m, index;
-    count = fscanf(fid_cluster, "%d%d%d%d%d%d", &i, &j, &k, &l, &m, &index);
-    PRINT_SCANF_ERROR(count, 6, "Reading error for clusters_order5.in.");
-
-    if (i < 0 || i >= N) {
-      PRINT_INPUT_ERROR("i < 0 or >= N.");
-    }
-    if (j < 0 || j >= N) {
-      PRINT_INPUT_ERROR("j < 0 or >= N.");
-    }
-    if (k < 0 || k >= N) {
-      PRINT_INPUT_ERROR("k < 0 or >= N.");
-    }
-    if (l < 0 || l >= N) {
-      PRINT_INPUT_ERROR("l < 0 or >= N.");
-    }
-    if (m < 0 || m >= N) {
-      PRINT_INPUT_ERROR("m < 0 or >= N.");
-    }
-    if (i > j) {
-      PRINT_INPUT_ERROR("i > j.");
-    }
-    if (j > k) {
-      PRINT_INPUT_ERROR("j > k.");
-    }
-    if (k > l) {
-      PRINT_INPUT_ERROR("k > l.");
-    }
-    if (l > m) {
-      PRINT_INPUT_ERROR("l > m.");
-    }
-    if (index < 0 || index >= num_fcs) {
-      PRINT_INPUT_ERROR("idx_fcs < 0 or >= num_fcs");
+        weight[nc] = get_weight(a, p);
+      }
     }
-
-    fcp_data.i5[nc] = i;
-    fcp_data.j5[nc] = j;
-    fcp_data.k5[nc] = k;
-    fcp_data.l5[nc] = l;
-    fcp_data.m5[nc] = m;
-    fcp_data.index5[nc] = index;
-
-    // 2^4-1 = 15 cases:
-    if (i == j && j != k && k != l && l != m) {
-      fcp_data.weight5[nc] /= 2;
-    } // 11234
-    if (i != j && j == k && k != l && l != m) {
-      fcp_data.weight5[nc] /= 2;
-    } // 12234
-    if (i != j && j != k && k == l && l != m) {
-      fcp_data.weight5[nc] /= 2;
-    } // 12334
-    if (i != j && j != k && k != l && l == m) {
-      fcp_data.weight5[nc] /= 2;
-    } // 12344
-    if (i == j && j == k && k != l && l != m) {
-      fcp_data.weight5[nc] /= 6;
-    } // 11123
-    if (i != j && j == k && k == l && l != m) {
-      fcp_data.weight5[nc] /= 6;
-    } // 12223
-    if (i != j && j != k && k == l && l == m) {
-      fcp_data.weight5[nc] /= 6;
-    } // 12333
-    if (i == j && j == k && k == l && l != m) {
-      fcp_data.weight5[nc] /= 24;
-    } // 11112
-    if (i != j && j == k && k == l && l == m) {
-      fcp_data.weight5[nc] /= 24;
-    } // 12222
-    if (i == j && j == k && k == l && l == m) {
-      fcp_data.weight5[nc] /= 120;
-    } // 11111
-    if (i == j && j != k && k == l && l != m) {
-      fcp_data.weight5[nc] /= 4;
-    } // 11223
-    if (i == j && j != k && k != l && l == m) {
-      fcp_data.weight5[nc] /= 4;
-    } // 11233
-    if (i != j && j == k && k != l && l == m) {
-      fcp_data.weight5[nc] /= 4;
-    } // 12233
-    if (i == j && j != k && k == l && l == m) {
-      fcp_data.weight5[nc] /= 12;
-    } // 11222
-    if (i == j && j == k && k != l && l == m) {
-      fcp_data.weight5[nc] /= 12;
-    } // 11122
-  }
-
-  fclose(fid_fc);
-  fclose(fid_cluster);
-}
-
-void FCP::read_fc6(const int N)
-{
-  // reading fcs_order6.in
-  char file_fc[200];
-  strcpy(file_fc, file_path);
-  strcat(file_fc, "/fcs_order6.in");
-  FILE* fid_fc = my_fopen(file_fc, "r");
-
-  printf("    Reading data from %s\n", file_fc);
-
-  int num_fcs = 0;
-  int count = fscanf(fid_fc, "%d", &num_fcs);
-  PRINT_SCANF_ERROR(count, 1, "Reading error for fcs_order6.in.");
-  if (num_fcs <= 0) {
-    PRINT_INPUT_ERROR("number of force constant matrix should > 0.");
-  }
-
-  fcp_data.phi6.resize(num_fcs * 729, Memory_Type::managed);
-  for (int n = 0; n < num_fcs; ++n)
-    for (int a = 0; a < 3; ++a)
-      for (int b = 0; b < 3; ++b)
-        for (int c = 0; c < 3; ++c)
-          for (int d = 0; d < 3; ++d)
-            for (int e = 0; e < 3; ++e)
-              for (int f = 0; f < 3; ++f) {
-                int index = n * 729 + a * 243 + b * 81 + c * 27 + d * 9 + e * 3 + f;
-                int aa, bb, cc, dd, ee, ff; // not used
-                count = fscanf(
-                  fid_fc, "%d%d%d%d%d%d%f", &aa, &bb, &cc, &dd, &ee, &ff, &fcp_data.phi6[index]);
-                PRINT_SCANF_ERROR(count, 7, "Reading error for fcs_order6.in.");
-              }
-
-  // reading clusters_order6.in
-  char file_cluster[200];
-  strcpy(file_cluster, file_path);
-  strcat(file_cluster, "/clusters_order6.in");
-  FILE* fid_cluster = my_fopen(file_cluster, "r");
-
-  printf("    Reading data from %s\n", file_cluster);
-
-  count = fscanf(fid_cluster, "%d", &number6);
-  PRINT_SCANF_ERROR(count, 1, "Reading error for clusters_order6.in.");
-  if (number6 <= 0) {
-    PRINT_INPUT_ERROR("number of clusters should > 0.");
   }
 
-  fcp_data.i6.resize(number6, Memory_Type::managed);
-  fcp_data.j6.resize(number6, Memory_Type::managed);
-  fcp_data.k6.resize(number6, Memory_Type::managed);
-  fcp_data.l6.resize(number6, Memory_Type::managed);
-  fcp_data.m6.resize(number6, Memory_Type::managed);
-  fcp_data.n6.resize(number6, Memory_Type::managed);
-  fcp_data.index6.resize(number6, Memory_Type::managed);
-  fcp_data.weight6.resize(number6, 1.0f, Memory_Type::managed);
-
-  for (int nc = 0; nc < number6; nc++) {
-    int i, j, k, l, m, n, index;
-    count = fscanf(fid_cluster, "%d%d%d%d%d%d%d", &i, &j, &k, &l, &m, &n, &index);
-    PRINT_SCANF_ERROR(count, 7, "Reading error for clusters_order6.in.");
-
-    if (i < 0 || i >= N) {
-      PRINT_INPUT_ERROR("i < 0 or >= N.");
-    }
-    if (j < 0 || j >= N) {
-      PRINT_INPUT_ERROR("j < 0 or >= N.");
-    }
-    if (k < 0 || k >= N) {
-      PRINT_INPUT_ERROR("k < 0 or >= N.");
-    }
-    if (l < 0 || l >= N) {
-      PRINT_INPUT_ERROR("l < 0 or >= N.");
-    }
-    if (m < 0 || m >= N) {
-      PRINT_INPUT_ERROR("m < 0 or >= N.");
-    }
-    if (n < 0 || n >= N) {
-      PRINT_INPUT_ERROR("n < 0 or >= N.");
-    }
-    if (i > j) {
-      PRINT_INPUT_ERROR("i > j.");
-    }
-    if (j > k) {
-      PRINT_INPUT_ERROR("j > k.");
-    }
-    if (k > l) {
-      PRINT_INPUT_ERROR("k > l.");
-    }
-    if (l > m) {
-      PRINT_INPUT_ERROR("l > m.");
-    }
-    if (m > n) {
-      PRINT_INPUT_ERROR("m > n.");
-    }
-    if (index < 0 || index >= num_fcs) {
-      PRINT_INPUT_ERROR("idx_fcs < 0 or >= num_fcs");
-    }
-
-    fcp_data.i6[nc] = i;
-    fcp_data.j6[nc] = j;
-    fcp_data.k6[nc] = k;
-    fcp_data.l6[nc] = l;
-    fcp_data.m6[nc] = m;
-    fcp_data.n6[nc] = n;
-    fcp_data.index6[nc] = index;
-
-    // 2^5-1 = 31 cases:
-    if (i == j && j != k && k != l && l != m && m != n) {
-      fcp_data.weight6[nc] /= 2;
-    } // 112345
-    if (i != j && j == k && k != l && l != m && m != n) {
-      fcp_data.weight6[nc] /= 2;
-    } // 122345
-    if (i != j && j != k && k == l && l != m && m != n) {
-      fcp_data.weight6[nc] /= 2;
-    } // 123345
-    if (i != j && j != k && k != l && l == m && m != n) {
-      fcp_data.weight6[nc] /= 2;
-    } // 123445
-    if (i != j && j != k && k != l && l != m && m == n) {
-      fcp_data.weight6[nc] /= 2;
-    } // 123455
-    if (i == j && j == k && k != l && l != m && m != n) {
-      fcp_data.weight6[nc] /= 6;
-    } // 111234
-    if (i != j && j == k && k == l && l != m && m != n) {
-      fcp_data.weight6[nc] /= 6;
-    } // 122234
-    if (i != j && j != k && k == l && l == m && m != n) {
-      fcp_data.weight6[nc] /= 6;
-    } // 123334
-    if (i != j && j != k && k != l && l == m && m == n) {
-      fcp_data.weight6[nc] /= 6;
-    } // 123444
-    if (i == j && j == k && k == l && l != m && m != n) {
-      fcp_data.weight6[nc] /= 24;
-    } // 111123
-    if (i != j && j == k && k == l && l == m && m != n) {
-      fcp_data.weight6[nc] /= 24;
-    } // 122223
-    if (i != j && j != k && k == l && l == m && m == n) {
-      fcp_data.weight6[nc] /= 24;
-    } // 122223
-    if (i == j && j == k && k == l && l == m && m != n) {
-      fcp_data.weight6[nc] /= 120;
-    } // 111112
-    if (i != j && j == k && k == l && l == m && m == n) {
-      fcp_data.weight6[nc] /= 120;
-    } // 122222
-    if (i == j && j == k && k == l && l == m && m == n) {
-      fcp_data.weight6[nc] /= 720;
-    } // 111111
-    if (i == j && j != k && k == l && l != m && m != n) {
-      fcp_data.weight6[nc] /= 4;
-    } // 112234
-    if (i == j && j != k && k != l && l == m && m != n) {
-      fcp_data.weight6[nc] /= 4;
-    } // 112334
-    if (i == j && j != k && k != l && l != m && m == n) {
-      fcp_data.weight6[nc] /= 4;
-    } // 112344
-    if (i != j && j == k && k != l && l == m && m != n) {
-      fcp_data.weight6[nc] /= 4;
-    } // 122334
-    if (i != j && j == k && k != l && l != m && m == n) {
-      fcp_data.weight6[nc] /= 4;
-    } // 122344
-    if (i != j && j != k && k == l && l != m && m == n) {
-      fcp_data.weight6[nc] /= 4;
-    } // 123344
-    if (i == j && j != k && k == l && l == m && m != n) {
-      fcp_data.weight6[nc] /= 12;
-    } // 112223
-    if (i == j && j != k && k != l && l == m && m == n) {
-      fcp_data.weight6[nc] /= 12;
-    } // 112333
-    if (i != j && j == k && k != l && l == m && m == n) {
-      fcp_data.weight6[nc] /= 12;
-    } // 122333
-    if (i == j && j == k && k != l && l == m && m != n) {
-      fcp_data.weight6[nc] /= 12;
-    } // 111223
-    if (i == j && j == k && k != l && l != m && m == n) {
-      fcp_data.weight6[nc] /= 12;
-    } // 111233
-    if (i != j && j == k && k == l && l != m && m == n) {
-      fcp_data.weight6[nc] /= 12;
-    } // 122233
-    if (i == j && j != k && k == l && l == m && m == n) {
-      fcp_data.weight6[nc] /= 48;
-    } // 112222
-    if (i == j && j == k && k == l && l != m && m == n) {
-      fcp_data.weight6[nc] /= 48;
-    } // 111122
-    if (i == j && j == k && k != l && l == m && m == n) {
-      fcp_data.weight6[nc] /= 36;
-    } // 111222
-    if (i == j && j != k && k == l && l != m && m == n) {
-      fcp_data.weight6[nc] /= 8;
-    } // 112233
+  atoms[p][0]->resize(num_clusters);
+  atoms[p][0]->copy_from_host(first_atom.data());
+  if (p == 2) {
+    fcp_data.xij2.resize(num_clusters);
+    fcp_data.yij2.resize(num_clusters);
+    fcp_data.zij2.resize(num_clusters);
+    fcp_data.xij2.copy_from_host(xij.data());
+    fcp_data.yij2.copy_from_host(yij.data());
+    fcp_data.zij2.copy_from_host(zij.data());
+  } else if (p == 3) {
+    fcp_data.xij3.resize(num_clusters);
+    fcp_data.yij3.resize(num_clusters);
+    fcp_data.zij3.resize(num_clusters);
+    fcp_data.xij3.copy_from_host(xij.data());
+    fcp_data.yij3.copy_from_host(yij.data());
+    fcp_data.zij3.copy_from_host(zij.data());
+  } else {
+    GPU_Vector<float>& weight_p =
+      (p == 4) ? fcp_data.weight4 : ((p == 5) ? fcp_data.weight5 : fcp_data.weight6);
+    weight_p.resize(num_clusters);
+    weight_p.copy_from_host(weight.data());
   }
-
-  fclose(fid_fc);
-  fclose(fid_cluster);
 }
 
 // potential, force, and virial from the second-order force constants
@@ -15,6 +15,7 @@
 
 #pragma once
 #include "potential.cuh"
+#include "read_fcp.cuh"
 #include "utilities/gpu_vector.cuh"
 #include <stdio.h>
 
@@ -47,10 +48,5 @@ protected:
   int order, heat_order, number2, number3, number4, number5, number6;
   char file_path[200];
   FCP_Data fcp_data;
-  void read_r0(const int N);
-  void read_fc2(const int N, const Box& box);
-  void read_fc3(const int N, const Box& box);
-  void read_fc4(const int N);
-  void read_fc5(const int N);
-  void read_fc6(const int N);
+  void set_clusters(const FCP_Input& input, const int order, const Box& box);
 };
@@ -146,6 +146,18 @@ void Force::parse_potential(
   if (potentials.size() > 1 && has_non_nep) {
     PRINT_INPUT_ERROR("Multiple potentials may only be used with NEP potentials.\n");
   }
+
+  // Check if this potential can reuse the neighbor lists of the first one in a committee
+  const NEP3* nep_first = dynamic_cast<const NEP3*>(potentials[0].get());
+  const NEP3* nep_last = dynamic_cast<const NEP3*>(potentials.back().get());
+  const bool shares_neighbor_list = potentials.size() > 1 && nep_first != nullptr &&
+                                    nep_last != nullptr &&
+                                    nep_last->has_same_neighbor_list(*nep_first);
+  shares_neighbor_list_.push_back(shares_neighbor_list);
+  if (shares_neighbor_list) {
+    shares_neighbor_list_[0] = true;
+    printf("    uses the neighbor lists of the first potential in a committee.\n");
+  }
 }
 
 int Force::get_number_of_types(FILE* fid_potential)
@@ -438,6 +450,47 @@ static __global__ void gpu_average_properties(
 
 void Force::set_multiple_potentials_mode(std::string mode) { multiple_potentials_mode_ = mode; }
 
+void Force::find_committee_neighbor_list(Box& box, GPU_Vector<double>& position_per_atom)
+{
+  if (shares_neighbor_list_[0]) {
+    static_cast<NEP3*>(potentials[0].get())->find_neighbor_list(box, position_per_atom);
+  }
+}
+
+void Force::compute_committee_member(
+  const int potential_index,
+  Box& box,
+  GPU_Vector<double>& position_per_atom,
+  GPU_Vector<int>& type,
+  GPU_Vector<double>& potential_per_atom,
+  GPU_Vector<double>& force_per_atom,
+  GPU_Vector<double>& virial_per_atom)
+{
+  Potential* potential = potentials[potential_index].get();
+  if (shares_neighbor_list_[potential_index]) {
+    static_cast<NEP3*>(potential)->compute_with_neighbor_list(
+      *static_cast<const NEP3*>(potentials[0].get()),
+      box,
+      type,
+      position_per_atom,
+      potential_per_atom,
+      force_per_atom,
+      virial_per_atom);
+  } else if (3 == potential->nep_model_type) {
+    potential->compute(
+      temperature,
+      box,
+      type,
+      position_per_atom,
+      potential_per_atom,
+      force_per_atom,
+      virial_per_atom);
+  } else {
+    potential->compute(
+      box, type, position_per_atom, potential_per_atom, force_per_atom, virial_per_atom);
+  }
+}
+
 void Force::compute(
   Box& box,
   GPU_Vector<double>& position_per_atom,
@@ -483,21 +536,11 @@ void Force::compute(
     }
   } else if (multiple_potentials_mode_.compare("average") == 0) {
     // Calculate average potential, force and virial per atom.
+    find_committee_neighbor_list(box, position_per_atom);
     for (int i = 0; i < potentials.size(); i++) {
       // potential->compute automatically adds the properties
-      if (3 == potentials[i]->nep_model_type) {
-        potentials[i]->compute(
-          temperature,
-          box,
-          type,
-          position_per_atom,
-          potential_per_atom,
-          force_per_atom,
-          virial_per_atom);
-      } else {
-        potentials[i]->compute(
-          box, type, position_per_atom, potential_per_atom, force_per_atom, virial_per_atom);
-      }
+      compute_committee_member(
+        i, box, position_per_atom, type, potential_per_atom, force_per_atom, virial_per_atom);
     }
     // Compute average and copy properties back into original vectors.
     gpu_average_properties<<<(number_of_atoms - 1) / 128 + 1, 128>>>(
@@ -770,21 +813,11 @@ void Force::compute(
     }
   } else if (multiple_potentials_mode_.compare("average") == 0) {
     // Calculate average potential, force and virial per atom.
+    find_committee_neighbor_list(box, position_per_atom);
     for (int i = 0; i < potentials.size(); i++) {
       // potential->compute automatically adds the properties
-      if (3 == potentials[i]->nep_model_type) {
-        potentials[i]->compute(
-          temperature,
-          box,
-          type,
-          position_per_atom,
-          potential_per_atom,
-          force_per_atom,
-          virial_per_atom);
-      } else {
-        potentials[i]->compute(
-          box, type, position_per_atom, potential_per_atom, force_per_atom, virial_per_atom);
-      }
+      compute_committee_member(
+        i, box, position_per_atom, type, potential_per_atom, force_per_atom, virial_per_atom);
     }
     // Compute average and copy properties back into original vectors.
     gpu_average_properties<<<(number_of_atoms - 1) / 128 + 1, 128>>>(
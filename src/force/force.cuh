@@ -64,6 +64,18 @@ public:
     const double T);
   void set_multiple_potentials_mode(std::string mode);
 
+  // Evaluates all the potentials as a committee: the NEP models with the same cutoffs and neighbor
+  // list sizes as the first potential are evaluated with its neighbor lists, which are found once.
+  void find_committee_neighbor_list(Box& box, GPU_Vector<double>& position_per_atom);
+  void compute_committee_member(
+    const int potential_index,
+    Box& box,
+    GPU_Vector<double>& position_per_atom,
+    GPU_Vector<int>& type,
+    GPU_Vector<double>& potential_per_atom,
+    GPU_Vector<double>& force_per_atom,
+    GPU_Vector<double>& virial_per_atom);
+
   bool compute_hnemd_ = false;
   int compute_hnemdec_ = -1;
   double hnemd_fe_[3];
@@ -78,6 +90,7 @@ private:
   bool has_non_nep = false;
   std::string multiple_potentials_mode_ = "observe"; // "observe" or "average"
   std::string atom_types[NUM_ELEMENTS];
+  std::vector<bool> shares_neighbor_list_; // with the first potential
 
   void check_types(const char* file_potential);
 };
@@ -16,6 +16,8 @@
 /*----------------------------------------------------------------------------80
 Use finite difference to calculate the seconod order force constants：
     Phi_ij^ab = [F_i^a(-) - F_i^a(+)] / [u_j^b(+) - u_j^b(-)]
+Displacing atom j gives the forces on all the atoms i at once, such that
+a column of force constants costs six force evaluations.
 ------------------------------------------------------------------------------*/
 
 #include "force/force.cuh"
@@ -44,11 +46,23 @@ static void shift_atom(
   }
 }
 
+static __global__ void gpu_gather_force(
+  const int num_rows, const int N, const int* g_rows, const double* g_force, double* g_f)
+{
+  const int m = blockIdx.x * blockDim.x + threadIdx.x;
+  if (m < num_rows) {
+    const int n = g_rows[m];
+    g_f[m * 3 + 0] = g_force[n];
+    g_f[m * 3 + 1] = g_force[n + N];
+    g_f[m * 3 + 2] = g_force[n + N * 2];
+  }
+}
+
 static void get_f(
   const double dx,
-  const size_t n1,
   const size_t n2,
   const size_t beta,
+  const GPU_Vector<int>& rows,
   Box& box,
   GPU_Vector<double>& position_per_atom,
   GPU_Vector<int>& type,
@@ -57,28 +71,29 @@ static void get_f(
   GPU_Vector<double>& force_per_atom,
   GPU_Vector<double>& virial_per_atom,
   Force& force,
+  GPU_Vector<double>& f_gpu,
   double* f)
 {
   const int number_of_atoms = type.size();
+  const int num_rows = rows.size();
 
   shift_atom(dx, n2, beta, position_per_atom);
 
   force.compute(
     box, position_per_atom, type, group, potential_per_atom, force_per_atom, virial_per_atom);
 
-  size_t M = sizeof(double);
-  CHECK(cudaMemcpy(f + 0, force_per_atom.data() + n1, M, cudaMemcpyDeviceToHost));
-  CHECK(cudaMemcpy(f + 1, force_per_atom.data() + n1 + number_of_atoms, M, cudaMemcpyDeviceToHost));
-  CHECK(
-    cudaMemcpy(f + 2, force_per_atom.data() + n1 + number_of_atoms * 2, M, cudaMemcpyDeviceToHost));
+  gpu_gather_force<<<(num_rows - 1) / 64 + 1, 64>>>(
+    num_rows, number_of_atoms, rows.data(), force_per_atom.data(), f_gpu.data());
+  CUDA_CHECK_KERNEL
+  f_gpu.copy_to_host(f, num_rows * 3);
 
   shift_atom(-dx, n2, beta, position_per_atom);
 }
 
-void find_H12(
+void find_H_column(
   const double displacement,
-  const size_t n1,
   const size_t n2,
+  const GPU_Vector<int>& rows,
   Box& box,
   GPU_Vector<double>& position_per_atom,
   GPU_Vector<int>& type,
@@ -87,17 +102,19 @@ void find_H12(
   GPU_Vector<double>& force_per_atom,
   GPU_Vector<double>& virial_per_atom,
   Force& force,
-  double* H12)
+  double* H_column)
 {
+  const size_t num_rows = rows.size();
+  GPU_Vector<double> f_gpu(num_rows * 3);
+  std::vector<double> f_positive(num_rows * 3);
+  std::vector<double> f_negative(num_rows * 3);
   double dx2 = displacement * 2;
-  double f_positive[3];
-  double f_negative[3];
   for (size_t beta = 0; beta < 3; ++beta) {
     get_f(
       -displacement,
-      n1,
       n2,
       beta,
+      rows,
       box,
       position_per_atom,
       type,
@@ -106,13 +123,14 @@ void find_H12(
       force_per_atom,
       virial_per_atom,
       force,
-      f_negative);
+      f_gpu,
+      f_negative.data());
 
     get_f(
       displacement,
-      n1,
       n2,
       beta,
+      rows,
       box,
       position_per_atom,
       type,
@@ -121,11 +139,14 @@ void find_H12(
       force_per_atom,
       virial_per_atom,
       force,
-      f_positive);
+      f_gpu,
+      f_positive.data());
 
-    for (size_t alpha = 0; alpha < 3; ++alpha) {
-      size_t index = alpha * 3 + beta;
-      H12[index] = (f_negative[alpha] - f_positive[alpha]) / dx2;
+    for (size_t m = 0; m < num_rows; ++m) {
+      for (size_t alpha = 0; alpha < 3; ++alpha) {
+        size_t index = m * 9 + alpha * 3 + beta;
+        H_column[index] = (f_negative[m * 3 + alpha] - f_positive[m * 3 + alpha]) / dx2;
+      }
     }
   }
 }
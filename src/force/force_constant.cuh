@@ -21,10 +21,11 @@ class Box;
 class Group;
 class Force;
 
-void find_H12(
+// H_column[(m * 3 + a) * 3 + b] = H_ij^ab with i = rows[m] and j = n2
+void find_H_column(
   const double displacement,
-  const size_t n1,
   const size_t n2,
+  const GPU_Vector<int>& rows,
   Box& box,
   GPU_Vector<double>& position_per_atom,
   GPU_Vector<int>& type,
@@ -33,4 +34,4 @@ void find_H12(
   GPU_Vector<double>& force_per_atom,
   GPU_Vector<double>& virial_per_atom,
   Force& force,
-  double* H12);
+  double* H_column);
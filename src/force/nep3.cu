@@ -1134,16 +1134,10 @@ static __global__ void find_force_ZBL(
 }
 
 // large box fo MD applications
-void NEP3::compute_large_box(
-  Box& box,
-  const GPU_Vector<int>& type,
-  const GPU_Vector<double>& position_per_atom,
-  GPU_Vector<double>& potential_per_atom,
-  GPU_Vector<double>& force_per_atom,
-  GPU_Vector<double>& virial_per_atom)
+void NEP3::build_neighbor_list_large_box(Box& box, const GPU_Vector<double>& position_per_atom)
 {
   const int BLOCK_SIZE = 64;
-  const int N = type.size();
+  const int N = position_per_atom.size() / 3;
   const int grid_size = (N2 - N1 - 1) / BLOCK_SIZE + 1;
 
   const double rc_cell_list = 0.5 * rc;
@@ -1210,6 +1204,20 @@ void NEP3::compute_large_box(
   gpu_sort_neighbor_list<<<N, paramb.MN_angular, paramb.MN_angular * sizeof(int)>>>(
     N, nep_data.NN_angular.data(), nep_data.NL_angular.data());
   CUDA_CHECK_KERNEL
+}
+
+void NEP3::compute_large_box(
+  const NEP3_Data& neighbor,
+  Box& box,
+  const GPU_Vector<int>& type,
+  const GPU_Vector<double>& position_per_atom,
+  GPU_Vector<double>& potential_per_atom,
+  GPU_Vector<double>& force_per_atom,
+  GPU_Vector<double>& virial_per_atom)
+{
+  const int BLOCK_SIZE = 64;
+  const int N = type.size();
+  const int grid_size = (N2 - N1 - 1) / BLOCK_SIZE + 1;
 
   bool is_polarizability = paramb.model_type == 2;
   find_descriptor<<<grid_size, BLOCK_SIZE>>>(
@@ -1219,10 +1227,10 @@ void NEP3::compute_large_box(
     N1,
     N2,
     box,
-    nep_data.NN_radial.data(),
-    nep_data.NL_radial.data(),
-    nep_data.NN_angular.data(),
-    nep_data.NL_angular.data(),
+    neighbor.NN_radial.data(),
+    neighbor.NL_radial.data(),
+    neighbor.NN_angular.data(),
+    neighbor.NL_angular.data(),
     type.data(),
     position_per_atom.data(),
     position_per_atom.data() + N,
@@ -1246,8 +1254,8 @@ void NEP3::compute_large_box(
     N1,
     N2,
     box,
-    nep_data.NN_radial.data(),
-    nep_data.NL_radial.data(),
+    neighbor.NN_radial.data(),
+    neighbor.NL_radial.data(),
     type.data(),
     position_per_atom.data(),
     position_per_atom.data() + N,
@@ -1270,8 +1278,8 @@ void NEP3::compute_large_box(
     N1,
     N2,
     box,
-    nep_data.NN_angular.data(),
-    nep_data.NL_angular.data(),
+    neighbor.NN_angular.data(),
+    neighbor.NL_angular.data(),
     type.data(),
     position_per_atom.data(),
     position_per_atom.data() + N,
@@ -1289,8 +1297,8 @@ void NEP3::compute_large_box(
 
   find_properties_many_body(
     box,
-    nep_data.NN_angular.data(),
-    nep_data.NL_angular.data(),
+    neighbor.NN_angular.data(),
+    neighbor.NL_angular.data(),
     nep_data.f12x.data(),
     nep_data.f12y.data(),
     nep_data.f12z.data(),
@@ -1307,8 +1315,8 @@ void NEP3::compute_large_box(
       N1,
       N2,
       box,
-      nep_data.NN_angular.data(),
-      nep_data.NL_angular.data(),
+      neighbor.NN_angular.data(),
+      neighbor.NL_angular.data(),
       type.data(),
       position_per_atom.data(),
       position_per_atom.data() + N,
@@ -1323,25 +1331,25 @@ void NEP3::compute_large_box(
 }
 
 // small box possibly used for active learning:
-void NEP3::compute_small_box(
-  Box& box,
-  const GPU_Vector<int>& type,
-  const GPU_Vector<double>& position_per_atom,
-  GPU_Vector<double>& potential_per_atom,
-  GPU_Vector<double>& force_per_atom,
-  GPU_Vector<double>& virial_per_atom)
+void NEP3::build_neighbor_list_small_box(Box& box, const GPU_Vector<double>& position_per_atom)
 {
   const int BLOCK_SIZE = 64;
-  const int N = type.size();
+  const int N = position_per_atom.size() / 3;
   const int grid_size = (N2 - N1 - 1) / BLOCK_SIZE + 1;
 
+  // kept between the calls such that other models can reuse them
   const int big_neighbor_size = 2000;
-  const int size_x12 = type.size() * big_neighbor_size;
-  GPU_Vector<int> NN_radial(type.size());
-  GPU_Vector<int> NL_radial(size_x12);
-  GPU_Vector<int> NN_angular(type.size());
-  GPU_Vector<int> NL_angular(size_x12);
-  GPU_Vector<float> r12(size_x12 * 6);
+  const int size_x12 = N * big_neighbor_size;
+  if (nep_data.r12_small_box.size() != size_x12 * 6) {
+    nep_data.NL_radial_small_box.resize(size_x12);
+    nep_data.NL_angular_small_box.resize(size_x12);
+    nep_data.r12_small_box.resize(size_x12 * 6);
+  }
+  int* NN_radial = nep_data.NN_radial.data();
+  int* NL_radial = nep_data.NL_radial_small_box.data();
+  int* NN_angular = nep_data.NN_angular.data();
+  int* NL_angular = nep_data.NL_angular_small_box.data();
+  float* r12 = nep_data.r12_small_box.data();
 
   find_neighbor_list_small_box<<<grid_size, BLOCK_SIZE>>>(
     paramb,
@@ -1353,17 +1361,38 @@ void NEP3::compute_small_box(
     position_per_atom.data(),
     position_per_atom.data() + N,
     position_per_atom.data() + N * 2,
-    NN_radial.data(),
-    NL_radial.data(),
-    NN_angular.data(),
-    NL_angular.data(),
-    r12.data(),
-    r12.data() + size_x12,
-    r12.data() + size_x12 * 2,
-    r12.data() + size_x12 * 3,
-    r12.data() + size_x12 * 4,
-    r12.data() + size_x12 * 5);
+    NN_radial,
+    NL_radial,
+    NN_angular,
+    NL_angular,
+    r12,
+    r12 + size_x12,
+    r12 + size_x12 * 2,
+    r12 + size_x12 * 3,
+    r12 + size_x12 * 4,
+    r12 + size_x12 * 5);
   CUDA_CHECK_KERNEL
+}
+
+void NEP3::compute_small_box(
+  const NEP3_Data& neighbor,
+  Box& box,
+  const GPU_Vector<int>& type,
+  const GPU_Vector<double>& position_per_atom,
+  GPU_Vector<double>& potential_per_atom,
+  GPU_Vector<double>& force_per_atom,
+  GPU_Vector<double>& virial_per_atom)
+{
+  const int BLOCK_SIZE = 64;
+  const int N = type.size();
+  const int grid_size = (N2 - N1 - 1) / BLOCK_SIZE + 1;
+
+  const int size_x12 = neighbor.NL_radial_small_box.size();
+  const int* NN_radial = neighbor.NN_radial.data();
+  const int* NL_radial = neighbor.NL_radial_small_box.data();
+  const int* NN_angular = neighbor.NN_angular.data();
+  const int* NL_angular = neighbor.NL_angular_small_box.data();
+  const float* r12 = neighbor.r12_small_box.data();
 
   const bool is_polarizability = paramb.model_type == 2;
   find_descriptor_small_box<<<grid_size, BLOCK_SIZE>>>(
@@ -1372,17 +1401,17 @@ void NEP3::compute_small_box(
     N,
     N1,
     N2,
-    NN_radial.data(),
-    NL_radial.data(),
-    NN_angular.data(),
-    NL_angular.data(),
+    NN_radial,
+    NL_radial,
+    NN_angular,
+    NL_angular,
     type.data(),
-    r12.data(),
-    r12.data() + size_x12,
-    r12.data() + size_x12 * 2,
-    r12.data() + size_x12 * 3,
-    r12.data() + size_x12 * 4,
-    r12.data() + size_x12 * 5,
+    r12,
+    r12 + size_x12,
+    r12 + size_x12 * 2,
+    r12 + size_x12 * 3,
+    r12 + size_x12 * 4,
+    r12 + size_x12 * 5,
     is_polarizability,
 #ifdef USE_TABLE
     nep_data.gn_radial.data(),
@@ -1401,12 +1430,12 @@ void NEP3::compute_small_box(
     N,
     N1,
     N2,
-    NN_radial.data(),
-    NL_radial.data(),
+    NN_radial,
+    NL_radial,
     type.data(),
-    r12.data(),
-    r12.data() + size_x12,
-    r12.data() + size_x12 * 2,
+    r12,
+    r12 + size_x12,
+    r12 + size_x12 * 2,
     nep_data.Fp.data(),
     is_dipole,
 #ifdef USE_TABLE
@@ -1424,12 +1453,12 @@ void NEP3::compute_small_box(
     N,
     N1,
     N2,
-    NN_angular.data(),
-    NL_angular.data(),
+    NN_angular,
+    NL_angular,
     type.data(),
-    r12.data() + size_x12 * 3,
-    r12.data() + size_x12 * 4,
-    r12.data() + size_x12 * 5,
+    r12 + size_x12 * 3,
+    r12 + size_x12 * 4,
+    r12 + size_x12 * 5,
     nep_data.Fp.data(),
     nep_data.sum_fxyz.data(),
     is_dipole,
@@ -1449,12 +1478,12 @@ void NEP3::compute_small_box(
       zbl,
       N1,
       N2,
-      NN_angular.data(),
-      NL_angular.data(),
+      NN_angular,
+      NL_angular,
       type.data(),
-      r12.data() + size_x12 * 3,
-      r12.data() + size_x12 * 4,
-      r12.data() + size_x12 * 5,
+      r12 + size_x12 * 3,
+      r12 + size_x12 * 4,
+      r12 + size_x12 * 5,
       force_per_atom.data(),
       force_per_atom.data() + N,
       force_per_atom.data() + N * 2,
@@ -1534,7 +1563,26 @@ static bool get_expanded_box(const double rc, const Box& box, NEP3::ExpandedBox&
   return is_small_box;
 }
 
-void NEP3::compute(
+bool NEP3::has_same_neighbor_list(const NEP3& other) const
+{
+  return paramb.model_type != 3 && other.paramb.model_type != 3 &&
+         paramb.rc_radial == other.paramb.rc_radial &&
+         paramb.rc_angular == other.paramb.rc_angular &&
+         paramb.MN_radial == other.paramb.MN_radial && paramb.MN_angular == other.paramb.MN_angular;
+}
+
+void NEP3::find_neighbor_list(Box& box, const GPU_Vector<double>& position_per_atom)
+{
+  is_small_box = get_expanded_box(paramb.rc_radial, box, ebox);
+  if (is_small_box) {
+    build_neighbor_list_small_box(box, position_per_atom);
+  } else {
+    build_neighbor_list_large_box(box, position_per_atom);
+  }
+}
+
+void NEP3::compute_with_neighbor_list(
+  const NEP3& owner,
   Box& box,
   const GPU_Vector<int>& type,
   const GPU_Vector<double>& position_per_atom,
@@ -1542,13 +1590,24 @@ void NEP3::compute(
   GPU_Vector<double>& force_per_atom,
   GPU_Vector<double>& virial_per_atom)
 {
-  const bool is_small_box = get_expanded_box(paramb.rc_radial, box, ebox);
-  if (is_small_box) {
+  if (owner.is_small_box) {
     compute_small_box(
-      box, type, position_per_atom, potential_per_atom, force_per_atom, virial_per_atom);
+      owner.nep_data,
+      box,
+      type,
+      position_per_atom,
+      potential_per_atom,
+      force_per_atom,
+      virial_per_atom);
   } else {
     compute_large_box(
-      box, type, position_per_atom, potential_per_atom, force_per_atom, virial_per_atom);
+      owner.nep_data,
+      box,
+      type,
+      position_per_atom,
+      potential_per_atom,
+      force_per_atom,
+      virial_per_atom);
   }
   if (has_dftd3) {
     dftd3.compute(
@@ -1556,6 +1615,19 @@ void NEP3::compute(
   }
 }
 
+void NEP3::compute(
+  Box& box,
+  const GPU_Vector<int>& type,
+  const GPU_Vector<double>& position_per_atom,
+  GPU_Vector<double>& potential_per_atom,
+  GPU_Vector<double>& force_per_atom,
+  GPU_Vector<double>& virial_per_atom)
+{
+  find_neighbor_list(box, position_per_atom);
+  compute_with_neighbor_list(
+    *this, box, type, position_per_atom, potential_per_atom, force_per_atom, virial_per_atom);
+}
+
 static __global__ void find_descriptor(
   const float temperature,
   NEP3::ParaMB paramb,
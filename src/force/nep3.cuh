@@ -36,6 +36,9 @@ struct NEP3_Data {
   GPU_Vector<int> cell_contents;
   std::vector<int> cpu_NN_radial;
   std::vector<int> cpu_NN_angular;
+  GPU_Vector<int> NL_radial_small_box;  // radial neighbor list in a small box
+  GPU_Vector<int> NL_angular_small_box; // angular neighbor list in a small box
+  GPU_Vector<float> r12_small_box;      // neighbor displacements in a small box
 #ifdef USE_TABLE
   GPU_Vector<float> gn_radial;   // tabulated gn_radial functions
   GPU_Vector<float> gnp_radial;  // tabulated gnp_radial functions
@@ -120,6 +123,19 @@ public:
     GPU_Vector<double>& force,
     GPU_Vector<double>& virial);
 
+  // Committee evaluation: a model with the same cutoffs and neighbor list sizes as the owner can
+  // be evaluated with the neighbor lists found by the owner.
+  bool has_same_neighbor_list(const NEP3& other) const;
+  void find_neighbor_list(Box& box, const GPU_Vector<double>& position);
+  void compute_with_neighbor_list(
+    const NEP3& owner,
+    Box& box,
+    const GPU_Vector<int>& type,
+    const GPU_Vector<double>& position,
+    GPU_Vector<double>& potential,
+    GPU_Vector<double>& force,
+    GPU_Vector<double>& virial);
+
 private:
   ParaMB paramb;
   ANN annmb;
@@ -133,7 +149,12 @@ private:
   void construct_table(float* parameters);
 #endif
 
+  bool is_small_box = false;
+  void build_neighbor_list_small_box(Box& box, const GPU_Vector<double>& position);
+  void build_neighbor_list_large_box(Box& box, const GPU_Vector<double>& position);
+
   void compute_small_box(
+    const NEP3_Data& neighbor,
     Box& box,
     const GPU_Vector<int>& type,
     const GPU_Vector<double>& position,
@@ -142,6 +163,7 @@ private:
     GPU_Vector<double>& virial);
 
   void compute_large_box(
+    const NEP3_Data& neighbor,
     Box& box,
     const GPU_Vector<int>& type,
     const GPU_Vector<double>& position,
@@ -0,0 +1,363 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Input of the force constant potential (FCP).
+
+Layout of the binary file fcp.bin (all numbers are 4 bytes):
+    FCP_Binary_Header
+    r0[3][N]
+    for each order from 2 to the highest order:
+        phi[num_fcs][3^order]
+        first_cluster[N + 1]
+        atoms[order - 1][num_clusters]
+        index[num_clusters]
+------------------------------------------------------------------------------*/
+
+#include "read_fcp.cuh"
+#include "utilities/error.cuh"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <stdio.h>
+#include <string>
+
+const char FCP_BINARY_MAGIC[8] = "GPUMDFC";
+const int FCP_BINARY_VERSION = 1;
+
+struct FCP_Binary_Header {
+  char magic[8];                             // FCP_BINARY_MAGIC
+  int version = FCP_BINARY_VERSION;          // format version
+  int number_of_atoms = 0;                   // N
+  int order = 0;                             // highest order of the force constants
+  int num_fcs[FCP_MAX_ORDER + 1] = {0};      // number of force constant tensors of each order
+  int num_clusters[FCP_MAX_ORDER + 1] = {0}; // number of clusters of each order
+  int padding = 0;                           // makes the size a multiple of 8 bytes
+
+  FCP_Binary_Header() { memcpy(magic, FCP_BINARY_MAGIC, sizeof(magic)); }
+};
+
+static int get_num_components(const int order)
+{
+  int num_components = 1;
+  for (int p = 0; p < order; ++p) {
+    num_components *= 3;
+  }
+  return num_components;
+}
+
+static std::string get_filename(const char* path, const char* name, const int order)
+{
+  return std::string(path) + "/" + name + std::to_string(order) + ".in";
+}
+
+void FCP_Input::read_r0_text(const char* path)
+{
+  const std::string filename = std::string(path) + "/r0.in";
+  FILE* fid = my_fopen(filename.c_str(), "r");
+  std::vector<float> r0_xyz;
+  while (true) {
+    float x, y, z;
+    int count = fscanf(fid, "%f%f%f", &x, &y, &z);
+    if (count == EOF) {
+      break;
+    }
+    PRINT_SCANF_ERROR(count, 3, "Reading error for r0.in.");
+    r0_xyz.push_back(x);
+    r0_xyz.push_back(y);
+    r0_xyz.push_back(z);
+  }
+  fclose(fid);
+
+  number_of_atoms_ = r0_xyz.size() / 3;
+  if (number_of_atoms_ <= 0) {
+    PRINT_INPUT_ERROR("r0.in should have at least one atom.");
+  }
+  r0_buffer_.resize(number_of_atoms_ * 3);
+  for (int n = 0; n < number_of_atoms_; ++n) {
+    for (int d = 0; d < 3; ++d) {
+      r0_buffer_[n + number_of_atoms_ * d] = r0_xyz[n * 3 + d];
+    }
+  }
+  r0_ = r0_buffer_.data();
+}
+
+void FCP_Input::read_clusters_text(const char* path, const int order)
+{
+  const int N = number_of_atoms_;
+  const int num_components = get_num_components(order);
+  FCP_Clusters& clusters = clusters_[order];
+
+  // the force constants, with the Cartesian indices (not used) before each component
+  const std::string file_fc = get_filename(path, "fcs_order", order);
+  FILE* fid_fc = my_fopen(file_fc.c_str(), "r");
+  printf("    Reading data from %s\n", file_fc.c_str());
+  int count = fscanf(fid_fc, "%d", &clusters.num_fcs);
+  PRINT_SCANF_ERROR(count, 1, "Reading error for the number of force constants.");
+  if (clusters.num_fcs <= 0) {
+    PRINT_INPUT_ERROR("number of force constant matrix should > 0.");
+  }
+  std::string format_fc;
+  for (int p = 0; p < order; ++p) {
+    format_fc += "%*d";
+  }
+  format_fc += "%f";
+  phi_buffer_[order].resize(size_t(clusters.num_fcs) * num_components);
+  for (size_t n = 0; n < phi_buffer_[order].size(); ++n) {
+    count = fscanf(fid_fc, format_fc.c_str(), &phi_buffer_[order][n]);
+    PRINT_SCANF_ERROR(count, 1, ("Reading error for " + file_fc + ".").c_str());
+  }
+  fclose(fid_fc);
+
+  // the clusters: order atoms and the index of the force constants
+  const std::string file_cluster = get_filename(path, "clusters_order", order);
+  FILE* fid_cluster = my_fopen(file_cluster.c_str(), "r");
+  printf("    Reading data from %s\n", file_cluster.c_str());
+  count = fscanf(fid_cluster, "%d", &clusters.num_clusters);
+  PRINT_SCANF_ERROR(count, 1, "Reading error for the number of clusters.");
+  if (clusters.num_clusters <= 0) {
+    PRINT_INPUT_ERROR("number of clusters should > 0.");
+  }
+  const int num_clusters = clusters.num_clusters;
+  std::string format_cluster;
+  for (int p = 0; p <= order; ++p) {
+    format_cluster += "%d";
+  }
+  std::vector<int> cluster_atoms(size_t(num_clusters) * order);
+  std::vector<int> cluster_index(num_clusters);
+  for (int nc = 0; nc < num_clusters; ++nc) {
+    int a[FCP_MAX_ORDER + 1];
+    count = fscanf(
+      fid_cluster, format_cluster.c_str(), &a[0], &a[1], &a[2], &a[3], &a[4], &a[5], &a[6]);
+    PRINT_SCANF_ERROR(count, order + 1, ("Reading error for " + file_cluster + ".").c_str());
+    for (int p = 0; p < order; ++p) {
+      if (a[p] < 0 || a[p] >= N) {
+        PRINT_INPUT_ERROR("atom index < 0 or >= N.");
+      }
+      // the weights of the clusters of order >= 4 assume sorted atoms
+      if (order >= 4 && p > 0 && a[p - 1] > a[p]) {
+        PRINT_INPUT_ERROR("atom indices of a cluster of order >= 4 should be non-decreasing.");
+      }
+      cluster_atoms[size_t(nc) * order + p] = a[p];
+    }
+    if (a[order] < 0 || a[order] >= clusters.num_fcs) {
+      PRINT_INPUT_ERROR("idx_fcs < 0 or >= num_fcs");
+    }
+    cluster_index[nc] = a[order];
+  }
+  fclose(fid_cluster);
+
+  // sort the clusters by their atoms, which also groups them by the first atom
+  std::vector<int> sorted(num_clusters);
+  std::iota(sorted.begin(), sorted.end(), 0);
+  std::sort(sorted.begin(), sorted.end(), [&](const int c1, const int c2) {
+    return std::lexicographical_compare(
+      cluster_atoms.begin() + size_t(c1) * order,
+      cluster_atoms.begin() + size_t(c1 + 1) * order,
+      cluster_atoms.begin() + size_t(c2) * order,
+      cluster_atoms.begin() + size_t(c2 + 1) * order);
+  });
+
+  std::vector<int>& first_cluster = first_cluster_buffer_[order];
+  std::vector<int>& atoms = atoms_buffer_[order];
+  std::vector<int>& index = index_buffer_[order];
+  first_cluster.assign(N + 1, 0);
+  atoms.resize(size_t(num_clusters) * (order - 1));
+  index.resize(num_clusters);
+  for (int nc = 0; nc < num_clusters; ++nc) {
+    const int* a = cluster_atoms.data() + size_t(sorted[nc]) * order;
+    ++first_cluster[a[0] + 1];
+    for (int p = 1; p < order; ++p) {
+      atoms[size_t(p - 1) * num_clusters + nc] = a[p];
+    }
+    index[nc] = cluster_index[sorted[nc]];
+  }
+  for (int n = 0; n < N; ++n) {
+    first_cluster[n + 1] += first_cluster[n];
+  }
+
+  clusters.phi = phi_buffer_[order].data();
+  clusters.first_cluster = first_cluster.data();
+  clusters.atoms = atoms.data();
+  clusters.index = index.data();
+}
+
+void FCP_Input::read_text(const char* path, const int order)
+{
+  if (order < 2 || order > FCP_MAX_ORDER) {
+    PRINT_INPUT_ERROR("order of the force constants should be 2 to 6.");
+  }
+  order_ = order;
+  read_r0_text(path);
+  printf("    Data in r0.in have been read in.\n");
+  for (int p = 2; p <= order; ++p) {
+    read_clusters_text(path, p);
+  }
+}
+
+// The binary file comes from fcp2bin, but it is checked as thoroughly as the text files, which
+// only costs a pass over the mapped data.
+void FCP_Input::check_clusters(const char* filename, const int order) const
+{
+  const int N = number_of_atoms_;
+  const FCP_Clusters& clusters = clusters_[order];
+  if (clusters.num_fcs <= 0 || clusters.num_clusters <= 0) {
+    printf("Failed to read %s.\n", filename);
+    PRINT_INPUT_ERROR("Numbers of force constants and clusters should > 0.");
+  }
+  if (clusters.first_cluster[0] != 0 || clusters.first_cluster[N] != clusters.num_clusters) {
+    printf("Failed to read %s.\n", filename);
+    PRINT_INPUT_ERROR("The cluster offsets are inconsistent.");
+  }
+
+  int num_errors = 0;
+#pragma omp parallel for reduction(+ : num_errors)
+  for (int i = 0; i < N; ++i) {
+    const int begin = clusters.first_cluster[i];
+    const int end = clusters.first_cluster[i + 1];
+    if (begin > end || end > clusters.num_clusters) {
+      ++num_errors;
+      continue;
+    }
+    for (int nc = begin; nc < end; ++nc) {
+      int previous = i;
+      for (int p = 1; p < order; ++p) {
+        const int atom = clusters.atoms[size_t(p - 1) * clusters.num_clusters + nc];
+        if (atom < 0 || atom >= N || (order >= 4 && atom < previous)) {
+          ++num_errors;
+        }
+        previous = atom;
+      }
+      if (clusters.index[nc] < 0 || clusters.index[nc] >= clusters.num_fcs) {
+        ++num_errors;
+      }
+    }
+  }
+  if (num_errors > 0) {
+    printf("Failed to read %s.\n", filename);
+    PRINT_INPUT_ERROR("The clusters have invalid atom or force constant indices.");
+  }
+}
+
+void FCP_Input::read_binary(const char* filename, const int order)
+{
+  if (order < 2 || order > FCP_MAX_ORDER) {
+    PRINT_INPUT_ERROR("order of the force constants should be 2 to 6.");
+  }
+  order_ = order;
+  file_.reset(new Mapped_File(filename));
+  FCP_Binary_Header header;
+  if (file_->size() < sizeof(header)) {
+    printf("Failed to read %s.\n", filename);
+    PRINT_INPUT_ERROR("The binary FCP file is truncated.");
+  }
+  memcpy(&header, file_->data(), sizeof(header));
+  if (memcmp(header.magic, FCP_BINARY_MAGIC, sizeof(header.magic)) != 0) {
+    printf("Failed to read %s.\n", filename);
+    PRINT_INPUT_ERROR("This is not a binary FCP file.");
+  }
+  if (header.version != FCP_BINARY_VERSION) {
+    printf("Failed to read %s.\n", filename);
+    PRINT_INPUT_ERROR("The binary FCP file is written by another version of GPUMD; please convert "
+                      "it again.");
+  }
+  if (header.number_of_atoms <= 0 || header.order > FCP_MAX_ORDER) {
+    printf("Failed to read %s.\n", filename);
+    PRINT_INPUT_ERROR("The header of the binary FCP file is invalid.");
+  }
+  if (header.order < order) {
+    printf("%s has force constants up to order %d.\n", filename, header.order);
+    PRINT_INPUT_ERROR("The binary FCP file does not have the highest order in the potential file.");
+  }
+
+  const size_t N = header.number_of_atoms;
+  number_of_atoms_ = N;
+  size_t offset = sizeof(header);
+  size_t offset_of_order[FCP_MAX_ORDER + 1] = {0};
+  offset += sizeof(float) * N * 3;
+  for (int p = 2; p <= header.order; ++p) {
+    offset_of_order[p] = offset;
+    offset += sizeof(float) * size_t(header.num_fcs[p]) * get_num_components(p);
+    offset += sizeof(int) * (N + 1);
+    offset += sizeof(int) * size_t(header.num_clusters[p]) * p;
+  }
+  if (file_->size() != offset) {
+    printf("Failed to read %s.\n", filename);
+    PRINT_INPUT_ERROR("Size of the binary FCP file does not match its header.");
+  }
+
+  // the arrays are used in place in the mapped file
+  r0_ = reinterpret_cast<const float*>(file_->data() + sizeof(header));
+  for (int p = 2; p <= order; ++p) {
+    FCP_Clusters& clusters = clusters_[p];
+    clusters.num_fcs = header.num_fcs[p];
+    clusters.num_clusters = header.num_clusters[p];
+    const char* data = file_->data() + offset_of_order[p];
+    clusters.phi = reinterpret_cast<const float*>(data);
+    data += sizeof(float) * size_t(clusters.num_fcs) * get_num_components(p);
+    clusters.first_cluster = reinterpret_cast<const int*>(data);
+    data += sizeof(int) * (N + 1);
+    clusters.atoms = reinterpret_cast<const int*>(data);
+    data += sizeof(int) * size_t(clusters.num_clusters) * (p - 1);
+    clusters.index = reinterpret_cast<const int*>(data);
+    check_clusters(filename, p);
+  }
+}
+
+template <typename T>
+static void write_block(FILE* fid, const T* data, const size_t count, const char* filename)
+{
+  if (count > 0 && fwrite(data, sizeof(T), count, fid) != count) {
+    printf("Failed to write %s.\n", filename);
+    PRINT_INPUT_ERROR("Writing the binary FCP file failed.");
+  }
+}
+
+// write to a temporary file which then replaces the target, such that an interrupted write
+// never leaves a broken file behind
+void FCP_Input::write_binary(const char* filename) const
+{
+  FCP_Binary_Header header;
+  header.number_of_atoms = number_of_atoms_;
+  header.order = order_;
+  for (int p = 2; p <= order_; ++p) {
+    header.num_fcs[p] = clusters_[p].num_fcs;
+    header.num_clusters[p] = clusters_[p].num_clusters;
+  }
+
+  const std::string filename_tmp = std::string(filename) + ".tmp";
+  FILE* fid = my_fopen(filename_tmp.c_str(), "wb");
+  const size_t N = number_of_atoms_;
+  write_block(fid, &header, 1, filename);
+  write_block(fid, r0_, N * 3, filename);
+  for (int p = 2; p <= order_; ++p) {
+    const FCP_Clusters& clusters = clusters_[p];
+    write_block(fid, clusters.phi, size_t(clusters.num_fcs) * get_num_components(p), filename);
+    write_block(fid, clusters.first_cluster, N + 1, filename);
+    write_block(fid, clusters.atoms, size_t(clusters.num_clusters) * (p - 1), filename);
+    write_block(fid, clusters.index, size_t(clusters.num_clusters), filename);
+  }
+  if (fclose(fid) != 0) {
+    printf("Failed to write %s.\n", filename);
+    PRINT_INPUT_ERROR("Writing the binary FCP file failed.");
+  }
+#ifdef _WIN32
+  remove(filename);
+#endif
+  if (rename(filename_tmp.c_str(), filename) != 0) {
+    printf("Failed to rename %s to %s.\n", filename_tmp.c_str(), filename);
+    PRINT_INPUT_ERROR("Writing the binary FCP file failed.");
+  }
+}
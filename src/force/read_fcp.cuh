@@ -0,0 +1,73 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Input of the force constant potential (FCP): either the text files written by
+hiphive (r0.in, fcs_order*.in, clusters_order*.in) or the binary file fcp.bin
+converted from them by fcp2bin, which is memory-mapped.
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include "utilities/mapped_file.cuh"
+#include <memory>
+#include <vector>
+
+const int FCP_MAX_ORDER = 6;
+const char FCP_BINARY_FILE[] = "fcp.bin";
+
+// The force constants and clusters of one order. The clusters are sorted by their atoms and the
+// first atom is stored in a compressed sparse row layout: the clusters with the first atom i are
+// first_cluster[i] to first_cluster[i + 1] - 1.
+struct FCP_Clusters {
+  int num_fcs = 0;                    // number of force constant tensors
+  int num_clusters = 0;               // number of clusters
+  const float* phi = nullptr;         // num_fcs tensors with 3^order components each
+  const int* first_cluster = nullptr; // N + 1 offsets
+  const int* atoms = nullptr;         // the other order - 1 atoms, one array after another
+  const int* index = nullptr;         // index of the force constant tensor of each cluster
+};
+
+class FCP_Input
+{
+public:
+  void read_text(const char* path, const int order);
+  void read_binary(const char* filename, const int order);
+  void write_binary(const char* filename) const;
+
+  int number_of_atoms() const { return number_of_atoms_; }
+  int order() const { return order_; }
+  const float* r0() const { return r0_; } // x, y, and z of the N atoms, one after another
+  const FCP_Clusters& clusters(const int order) const { return clusters_[order]; }
+
+private:
+  int number_of_atoms_ = 0;
+  int order_ = 0;
+  const float* r0_ = nullptr;
+  FCP_Clusters clusters_[FCP_MAX_ORDER + 1];
+
+  // storage of the data read from the text files
+  std::vector<float> r0_buffer_;
+  std::vector<float> phi_buffer_[FCP_MAX_ORDER + 1];
+  std::vector<int> first_cluster_buffer_[FCP_MAX_ORDER + 1];
+  std::vector<int> atoms_buffer_[FCP_MAX_ORDER + 1];
+  std::vector<int> index_buffer_[FCP_MAX_ORDER + 1];
+
+  // storage of the data read from the binary file
+  std::unique_ptr<Mapped_File> file_;
+
+  void read_r0_text(const char* path);
+  void read_clusters_text(const char* path, const int order);
+  void check_clusters(const char* filename, const int order) const;
+};
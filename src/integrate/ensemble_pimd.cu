@@ -150,26 +150,18 @@ void Ensemble_PIMD::initialize(Atom& atom)
 
   transformation_matrix.resize(number_of_beads * number_of_beads);
   std::vector<double> transformation_matrix_cpu(number_of_beads * number_of_beads);
-  double sqrt_factor_1 = sqrt(1.0 / number_of_beads);
-  double sqrt_factor_2 = sqrt(2.0 / number_of_beads);
-  for (int j = 1; j <= number_of_beads; ++j) {
-    double sign_factor = (j % 2 == 0) ? 1.0 : -1.0;
-    for (int k = 0; k < number_of_beads; ++k) {
-      int jk = (j - 1) * number_of_beads + k;
-      double pi_factor = 2.0 * PI * j * k / number_of_beads;
-      if (k == 0) {
-        transformation_matrix_cpu[jk] = sqrt_factor_1;
-      } else if (k < number_of_beads / 2) {
-        transformation_matrix_cpu[jk] = sqrt_factor_2 * cos(pi_factor);
-      } else if (k == number_of_beads / 2) {
-        transformation_matrix_cpu[jk] = sqrt_factor_1 * sign_factor;
-      } else {
-        transformation_matrix_cpu[jk] = sqrt_factor_2 * sin(pi_factor);
-      }
-    }
-  }
+  PIMD_Normal_Modes::find_transformation_matrix(number_of_beads, transformation_matrix_cpu.data());
   transformation_matrix.copy_from_host(transformation_matrix_cpu.data());
 
+  normal_mode_twiddle.resize(number_of_beads * 2);
+  std::vector<double> normal_mode_twiddle_cpu(number_of_beads * 2);
+  PIMD_Normal_Modes::find_twiddle(number_of_beads, normal_mode_twiddle_cpu.data());
+  normal_mode_twiddle.copy_from_host(normal_mode_twiddle_cpu.data());
+  normal_modes.number_of_beads = number_of_beads;
+  normal_modes.use_fft = PIMD_Normal_Modes::is_fft_faster(number_of_beads);
+  normal_modes.transformation_matrix = transformation_matrix.data();
+  normal_modes.twiddle = normal_mode_twiddle.data();
+
   curand_states.resize(number_of_atoms);
   int grid_size = (number_of_atoms - 1) / 128 + 1;
   initialize_curand_states<<<grid_size, 128>>>(curand_states.data(), number_of_atoms, rand());
@@ -186,7 +178,7 @@ static __global__ void gpu_nve_1(
   const int number_of_beads,
   const double omega_n,
   const double time_step,
-  const double* transformation_matrix,
+  const PIMD_Normal_Modes normal_modes,
   const double* g_mass,
   double** force,
   double** position,
@@ -205,20 +197,16 @@ static __global__ void gpu_nve_1(
 
     double velocity_normal[MAX_NUM_BEADS * 3];
     double position_normal[MAX_NUM_BEADS * 3];
-    for (int k = 0; k < number_of_beads; ++k) {
-      for (int d = 0; d < 3; ++d) {
-        double temp_velocity = 0.0;
-        double temp_position = 0.0;
-        for (int j = 0; j < number_of_beads; ++j) {
-          int index_dn = d * number_of_atoms + n;
-          int index_jk = j * number_of_beads + k;
-          temp_velocity += velocity[j][index_dn] * transformation_matrix[index_jk];
-          temp_position += position[j][index_dn] * transformation_matrix[index_jk];
-        }
-        int index_kd = k * 3 + d;
-        velocity_normal[index_kd] = temp_velocity;
-        position_normal[index_kd] = temp_position;
+    double velocity_bead[MAX_NUM_BEADS];
+    double position_bead[MAX_NUM_BEADS];
+    for (int d = 0; d < 3; ++d) {
+      int index_dn = d * number_of_atoms + n;
+      for (int j = 0; j < number_of_beads; ++j) {
+        velocity_bead[j] = velocity[j][index_dn];
+        position_bead[j] = position[j][index_dn];
       }
+      normal_modes.to_normal_modes(velocity_bead, velocity_normal + d, 3);
+      normal_modes.to_normal_modes(position_bead, position_normal + d, 3);
     }
 
     for (int d = 0; d < 3; ++d) {
@@ -245,19 +233,13 @@ static __global__ void gpu_nve_1(
       }
     }
 
-    for (int j = 0; j < number_of_beads; ++j) {
-      for (int d = 0; d < 3; ++d) {
-        double temp_velocity = 0.0;
-        double temp_position = 0.0;
-        for (int k = 0; k < number_of_beads; ++k) {
-          int index_jk = j * number_of_beads + k;
-          int index_kd = k * 3 + d;
-          temp_velocity += velocity_normal[index_kd] * transformation_matrix[index_jk];
-          temp_position += position_normal[index_kd] * transformation_matrix[index_jk];
-        }
-        int index_dn = d * number_of_atoms + n;
-        velocity[j][index_dn] = temp_velocity;
-        position[j][index_dn] = temp_position;
+    for (int d = 0; d < 3; ++d) {
+      normal_modes.from_normal_modes(velocity_normal + d, 3, velocity_bead);
+      normal_modes.from_normal_modes(position_normal + d, 3, position_bead);
+      int index_dn = d * number_of_atoms + n;
+      for (int j = 0; j < number_of_beads; ++j) {
+        velocity[j][index_dn] = velocity_bead[j];
+        position[j][index_dn] = position_bead[j];
       }
     }
   }
@@ -293,7 +275,7 @@ static __global__ void gpu_langevin(
   const double temperature_coupling,
   const double omega_n,
   const double time_step,
-  const double* transformation_matrix,
+  const PIMD_Normal_Modes normal_modes,
   const double* g_mass,
   double** velocity)
 {
@@ -301,18 +283,14 @@ static __global__ void gpu_langevin(
   if (n < number_of_atoms) {
 
     double velocity_normal[MAX_NUM_BEADS * 3];
+    double velocity_bead[MAX_NUM_BEADS];
 
-    for (int k = 0; k < number_of_beads; ++k) {
-      for (int d = 0; d < 3; ++d) {
-        double temp_velocity = 0.0;
-        for (int j = 0; j < number_of_beads; ++j) {
-          int index_dn = d * number_of_atoms + n;
-          int index_jk = j * number_of_beads + k;
-          temp_velocity += velocity[j][index_dn] * transformation_matrix[index_jk];
-        }
-        int index_kd = k * 3 + d;
-        velocity_normal[index_kd] = temp_velocity;
+    for (int d = 0; d < 3; ++d) {
+      int index_dn = d * number_of_atoms + n;
+      for (int j = 0; j < number_of_beads; ++j) {
+        velocity_bead[j] = velocity[j][index_dn];
       }
+      normal_modes.to_normal_modes(velocity_bead, velocity_normal + d, 3);
     }
 
     curandState state = g_state[n];
@@ -330,16 +308,11 @@ static __global__ void gpu_langevin(
     }
     g_state[n] = state;
 
-    for (int j = 0; j < number_of_beads; ++j) {
-      for (int d = 0; d < 3; ++d) {
-        double temp_velocity = 0.0;
-        for (int k = 0; k < number_of_beads; ++k) {
-          int index_jk = j * number_of_beads + k;
-          int index_kd = k * 3 + d;
-          temp_velocity += velocity_normal[index_kd] * transformation_matrix[index_jk];
-        }
-        int index_dn = d * number_of_atoms + n;
-        velocity[j][index_dn] = temp_velocity;
+    for (int d = 0; d < 3; ++d) {
+      normal_modes.from_normal_modes(velocity_normal + d, 3, velocity_bead);
+      int index_dn = d * number_of_atoms + n;
+      for (int j = 0; j < number_of_beads; ++j) {
+        velocity[j][index_dn] = velocity_bead[j];
       }
     }
   }
@@ -797,7 +770,7 @@ void Ensemble_PIMD::langevin(const double time_step, Atom& atom)
       temperature_coupling,
       omega_n,
       time_step,
-      transformation_matrix.data(),
+      normal_modes,
       atom.mass.data(),
       velocity_beads.data());
     CUDA_CHECK_KERNEL
@@ -832,7 +805,7 @@ void Ensemble_PIMD::compute1(
     number_of_beads,
     omega_n,
     time_step,
-    transformation_matrix.data(),
+    normal_modes,
     atom.mass.data(),
     force_beads.data(),
     position_beads.data(),
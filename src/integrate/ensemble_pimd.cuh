@@ -15,6 +15,7 @@
 
 #pragma once
 #include "ensemble.cuh"
+#include "pimd_normal_modes.cuh"
 #include <curand_kernel.h>
 #include <random>
 #include <vector>
@@ -66,6 +67,8 @@ protected:
   GPU_Vector<double*> force_beads;
   GPU_Vector<double*> virial_beads;
   GPU_Vector<double> transformation_matrix;
+  GPU_Vector<double> normal_mode_twiddle;
+  PIMD_Normal_Modes normal_modes;
   GPU_Vector<double> kinetic_energy_virial_part;
 
   GPU_Vector<double> sum_1024; // for intermidiate summation
@@ -0,0 +1,221 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+The normal-mode transform of a ring polymer with P beads (P even):
+    to_normal_modes:   q_k = sum_j x_j C_jk
+    from_normal_modes: x_j = sum_k C_jk q_k
+with the orthogonal matrix C_jk from find_transformation_matrix. When P is a
+power of two (and not too small), both are evaluated by a real FFT of length P,
+packed into a complex FFT of length P / 2, in O(P log P) operations. Otherwise
+the O(P^2) matrix-vector products are used, which also serve as the reference.
+The functions act on one atom and one direction and can be called from host
+code, from one thread per atom, or from a future bead-parallel layout.
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include "utilities/common.cuh"
+#include "utilities/host_backend.cuh"
+#include <cmath>
+
+struct PIMD_Normal_Modes {
+  int number_of_beads = 0;
+  bool use_fft = false;                          // see is_fft_faster
+  const double* transformation_matrix = nullptr; // C_jk at j * P + k
+  const double* twiddle = nullptr;               // cos(2 pi m / P) at m, sin(2 pi m / P) at P + m
+
+  // C_jk at j * P + k, with the beads numbered from 1 in the phases
+  static void find_transformation_matrix(const int P, double* transformation_matrix)
+  {
+    const double sqrt_factor_1 = sqrt(1.0 / P);
+    const double sqrt_factor_2 = sqrt(2.0 / P);
+    for (int j = 1; j <= P; ++j) {
+      const double sign_factor = (j % 2 == 0) ? 1.0 : -1.0;
+      for (int k = 0; k < P; ++k) {
+        const int jk = (j - 1) * P + k;
+        const double pi_factor = 2.0 * PI * j * k / P;
+        if (k == 0) {
+          transformation_matrix[jk] = sqrt_factor_1;
+        } else if (k < P / 2) {
+          transformation_matrix[jk] = sqrt_factor_2 * cos(pi_factor);
+        } else if (k == P / 2) {
+          transformation_matrix[jk] = sqrt_factor_1 * sign_factor;
+        } else {
+          transformation_matrix[jk] = sqrt_factor_2 * sin(pi_factor);
+        }
+      }
+    }
+  }
+
+  // cos(2 pi m / P) at m and sin(2 pi m / P) at P + m
+  static void find_twiddle(const int P, double* twiddle)
+  {
+    for (int m = 0; m < P; ++m) {
+      twiddle[m] = cos(2.0 * PI * m / P);
+      twiddle[P + m] = sin(2.0 * PI * m / P);
+    }
+  }
+
+  // the FFT needs a power of two and only pays off for a larger number of beads
+  static bool is_fft_faster(const int P) { return P >= 16 && (P & (P - 1)) == 0; }
+
+  // in-place complex FFT of length P / 2: sum_n z[n] exp(-+ 2 pi i n k / (P / 2))
+  __host__ __device__ void fft_half(double* re, double* im, const bool inverse) const
+  {
+    const int P = number_of_beads;
+    const int M = P / 2;
+    for (int i = 1, j = 0; i < M; ++i) {
+      int bit = M >> 1;
+      for (; j & bit; bit >>= 1) {
+        j ^= bit;
+      }
+      j ^= bit;
+      if (i < j) {
+        double temp = re[i];
+        re[i] = re[j];
+        re[j] = temp;
+        temp = im[i];
+        im[i] = im[j];
+        im[j] = temp;
+      }
+    }
+    for (int length = 2; length <= M; length <<= 1) {
+      const int step = P / length; // exp(-2 pi i j / length) = exp(-2 pi i j * step / P)
+      for (int i = 0; i < M; i += length) {
+        for (int j = 0; j < length / 2; ++j) {
+          const double wr = twiddle[j * step];
+          const double wi = inverse ? twiddle[P + j * step] : -twiddle[P + j * step];
+          const int a = i + j;
+          const int b = a + length / 2;
+          const double vr = re[b] * wr - im[b] * wi;
+          const double vi = re[b] * wi + im[b] * wr;
+          re[b] = re[a] - vr;
+          im[b] = im[a] - vi;
+          re[a] += vr;
+          im[a] += vi;
+        }
+      }
+    }
+  }
+
+  // x: P contiguous bead values; q: P normal-mode values with a stride
+  __host__ __device__ void to_normal_modes(const double* x, double* q, const int stride_q) const
+  {
+    const int P = number_of_beads;
+    if (!use_fft) {
+      for (int k = 0; k < P; ++k) {
+        double temp = 0.0;
+        for (int j = 0; j < P; ++j) {
+          temp += x[j] * transformation_matrix[j * P + k];
+        }
+        q[k * stride_q] = temp;
+      }
+      return;
+    }
+
+    // z_m = x_2m + i x_2m+1 and Z = FFT(z)
+    const int M = P / 2;
+    double re[MAX_NUM_BEADS / 2];
+    double im[MAX_NUM_BEADS / 2];
+    for (int m = 0; m < M; ++m) {
+      re[m] = x[2 * m];
+      im[m] = x[2 * m + 1];
+    }
+    fft_half(re, im, false);
+
+    const double sqrt_factor_1 = sqrt(1.0 / P);
+    const double sqrt_factor_2 = sqrt(2.0 / P);
+    for (int k = 0; k <= M; ++k) {
+      const int k1 = (k == M) ? 0 : k;
+      const int k2 = (k == 0) ? 0 : M - k;
+      // even part E_k = (Z_k + Z*_M-k) / 2 and odd part O_k = (Z_k - Z*_M-k) / 2i
+      const double even_re = 0.5 * (re[k1] + re[k2]);
+      const double even_im = 0.5 * (im[k1] - im[k2]);
+      const double odd_re = 0.5 * (im[k1] + im[k2]);
+      const double odd_im = -0.5 * (re[k1] - re[k2]);
+      // X_k = E_k + w^k O_k and Y_k = w^k X_k, with w = exp(-2 pi i / P), as C_jk uses j + 1
+      const double wr = twiddle[k];
+      const double wi = -twiddle[P + k];
+      const double x_re = even_re + wr * odd_re - wi * odd_im;
+      const double x_im = even_im + wr * odd_im + wi * odd_re;
+      const double y_re = wr * x_re - wi * x_im;
+      const double y_im = wr * x_im + wi * x_re;
+      if (k == 0 || k == M) {
+        q[k * stride_q] = sqrt_factor_1 * y_re;
+      } else {
+        q[k * stride_q] = sqrt_factor_2 * y_re;
+        q[(P - k) * stride_q] = sqrt_factor_2 * y_im;
+      }
+    }
+  }
+
+  // the inverse of to_normal_modes
+  __host__ __device__ void from_normal_modes(const double* q, const int stride_q, double* x) const
+  {
+    const int P = number_of_beads;
+    if (!use_fft) {
+      for (int j = 0; j < P; ++j) {
+        double temp = 0.0;
+        for (int k = 0; k < P; ++k) {
+          temp += q[k * stride_q] * transformation_matrix[j * P + k];
+        }
+        x[j] = temp;
+      }
+      return;
+    }
+
+    // Hermitian spectrum X_k (k <= M) with x_j = sum_k X_k exp(2 pi i j k / P),
+    // split into even and odd samples, which form z_m = x_2m + i x_2m+1
+    const int M = P / 2;
+    double re[MAX_NUM_BEADS / 2];
+    double im[MAX_NUM_BEADS / 2];
+    for (int k = 0; k < M; ++k) {
+      double x1_re, x1_im, x2_re, x2_im;
+      find_spectrum(q, stride_q, k, x1_re, x1_im);
+      find_spectrum(q, stride_q, M - k, x2_re, x2_im);
+      const double a_re = x1_re + x2_re;
+      const double a_im = x1_im - x2_im;
+      const double d_re = x1_re - x2_re;
+      const double d_im = x1_im + x2_im;
+      const double b_re = d_re * twiddle[k] - d_im * twiddle[P + k];
+      const double b_im = d_re * twiddle[P + k] + d_im * twiddle[k];
+      re[k] = a_re - b_im;
+      im[k] = a_im + b_re;
+    }
+    fft_half(re, im, true);
+    for (int m = 0; m < M; ++m) {
+      x[2 * m] = re[m];
+      x[2 * m + 1] = im[m];
+    }
+  }
+
+private:
+  // X_k = H_k exp(2 pi i k / P) for k <= P / 2, with H_k the complex amplitude of mode pair k
+  __host__ __device__ void
+  find_spectrum(const double* q, const int stride_q, const int k, double& x_re, double& x_im) const
+  {
+    const int P = number_of_beads;
+    double h_re, h_im;
+    if (k == 0 || k == P / 2) {
+      h_re = q[k * stride_q] * sqrt(1.0 / P);
+      h_im = 0.0;
+    } else {
+      h_re = q[k * stride_q] * sqrt(0.5 / P);
+      h_im = q[(P - k) * stride_q] * sqrt(0.5 / P);
+    }
+    x_re = h_re * twiddle[k] - h_im * twiddle[P + k];
+    x_im = h_re * twiddle[P + k] + h_im * twiddle[k];
+  }
+};
@@ -0,0 +1,58 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Convert the text files of the force constant potential (r0.in, fcs_order*.in,
+and clusters_order*.in) into the binary file fcp.bin in the same folder, which
+is then read by gpumd in place of the text files:
+    fcp2bin path_to_force_constant_files highest_force_order
+------------------------------------------------------------------------------*/
+
+#include "force/read_fcp.cuh"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+  if (argc != 3) {
+    printf("Usage: fcp2bin path_to_force_constant_files highest_force_order\n");
+    return EXIT_FAILURE;
+  }
+  const char* path = argv[1];
+  const int order = atoi(argv[2]);
+  const std::string filename_binary = std::string(path) + "/" + FCP_BINARY_FILE;
+
+  auto time_begin = std::chrono::high_resolution_clock::now();
+  FCP_Input input_text;
+  input_text.read_text(path, order);
+  auto time_finish = std::chrono::high_resolution_clock::now();
+  const std::chrono::duration<double> time_text = time_finish - time_begin;
+
+  input_text.write_binary(filename_binary.c_str());
+  printf("Wrote %s.\n", filename_binary.c_str());
+
+  time_begin = std::chrono::high_resolution_clock::now();
+  FCP_Input input_binary;
+  input_binary.read_binary(filename_binary.c_str(), order);
+  time_finish = std::chrono::high_resolution_clock::now();
+  const std::chrono::duration<double> time_binary = time_finish - time_begin;
+
+  printf("Time used for reading the text files = %f s.\n", time_text.count());
+  printf("Time used for reading %s = %f s.\n", FCP_BINARY_FILE, time_binary.count());
+
+  return EXIT_SUCCESS;
+}
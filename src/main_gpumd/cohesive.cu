@@ -20,14 +20,18 @@ Compute the cohesive energy curve with different deformations.
 #include "cohesive.cuh"
 #include "force/force.cuh"
 #include "minimize/minimize.cuh"
+#include "minimize/minimizer_fire.cuh"
+#include "minimize/minimizer_lbfgs.cuh"
 #include "minimize/minimizer_sd.cuh"
 #include "model/box.cuh"
 #include "model/group.cuh"
 #include "utilities/common.cuh"
 #include "utilities/error.cuh"
 #include "utilities/read_file.cuh"
+#include <cstring>
+#include <memory>
 
-static void __global__ deform_position(
+static void __global__ gpu_deform_position(
   const int N,
   const D cpu_d,
   const double* old_x,
@@ -45,8 +49,7 @@ static void __global__ deform_position(
   }
 }
 
-void Cohesive::deform_box(
-  const int N, const D& cpu_d, Box& old_box, Box& new_box, GPU_Vector<double>& position_per_atom)
+static void deform_box(const D& cpu_d, const Box& old_box, Box& new_box)
 {
   new_box.pbc_x = old_box.pbc_x;
   new_box.pbc_y = old_box.pbc_y;
@@ -72,16 +75,49 @@ void Cohesive::deform_box(
     }
     new_box.get_inverse();
   }
+}
+
+// the deformation from point 1 to point 2: D_12 = D_2 * D_1^{-1}
+static D get_deformation_increment(const D& d1, const D& d2)
+{
+  const double* a = d1.data;
+  double inverse[9] = {
+    a[4] * a[8] - a[5] * a[7],
+    a[2] * a[7] - a[1] * a[8],
+    a[1] * a[5] - a[2] * a[4],
+    a[5] * a[6] - a[3] * a[8],
+    a[0] * a[8] - a[2] * a[6],
+    a[2] * a[3] - a[0] * a[5],
+    a[3] * a[7] - a[4] * a[6],
+    a[1] * a[6] - a[0] * a[7],
+    a[0] * a[4] - a[1] * a[3]};
+  const double det = a[0] * inverse[0] + a[1] * inverse[3] + a[2] * inverse[6];
+  D d12;
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      double tmp = 0.0;
+      for (int k = 0; k < 3; ++k) {
+        tmp += d2.data[r * 3 + k] * inverse[k * 3 + c] / det;
+      }
+      d12.data[r * 3 + c] = tmp;
+    }
+  }
+  return d12;
+}
 
-  deform_position<<<(N - 1) / 128 + 1, 128>>>(
+void Cohesive::deform_position(
+  const int N, const D& cpu_d, const GPU_Vector<double>& old_position_per_atom)
+{
+  gpu_deform_position<<<(N - 1) / 128 + 1, 128>>>(
     N,
     cpu_d,
-    position_per_atom.data(),
-    position_per_atom.data() + N,
-    position_per_atom.data() + N * 2,
+    old_position_per_atom.data(),
+    old_position_per_atom.data() + N,
+    old_position_per_atom.data() + N * 2,
     new_position_per_atom.data(),
     new_position_per_atom.data() + N,
     new_position_per_atom.data() + N * 2);
+  CUDA_CHECK_KERNEL
 }
 
 void Cohesive::parse(const char** param, int num_param, int type)
@@ -96,8 +132,8 @@ void Cohesive::parse(const char** param, int num_param, int type)
 void Cohesive::parse_cohesive(const char** param, int num_param)
 {
   printf("Compute cohesive energy.\n");
-  if (num_param != 4) {
-    PRINT_INPUT_ERROR("compute_cohesive should have 3 parameters.\n");
+  if (num_param != 4 && num_param != 5) {
+    PRINT_INPUT_ERROR("compute_cohesive should have 3 or 4 parameters.\n");
   }
 
   if (!is_valid_real(param[1], &start_factor)) {
@@ -126,13 +162,17 @@ void Cohesive::parse_cohesive(const char** param, int num_param)
 
   delta_factor = (end_factor - start_factor) / (num_points - 1);
   deformation_type = 0; // deformation for cohesive
+
+  if (num_param == 5) {
+    parse_minimizer(param[4]);
+  }
 }
 
 void Cohesive::parse_elastic(const char** param, int num_param)
 {
   printf("Compute elastic constants.\n");
-  if (num_param != 3) {
-    PRINT_INPUT_ERROR("compute_elastic should have 2 parameters.\n");
+  if (num_param != 3 && num_param != 4) {
+    PRINT_INPUT_ERROR("compute_elastic should have 2 or 3 parameters.\n");
   }
 
   if (!is_valid_real(param[1], &strain)) {
@@ -152,6 +192,26 @@ void Cohesive::parse_elastic(const char** param, int num_param)
   } else {
     PRINT_INPUT_ERROR("Invalid crystal type.");
   }
+
+  if (num_param == 4) {
+    parse_minimizer(param[3]);
+  }
+}
+
+void Cohesive::parse_minimizer(const char* param)
+{
+  if (strcmp(param, "sd") == 0) {
+    minimizer_type = 0;
+    printf("    using the steepest descent minimizer.\n");
+  } else if (strcmp(param, "fire") == 0) {
+    minimizer_type = 1;
+    printf("    using the FIRE minimizer.\n");
+  } else if (strcmp(param, "lbfgs") == 0) {
+    minimizer_type = 2;
+    printf("    using the L-BFGS minimizer.\n");
+  } else {
+    PRINT_INPUT_ERROR("The minimizer should be sd, fire or lbfgs.\n");
+  }
 }
 
 void Cohesive::allocate_memory(const int num_atoms)
@@ -160,6 +220,7 @@ void Cohesive::allocate_memory(const int num_atoms)
   cpu_potential_total.resize(num_points);
   cpu_potential_per_atom.resize(num_atoms);
   new_position_per_atom.resize(num_atoms * 3);
+  relaxed_position_per_atom.resize(num_atoms * 3);
 }
 
 void Cohesive::compute_D()
@@ -247,12 +308,35 @@ void Cohesive::compute(
   allocate_memory(num_atoms);
   compute_D();
 
+  // one minimizer (and its buffers) for the whole sweep
+  std::unique_ptr<Minimizer> minimizer;
+  if (minimizer_type == 0) {
+    minimizer.reset(new Minimizer_SD(num_atoms, 1000, 1.0e-5));
+  } else if (minimizer_type == 1) {
+    minimizer.reset(new Minimizer_FIRE(num_atoms, 1000, 1.0e-5));
+  } else {
+    minimizer.reset(new Minimizer_LBFGS(num_atoms, 1000, 1.0e-5, 10));
+  }
+
+  // The cohesive points form a path, and each point starts from the relaxed positions of the
+  // previous one. The elastic points are strains of the first (unstrained) point, and they all
+  // start from its relaxed positions. The relaxed positions are mapped by the deformation
+  // increment, such that the internal relaxations are kept.
   for (int n = 0; n < num_points; ++n) {
     Box new_box;
-    deform_box(num_atoms, cpu_D[n], box, new_box, position_per_atom);
+    deform_box(cpu_D[n], box, new_box);
+    if (n == 0) {
+      deform_position(num_atoms, cpu_D[n], position_per_atom);
+    } else {
+      const int reference = (deformation_type == 0) ? n - 1 : 0;
+      deform_position(
+        num_atoms,
+        get_deformation_increment(cpu_D[reference], cpu_D[n]),
+        relaxed_position_per_atom);
+    }
 
-    Minimizer_SD minimizer(num_atoms, 1000, 1.0e-5);
-    minimizer.compute(
+    const int number_of_force_evaluations = minimizer->get_number_of_force_evaluations();
+    minimizer->compute(
       force,
       new_box,
       new_position_per_atom,
@@ -261,6 +345,14 @@ void Cohesive::compute(
       potential_per_atom,
       force_per_atom,
       virial_per_atom);
+    printf(
+      "    point %d: %d force evaluations.\n",
+      n,
+      minimizer->get_number_of_force_evaluations() - number_of_force_evaluations);
+
+    if (deformation_type == 0 || n == 0) {
+      new_position_per_atom.copy_to_device(relaxed_position_per_atom.data());
+    }
 
     potential_per_atom.copy_to_host(cpu_potential_per_atom.data());
     cpu_potential_total[n] = 0.0;
@@ -269,5 +361,10 @@ void Cohesive::compute(
     }
   }
 
+  printf(
+    "Total number of force evaluations for %d points = %d.\n",
+    num_points,
+    minimizer->get_number_of_force_evaluations());
+
   output(box);
 }
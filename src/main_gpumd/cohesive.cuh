@@ -42,20 +42,23 @@ public:
 private:
   void parse_cohesive(const char** param, int num_param);
   void parse_elastic(const char** param, int num_param);
+  void parse_minimizer(const char* param);
   void allocate_memory(const int num_atoms);
   void compute_D();
   void output(Box& box);
-  void deform_box(
-    const int N, const D& cpu_d, Box& old_box, Box& new_box, GPU_Vector<double>& position_per_atom);
+  void deform_position(
+    const int N, const D& cpu_d, const GPU_Vector<double>& old_position_per_atom);
   std::vector<double> cpu_potential_total;
   std::vector<double> cpu_potential_per_atom;
   std::vector<D> cpu_D;
   GPU_Vector<double> new_position_per_atom;
+  GPU_Vector<double> relaxed_position_per_atom; // of the point the next point starts from
   double strain;
   double start_factor;
   double end_factor;
   double delta_factor;
   int num_points;
+  int minimizer_type = 0; // 0 = SD, 1 = FIRE, 2 = L-BFGS
   int deformation_type; // 0-7 = cohesive, cubic, hexagonal, trigonal, tetragonal, orthorhombic,
                         // monoclinic, triclinic
 };
@@ -0,0 +1,142 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Recompute a grouping method during a run: the box is divided into as many bins
+of equal width along one direction as there are groups in the grouping method,
+and each atom is put into the group of the bin it is currently in.
+------------------------------------------------------------------------------*/
+
+#include "integrate/integrate.cuh"
+#include "measure/measure.cuh"
+#include "model/atom.cuh"
+#include "model/box.cuh"
+#include "model/group.cuh"
+#include "regroup.cuh"
+#include "utilities/error.cuh"
+#include "utilities/read_file.cuh"
+#include <cstring>
+
+static __global__ void gpu_find_bin_label(
+  const int N,
+  const Box box,
+  const int direction,
+  const int num_bins,
+  const double* g_x,
+  const double* g_y,
+  const double* g_z,
+  int* g_label)
+{
+  const int n = blockIdx.x * blockDim.x + threadIdx.x;
+  if (n < N) {
+    g_label[n] = find_bin_label(box, direction, num_bins, g_x[n], g_y[n], g_z[n]);
+  }
+}
+
+void Regroup::parse(const char** param, int num_param, const std::vector<Group>& group)
+{
+  printf("Regroup atoms during the run.\n");
+  if (num_param != 4) {
+    PRINT_INPUT_ERROR("regroup should have 3 parameters.\n");
+  }
+
+  if (!is_valid_int(param[1], &grouping_method)) {
+    PRINT_INPUT_ERROR("grouping method for regroup should be an integer.\n");
+  }
+  if (grouping_method < 0 || grouping_method >= int(group.size())) {
+    PRINT_INPUT_ERROR("grouping method for regroup is out of range.\n");
+  }
+  printf("    grouping method = %d (%d groups).\n", grouping_method, group[grouping_method].number);
+
+  if (strcmp(param[2], "x") == 0) {
+    direction = 0;
+  } else if (strcmp(param[2], "y") == 0) {
+    direction = 1;
+  } else if (strcmp(param[2], "z") == 0) {
+    direction = 2;
+  } else {
+    PRINT_INPUT_ERROR("direction for regroup should be x or y or z.\n");
+  }
+  printf("    bins along the %s direction.\n", param[2]);
+
+  if (!is_valid_int(param[3], &interval)) {
+    PRINT_INPUT_ERROR("interval for regroup should be an integer.\n");
+  }
+  if (interval <= 0) {
+    PRINT_INPUT_ERROR("interval for regroup should be positive.\n");
+  }
+  printf("    regroup every %d steps.\n", interval);
+
+  do_regroup = true;
+}
+
+// The keywords below keep per-atom data of the atoms of a group from the beginning of a run (or
+// from the beginning of a correlation) and thus cannot follow a group whose atoms change:
+//   compute_shc, compute_msd, compute_sdc and compute_dos correlate the velocities or positions
+//   of the same atoms at different times, in buffers sized by the group sizes at preprocess;
+//   heat_lan, fix and move (grouping method 0) keep the group sizes or the atoms they act on.
+void Regroup::check(const Measure& measure, const Integrate& integrate)
+{
+  if (!do_regroup) {
+    return;
+  }
+  if (measure.shc.compute && measure.shc.group_method == grouping_method) {
+    PRINT_INPUT_ERROR("compute_shc cannot use a grouping method changed by regroup.\n");
+  }
+  if (measure.msd.compute_ && measure.msd.grouping_method_ == grouping_method) {
+    PRINT_INPUT_ERROR("compute_msd cannot use a grouping method changed by regroup.\n");
+  }
+  if (measure.sdc.compute_ && measure.sdc.grouping_method_ == grouping_method) {
+    PRINT_INPUT_ERROR("compute_sdc cannot use a grouping method changed by regroup.\n");
+  }
+  if (measure.dos.compute_ && measure.dos.grouping_method_ == grouping_method) {
+    PRINT_INPUT_ERROR("compute_dos cannot use a grouping method changed by regroup.\n");
+  }
+  if (grouping_method == 0) {
+    if (integrate.type == 22) {
+      PRINT_INPUT_ERROR("heat_lan cannot be used with regroup for grouping method 0.\n");
+    }
+    if (integrate.fixed_group >= 0) {
+      PRINT_INPUT_ERROR("fix cannot be used with regroup for grouping method 0.\n");
+    }
+    if (integrate.move_group >= 0) {
+      PRINT_INPUT_ERROR("move cannot be used with regroup for grouping method 0.\n");
+    }
+  }
+}
+
+void Regroup::compute(const int step, const Box& box, const Atom& atom, std::vector<Group>& group)
+{
+  if (!do_regroup || (step + 1) % interval != 0) {
+    return;
+  }
+
+  const int N = atom.number_of_atoms;
+  Group& g = group[grouping_method];
+  gpu_find_bin_label<<<(N - 1) / 128 + 1, 128>>>(
+    N,
+    box,
+    direction,
+    g.number,
+    atom.position_per_atom.data(),
+    atom.position_per_atom.data() + N,
+    atom.position_per_atom.data() + N * 2,
+    g.label.data());
+  CUDA_CHECK_KERNEL
+
+  g.update_from_label(N);
+}
+
+void Regroup::finalize() { do_regroup = false; }
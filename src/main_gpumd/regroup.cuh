@@ -0,0 +1,67 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "model/box.cuh"
+#include "utilities/gpu_vector.cuh"
+#include <vector>
+
+class Atom;
+class Group;
+class Integrate;
+class Measure;
+
+class Regroup
+{
+public:
+  bool do_regroup = false;
+  void parse(const char** param, int num_param, const std::vector<Group>& group);
+  void check(const Measure& measure, const Integrate& integrate);
+  void compute(const int step, const Box& box, const Atom& atom, std::vector<Group>& group);
+  void finalize();
+
+private:
+  int grouping_method = 0;
+  int direction = 0; // 0 = x, 1 = y, 2 = z
+  int interval = 1;  // regroup every this many steps
+};
+
+// the bin of a position among num_bins bins of equal width along a box direction: the fractional
+// coordinate is wrapped into [0, 1) for a periodic direction and clamped to the first and last
+// bins otherwise
+inline __host__ __device__ int find_bin_label(
+  const Box& box,
+  const int direction,
+  const int num_bins,
+  const double x,
+  const double y,
+  const double z)
+{
+  double s;
+  if (box.triclinic == 0) {
+    const double r[3] = {x, y, z};
+    s = r[direction] * box.cpu_h[9 + direction];
+  } else {
+    s = box.cpu_h[9 + direction * 3] * x + box.cpu_h[10 + direction * 3] * y +
+        box.cpu_h[11 + direction * 3] * z;
+  }
+  const int pbc = (direction == 0) ? box.pbc_x : ((direction == 1) ? box.pbc_y : box.pbc_z);
+  if (pbc) {
+    s -= floor(s);
+  }
+  const int bin = int(floor(s * num_bins));
+  return (bin < 0) ? 0 : ((bin >= num_bins) ? num_bins - 1 : bin);
+}
@@ -32,6 +32,7 @@ Run simulation according to the inputs in the run.in file.
 #include "utilities/error.cuh"
 #include "utilities/read_file.cuh"
 #include "velocity.cuh"
+#include <chrono>
 
 static __global__ void gpu_find_largest_v2(
   int N, int number_of_rounds, double* g_vx, double* g_vy, double* g_vz, double* g_v2_max)
@@ -161,6 +162,7 @@ void Run::perform_a_run()
   integrate.initialize(time_step, atom, box, group, thermo, number_of_steps);
   mc.initialize();
   measure.initialize(number_of_steps, time_step, integrate, group, atom, box, force);
+  regroup.check(measure, integrate);
 
 #ifdef USE_PLUMED
   if (measure.plmd.use_plumed == 1) {
@@ -168,7 +170,7 @@ void Run::perform_a_run()
   }
 #endif
 
-  clock_t time_begin = clock();
+  const auto time_begin = std::chrono::steady_clock::now();
 
   // compute force for the first integrate step
   if (integrate.type >= 31) { // PIMD
@@ -199,75 +201,110 @@ void Run::perform_a_run()
 
   double initial_time_step = time_step;
 
+  stage_timer.start_run();
+
   for (int step = 0; step < number_of_steps; ++step) {
 
-    calculate_time_step(
-      max_distance_per_step, atom.velocity_per_atom, initial_time_step, time_step);
+    stage_timer.start_step(step);
+
+    {
+      Scoped_Stage stage(stage_timer, "time_step");
+      calculate_time_step(
+        max_distance_per_step, atom.velocity_per_atom, initial_time_step, time_step);
+    }
     global_time += time_step;
 
     integrate.current_step = step;
-    integrate.compute1(time_step, double(step) / number_of_steps, group, box, atom, thermo);
+    {
+      Scoped_Stage stage(stage_timer, "integrate.compute1");
+      integrate.compute1(time_step, double(step) / number_of_steps, group, box, atom, thermo);
+    }
 
-    if (integrate.type >= 31) { // PIMD
-      for (int k = 0; k < integrate.number_of_beads; ++k) {
+    {
+      Scoped_Stage stage(stage_timer, "force");
+      if (integrate.type >= 31) { // PIMD
+        for (int k = 0; k < integrate.number_of_beads; ++k) {
+          force.compute(
+            box,
+            atom.position_beads[k],
+            atom.type,
+            group,
+            atom.potential_beads[k],
+            atom.force_beads[k],
+            atom.virial_beads[k],
+            atom.velocity_beads[k],
+            atom.mass);
+        }
+      } else {
         force.compute(
           box,
-          atom.position_beads[k],
+          atom.position_per_atom,
           atom.type,
           group,
-          atom.potential_beads[k],
-          atom.force_beads[k],
-          atom.virial_beads[k],
-          atom.velocity_beads[k],
+          atom.potential_per_atom,
+          atom.force_per_atom,
+          atom.virial_per_atom,
+          atom.velocity_per_atom,
           atom.mass);
       }
-    } else {
-      force.compute(
-        box,
-        atom.position_per_atom,
-        atom.type,
-        group,
-        atom.potential_per_atom,
-        atom.force_per_atom,
-        atom.virial_per_atom,
-        atom.velocity_per_atom,
-        atom.mass);
     }
 
 #ifdef USE_PLUMED
     if (measure.plmd.use_plumed == 1 && (step % measure.plmd.interval) == 0) {
+      Scoped_Stage stage(stage_timer, "plumed");
       measure.plmd.process(
         box, thermo, atom.position_per_atom, atom.force_per_atom, atom.virial_per_atom);
     }
 #endif
 
-    electron_stop.compute(time_step, atom);
+    {
+      Scoped_Stage stage(stage_timer, "electron_stop");
+      electron_stop.compute(time_step, atom);
+    }
+
+    {
+      Scoped_Stage stage(stage_timer, "integrate.compute2");
+      integrate.compute2(time_step, double(step) / number_of_steps, group, box, atom, thermo);
+    }
 
-    integrate.compute2(time_step, double(step) / number_of_steps, group, box, atom, thermo);
+    {
+      Scoped_Stage stage(stage_timer, "mc");
+      mc.compute(step, number_of_steps, atom, box, group);
+    }
 
-    mc.compute(step, number_of_steps, atom, box, group);
+    {
+      Scoped_Stage stage(stage_timer, "regroup");
+      regroup.compute(step, box, atom, group);
+    }
 
-    measure.process(
-      number_of_steps,
-      step,
-      integrate.fixed_group,
-      integrate.move_group,
-      global_time,
-      integrate.temperature2,
-      integrate,
-      box,
-      group,
-      thermo,
-      atom,
-      force);
+    {
+      Scoped_Stage stage(stage_timer, "measure");
+      measure.process(
+        number_of_steps,
+        step,
+        integrate.fixed_group,
+        integrate.move_group,
+        global_time,
+        integrate.temperature2,
+        integrate,
+        box,
+        group,
+        thermo,
+        atom,
+        force,
+        stage_timer);
+    }
 
-    velocity.correct_velocity(
-      step,
-      atom.cpu_mass,
-      atom.position_per_atom,
-      atom.cpu_position_per_atom,
-      atom.cpu_velocity_per_atom,
-      atom.velocity_per_atom);
+    {
+      Scoped_Stage stage(stage_timer, "correct_velocity");
+      velocity.correct_velocity(
+        step,
+        atom.cpu_mass,
+        atom.position_per_atom,
+        atom.cpu_position_per_atom,
+        atom.cpu_velocity_per_atom,
+        atom.velocity_per_atom);
+    }
 
     int base = (10 <= number_of_steps) ? (number_of_steps / 10) : 1;
     if (0 == (step + 1) % base) {
@@ -276,9 +313,12 @@ void Run::perform_a_run()
     }
   }
 
+  stage_timer.finish_run(number_of_steps, atom.number_of_atoms);
+
   print_line_1();
-  clock_t time_finish = clock();
-  double time_used = (time_finish - time_begin) / (double)CLOCKS_PER_SEC;
+  CHECK(cudaDeviceSynchronize());
+  const auto time_finish = std::chrono::steady_clock::now();
+  double time_used = std::chrono::duration<double>(time_finish - time_begin).count();
 
   printf("Time used for this run = %g second.\n", time_used);
   double run_speed = atom.number_of_atoms * (number_of_steps / time_used);
@@ -296,6 +336,7 @@ void Run::perform_a_run()
     atom.number_of_beads);
 
   electron_stop.finalize();
+  regroup.finalize();
   integrate.finalize();
   mc.finalize();
   velocity.finalize();
@@ -402,6 +443,10 @@ void Run::parse_one_keyword(std::vector<std::string>& tokens)
     measure.dump_force.parse(param, num_param, group);
   } else if (strcmp(param[0], "dump_exyz") == 0) {
     measure.dump_exyz.parse(param, num_param);
+  } else if (strcmp(param[0], "dump_compressed") == 0) {
+    measure.dump_compressed.parse(param, num_param);
+  } else if (strcmp(param[0], "dump_async") == 0) {
+    measure.parse_dump_async(param, num_param);
   } else if (strcmp(param[0], "dump_beads") == 0) {
     measure.dump_beads.parse(param, num_param);
   } else if (strcmp(param[0], "dump_observer") == 0) {
@@ -446,12 +491,16 @@ void Run::parse_one_keyword(std::vector<std::string>& tokens)
     integrate.parse_move(param, num_param, group);
   } else if (strcmp(param[0], "electron_stop") == 0) {
     electron_stop.parse(param, num_param, atom.number_of_atoms, number_of_types);
+  } else if (strcmp(param[0], "regroup") == 0) {
+    regroup.parse(param, num_param, group);
   } else if (strcmp(param[0], "mc") == 0) {
     mc.parse_mc(param, num_param, group, atom);
   } else if (strcmp(param[0], "dftd3") == 0) {
     // nothing here; will be handled elsewhere
   } else if (strcmp(param[0], "compute_lsqt") == 0) {
     measure.lsqt.parse(param, num_param);
+  } else if (strcmp(param[0], "timing") == 0) {
+    stage_timer.parse(param, num_param);
   } else if (strcmp(param[0], "run") == 0) {
     parse_run(param, num_param);
   } else {
@@ -27,8 +27,10 @@ class Measure;
 #include "model/atom.cuh"
 #include "model/box.cuh"
 #include "model/group.cuh"
+#include "regroup.cuh"
 #include "utilities/common.cuh"
 #include "utilities/gpu_vector.cuh"
+#include "utilities/stage_timer.cuh"
 #include "velocity.cuh"
 #include <vector>
 
@@ -68,4 +70,6 @@ private:
   MC mc;
   Measure measure;
   Electron_Stop electron_stop;
+  Regroup regroup;
+  Stage_Timer stage_timer;
 };
@@ -0,0 +1,60 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Layout of the binary training checkpoint (nep.checkpoint):
+    Checkpoint_Header
+    mu[number_of_variables]
+    sigma[number_of_variables]
+    q_scaler[num_devices * dim]
+    evolution_path[number_of_variables] (for the adaptive population size)
+    curand states[num_rng_states] (raw bytes, size_of_rng_state each)
+    for importance mixing (sampling == 2) only:
+        population_old[population_size * number_of_variables]
+        loss_old[population_size * 3 * (num_types + 1)]
+        mu_old[number_of_variables]
+        sigma_old[number_of_variables]
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cstring>
+
+const char CHECKPOINT_FILE[] = "nep.checkpoint";
+const char CHECKPOINT_MAGIC[8] = "NEPCKPT";
+const int CHECKPOINT_VERSION = 2;
+
+struct Checkpoint_Header {
+  char magic[8];                    // CHECKPOINT_MAGIC
+  int version = CHECKPOINT_VERSION; // format version
+  int number_of_variables = 0;      // should match the current nep.in
+  int population_size = 0;          // should match the current nep.in
+  int dim = 0;                      // should match the current nep.in
+  int num_devices = 0;              // number of GPUs, each of which has its own q_scaler
+  int generation = 0;               // the next generation to be computed
+  int population_active = 0;        // current population size (adaptive population size)
+  float population_real = 0.0f;     // unrounded population size (adaptive population size)
+  long long num_evaluations = 0;    // number of fitness evaluations so far
+  unsigned int shuffle_seed = 0;    // seed used for shuffling the structures in train.xyz
+  int size_of_rng_state = 0;        // sizeof(curandState)
+  int num_rng_states = 0;           // number of curand states
+  int sampling = 0;                 // 2 if the importance-mixing state follows
+  int num_old = 0;                  // number of evaluated individuals of the last generation
+
+  Checkpoint_Header() { memcpy(magic, CHECKPOINT_MAGIC, sizeof(magic)); }
+  bool is_valid() const
+  {
+    return memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) == 0 && version == CHECKPOINT_VERSION;
+  }
+};
@@ -19,6 +19,34 @@
 #include <vector>
 class Parameters;
 
+// Host copy of the neighbor lists of a dataset. The training structures never
+// move, so the lists only need to be built once and can then be restaged.
+struct Neighbor_Cache {
+  bool is_filled = false;
+  std::vector<int> NN_radial;             // radial neighbor number
+  std::vector<int> NN_angular;            // angular neighbor number
+  std::vector<unsigned short> NL_radial;  // radial neighbor index within its configuration
+  std::vector<unsigned short> NL_angular; // angular neighbor index within its configuration
+  std::vector<float> r12_radial;          // x12, y12, z12 of each radial neighbor
+  std::vector<float> r12_angular;         // x12, y12, z12 of each angular neighbor
+  size_t memory() const
+  {
+    return (NN_radial.size() + NN_angular.size()) * sizeof(int) +
+           (NL_radial.size() + NL_angular.size()) * sizeof(unsigned short) +
+           (r12_radial.size() + r12_angular.size()) * sizeof(float);
+  }
+  void clear()
+  {
+    is_filled = false;
+    std::vector<int>().swap(NN_radial);
+    std::vector<int>().swap(NN_angular);
+    std::vector<unsigned short>().swap(NL_radial);
+    std::vector<unsigned short>().swap(NL_angular);
+    std::vector<float>().swap(r12_radial);
+    std::vector<float>().swap(r12_angular);
+  }
+};
+
 class Dataset
 {
 public:
@@ -65,6 +93,8 @@ public:
 
   std::vector<Structure> structures;
 
+  Neighbor_Cache neighbor_cache; // only used for the dataset in the first device
+
   void
   construct(Parameters& para, std::vector<Structure>& structures, int n1, int n2, int device_id);
   std::vector<float> get_rmse_force(Parameters& para, const bool use_weight, int device_id);
@@ -46,6 +46,9 @@ Fitness::Fitness(Parameters& para)
   if (batch_size_old != para.batch_size) {
     printf("Hello, I changed the batch_size from %d to %d.\n", batch_size_old, para.batch_size);
   }
+  if (para.prediction == 0 && para.sampling == 2 && num_batches > 1 && !para.use_full_batch) {
+    PRINT_INPUT_ERROR("Importance mixing needs a single batch or an effective full-batch.");
+  }
 
   train_set.resize(num_batches);
   for (int batch_id = 0; batch_id < num_batches; ++batch_id) {
@@ -125,11 +128,15 @@ Fitness::~Fitness()
 }
 
 void Fitness::compute(
-  const int generation, Parameters& para, const float* population, float* fitness)
+  const int generation,
+  Parameters& para,
+  const int num_individuals,
+  const float* population,
+  float* fitness)
 {
   int deviceCount;
   CHECK(cudaGetDeviceCount(&deviceCount));
-  int population_iter = (para.population_size - 1) / deviceCount + 1;
+  int population_iter = (num_individuals - 1) / deviceCount + 1;
 
   if (generation == 0) {
     std::vector<float> dummy_solution(para.number_of_variables * deviceCount, 1.0f);
@@ -146,6 +153,7 @@ void Fitness::compute(
         true, 
         deviceCount);
     }
+    report_neighbor_cache();
   } else {
     int batch_id = generation % num_batches;
     bool calculate_neighbor = (num_batches > 1) || (generation % 100 == 0);
@@ -216,6 +224,27 @@ void Fitness::compute(
   }
 }
 
+void Fitness::report_neighbor_cache()
+{
+  int num_cached_batches = 0;
+  size_t memory = 0;
+  for (int n = 0; n < num_batches; ++n) {
+    if (train_set[n][0].neighbor_cache.is_filled) {
+      ++num_cached_batches;
+      memory += train_set[n][0].neighbor_cache.memory();
+    }
+  }
+  printf(
+    "Neighbor lists of %d out of %d batches are cached in host memory (%g MB).\n",
+    num_cached_batches,
+    num_batches,
+    memory / (1024.0 * 1024.0));
+  if (num_cached_batches < num_batches) {
+    printf("    The other batches will have their neighbor lists rebuilt when needed.\n");
+  }
+  fflush(stdout);
+}
+
 void Fitness::output(
   bool is_stress,
   int num_components, 
@@ -28,7 +28,13 @@ class Fitness
 public:
   Fitness(Parameters& para);
   ~Fitness();
-  void compute(const int generation, Parameters& para, const float*, float*);
+  // evaluate the first num_individuals individuals (rounded up to a multiple of the GPU number)
+  void compute(
+    const int generation,
+    Parameters& para,
+    const int num_individuals,
+    const float* population,
+    float* fitness);
   void report_error(
     Parameters& para,
     const int generation,
@@ -47,6 +53,7 @@ protected:
   std::unique_ptr<Potential> potential;
   std::vector<std::vector<Dataset>> train_set;
   std::vector<Dataset> test_set;
+  void report_neighbor_cache();
   void output(
     bool is_stress, 
     int num_components, 
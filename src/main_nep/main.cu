@@ -13,28 +13,67 @@
     along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#ifndef USE_HOST_BACKEND
 #include "fitness.cuh"
-#include "parameters.cuh"
 #include "snes.cuh"
+#endif
+#include "nep3_cpu.cuh"
+#include "parameters.cuh"
+#include "structure.cuh"
 #include "utilities/error.cuh"
 #include "utilities/main_common.cuh"
+#include <chrono>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#include <vector>
 
 void print_welcome_information(void);
+void train_or_predict_on_gpu(Parameters& para);
+void predict_on_cpu(Parameters& para);
 
 int main(int argc, char* argv[])
 {
   print_welcome_information();
-  print_gpu_information();
 
   print_line_1();
   printf("Started running nep.\n");
   print_line_2();
 
-  clock_t time_begin = clock();
   Parameters para;
+  if (para.prediction == 2) {
+    predict_on_cpu(para);
+  } else {
+    train_or_predict_on_gpu(para);
+  }
+
+  print_line_1();
+  printf("Finished running nep.\n");
+  print_line_2();
+
+  return EXIT_SUCCESS;
+}
+
+void print_welcome_information(void)
+{
+  printf("\n");
+  printf("***************************************************************\n");
+  printf("*                 Welcome to use GPUMD                        *\n");
+  printf("*    (Graphics Processing Units Molecular Dynamics)           *\n");
+  printf("*                    Version 3.9.4                            *\n");
+  printf("*              This is the nep executable                     *\n");
+  printf("***************************************************************\n");
+  printf("\n");
+}
+
+void train_or_predict_on_gpu(Parameters& para)
+{
+#ifdef USE_HOST_BACKEND
+  PRINT_INPUT_ERROR("This nep executable is built without CUDA and only supports prediction 2.");
+#else
+  print_gpu_information();
+
+  clock_t time_begin = clock();
   Fitness fitness(para);
   clock_t time_finish = clock();
 
@@ -54,24 +93,29 @@ int main(int argc, char* argv[])
   } else {
     printf("Time used for predicting = %f s.\n", time_used);
   }
-
   print_line_2();
+#endif
+}
+
+void predict_on_cpu(Parameters& para)
+{
+  // clock() would sum up the time of all the OpenMP threads
+  const auto time_begin = std::chrono::steady_clock::now();
+
+  std::vector<Structure> structures;
+  read_structures(true, para, structures);
+  std::vector<float> parameters(para.number_of_variables);
+  para.read_nep_txt(parameters.data());
 
   print_line_1();
-  printf("Finished running nep.\n");
+  printf("Started predicting on the CPU.\n");
   print_line_2();
 
-  return EXIT_SUCCESS;
-}
+  NEP3_CPU potential(para);
+  potential.predict(para, parameters.data(), structures);
 
-void print_welcome_information(void)
-{
-  printf("\n");
-  printf("***************************************************************\n");
-  printf("*                 Welcome to use GPUMD                        *\n");
-  printf("*    (Graphics Processing Units Molecular Dynamics)           *\n");
-  printf("*                    Version 3.9.4                            *\n");
-  printf("*              This is the nep executable                     *\n");
-  printf("***************************************************************\n");
-  printf("\n");
+  const std::chrono::duration<float> time_used = std::chrono::steady_clock::now() - time_begin;
+  print_line_1();
+  printf("Time used for predicting = %f s.\n", time_used.count());
+  print_line_2();
 }
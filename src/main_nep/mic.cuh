@@ -17,7 +17,11 @@
 mininum image convention
 ------------------------------------------------------------------------------*/
 
-static __device__ void
+#pragma once
+#include "utilities/host_backend.cuh"
+#include <cmath>
+
+static __host__ __device__ void
 dev_apply_mic(const float* __restrict__ h, float& x12, float& y12, float& z12)
 {
   float sx12 = h[9] * x12 + h[10] * y12 + h[11] * z12;
@@ -298,6 +298,7 @@ NEP3::NEP3(
     nep_data[device_id].Fp.resize(N * annmb[device_id].dim);
     nep_data[device_id].sum_fxyz.resize(N * (paramb.n_max_angular + 1) * NUM_OF_ABC);
     nep_data[device_id].parameters.resize(annmb[device_id].num_para);
+    staged_dataset[device_id] = nullptr;
   }
 }
 
@@ -828,6 +829,187 @@ static __global__ void find_force_ZBL(
   }
 }
 
+static void download_neighbor_list(
+  const int N,
+  const int max_NN,
+  const std::vector<int>& Na_cpu,
+  const std::vector<int>& Na_sum_cpu,
+  const std::vector<int>& NN,
+  GPU_Vector<int>& NL_gpu,
+  GPU_Vector<float>& x12_gpu,
+  GPU_Vector<float>& y12_gpu,
+  GPU_Vector<float>& z12_gpu,
+  std::vector<int>& NL_cpu,
+  std::vector<float>& r12_cpu,
+  std::vector<unsigned short>& NL,
+  std::vector<float>& r12)
+{
+  const int size = N * max_NN;
+  NL_cpu.resize(size);
+  r12_cpu.resize(size * 3);
+  NL_gpu.copy_to_host(NL_cpu.data(), size);
+  x12_gpu.copy_to_host(r12_cpu.data(), size);
+  y12_gpu.copy_to_host(r12_cpu.data() + size, size);
+  z12_gpu.copy_to_host(r12_cpu.data() + size * 2, size);
+
+  // neighbors are stored contiguously, with indices relative to the first atom of the configuration
+  int count = 0;
+  for (int nc = 0; nc < Na_cpu.size(); ++nc) {
+    for (int n1 = Na_sum_cpu[nc]; n1 < Na_sum_cpu[nc] + Na_cpu[nc]; ++n1) {
+      for (int k = 0; k < NN[n1]; ++k) {
+        const int index = k * N + n1;
+        NL[count] = NL_cpu[index] - Na_sum_cpu[nc];
+        r12[count * 3 + 0] = r12_cpu[index];
+        r12[count * 3 + 1] = r12_cpu[index + size];
+        r12[count * 3 + 2] = r12_cpu[index + size * 2];
+        ++count;
+      }
+    }
+  }
+}
+
+static void upload_neighbor_list(
+  const int N,
+  const int max_NN,
+  const std::vector<int>& Na_cpu,
+  const std::vector<int>& Na_sum_cpu,
+  const std::vector<int>& NN,
+  const std::vector<unsigned short>& NL,
+  const std::vector<float>& r12,
+  std::vector<int>& NL_cpu,
+  std::vector<float>& r12_cpu,
+  GPU_Vector<int>& NN_gpu,
+  GPU_Vector<int>& NL_gpu,
+  GPU_Vector<float>& x12_gpu,
+  GPU_Vector<float>& y12_gpu,
+  GPU_Vector<float>& z12_gpu)
+{
+  const int size = N * max_NN;
+  NL_cpu.resize(size);
+  r12_cpu.resize(size * 3);
+
+  int count = 0;
+  for (int nc = 0; nc < Na_cpu.size(); ++nc) {
+    for (int n1 = Na_sum_cpu[nc]; n1 < Na_sum_cpu[nc] + Na_cpu[nc]; ++n1) {
+      for (int k = 0; k < NN[n1]; ++k) {
+        const int index = k * N + n1;
+        NL_cpu[index] = NL[count] + Na_sum_cpu[nc];
+        r12_cpu[index] = r12[count * 3 + 0];
+        r12_cpu[index + size] = r12[count * 3 + 1];
+        r12_cpu[index + size * 2] = r12[count * 3 + 2];
+        ++count;
+      }
+    }
+  }
+
+  NN_gpu.copy_from_host(NN.data(), N);
+  NL_gpu.copy_from_host(NL_cpu.data(), size);
+  x12_gpu.copy_from_host(r12_cpu.data(), size);
+  y12_gpu.copy_from_host(r12_cpu.data() + size, size);
+  z12_gpu.copy_from_host(r12_cpu.data() + size * 2, size);
+}
+
+void NEP3::fill_neighbor_cache(Parameters& para, Dataset& dataset, NEP3_Data& data)
+{
+  Neighbor_Cache& cache = dataset.neighbor_cache;
+
+  // the neighbor indices are stored as unsigned short
+  if (dataset.max_Na > 65536) {
+    return;
+  }
+
+  cache.NN_radial.resize(dataset.N);
+  cache.NN_angular.resize(dataset.N);
+  data.NN_radial.copy_to_host(cache.NN_radial.data(), dataset.N);
+  data.NN_angular.copy_to_host(cache.NN_angular.data(), dataset.N);
+  size_t num_radial = 0;
+  size_t num_angular = 0;
+  for (int n = 0; n < dataset.N; ++n) {
+    num_radial += cache.NN_radial[n];
+    num_angular += cache.NN_angular[n];
+  }
+
+  // fall back to recomputing the neighbor lists if the memory budget is exceeded
+  const size_t memory = dataset.N * sizeof(int) * 2 +
+                        (num_radial + num_angular) * (sizeof(unsigned short) + sizeof(float) * 3);
+  if (neighbor_cache_memory + memory > para.neighbor_cache_memory * 1024.0 * 1024.0) {
+    cache.clear();
+    return;
+  }
+
+  cache.NL_radial.resize(num_radial);
+  cache.r12_radial.resize(num_radial * 3);
+  download_neighbor_list(
+    dataset.N,
+    dataset.max_NN_radial,
+    dataset.Na_cpu,
+    dataset.Na_sum_cpu,
+    cache.NN_radial,
+    data.NL_radial,
+    data.x12_radial,
+    data.y12_radial,
+    data.z12_radial,
+    NL_cpu,
+    r12_cpu,
+    cache.NL_radial,
+    cache.r12_radial);
+
+  cache.NL_angular.resize(num_angular);
+  cache.r12_angular.resize(num_angular * 3);
+  download_neighbor_list(
+    dataset.N,
+    dataset.max_NN_angular,
+    dataset.Na_cpu,
+    dataset.Na_sum_cpu,
+    cache.NN_angular,
+    data.NL_angular,
+    data.x12_angular,
+    data.y12_angular,
+    data.z12_angular,
+    NL_cpu,
+    r12_cpu,
+    cache.NL_angular,
+    cache.r12_angular);
+
+  cache.is_filled = true;
+  neighbor_cache_memory += cache.memory();
+}
+
+void NEP3::restage_neighbor_cache(Dataset& dataset, Neighbor_Cache& cache, NEP3_Data& data)
+{
+  upload_neighbor_list(
+    dataset.N,
+    dataset.max_NN_radial,
+    dataset.Na_cpu,
+    dataset.Na_sum_cpu,
+    cache.NN_radial,
+    cache.NL_radial,
+    cache.r12_radial,
+    NL_cpu,
+    r12_cpu,
+    data.NN_radial,
+    data.NL_radial,
+    data.x12_radial,
+    data.y12_radial,
+    data.z12_radial);
+
+  upload_neighbor_list(
+    dataset.N,
+    dataset.max_NN_angular,
+    dataset.Na_cpu,
+    dataset.Na_sum_cpu,
+    cache.NN_angular,
+    cache.NL_angular,
+    cache.r12_angular,
+    NL_cpu,
+    r12_cpu,
+    data.NN_angular,
+    data.NL_angular,
+    data.x12_angular,
+    data.y12_angular,
+    data.z12_angular);
+}
+
 void NEP3::find_force(
   Parameters& para,
   const float* parameters,
@@ -851,30 +1033,40 @@ void NEP3::find_force(
     const int block_size = 32;
     const int grid_size = (dataset[device_id].N - 1) / block_size + 1;
 
-    if (calculate_neighbor) {
-      gpu_find_neighbor_list<<<dataset[device_id].Nc, 256>>>(
-        dataset[device_id].N,
-        dataset[device_id].Na.data(),
-        dataset[device_id].Na_sum.data(),
-        rc2_radial,
-        rc2_angular,
-        dataset[device_id].box.data(),
-        dataset[device_id].box_original.data(),
-        dataset[device_id].num_cell.data(),
-        dataset[device_id].r.data(),
-        dataset[device_id].r.data() + dataset[device_id].N,
-        dataset[device_id].r.data() + dataset[device_id].N * 2,
-        nep_data[device_id].NN_radial.data(),
-        nep_data[device_id].NL_radial.data(),
-        nep_data[device_id].NN_angular.data(),
-        nep_data[device_id].NL_angular.data(),
-        nep_data[device_id].x12_radial.data(),
-        nep_data[device_id].y12_radial.data(),
-        nep_data[device_id].z12_radial.data(),
-        nep_data[device_id].x12_angular.data(),
-        nep_data[device_id].y12_angular.data(),
-        nep_data[device_id].z12_angular.data());
-      CUDA_CHECK_KERNEL
+    // the structures never move, so the neighbor lists are only rebuilt when a new dataset comes
+    Neighbor_Cache& cache = dataset[0].neighbor_cache;
+    if (calculate_neighbor && staged_dataset[device_id] != &dataset[device_id]) {
+      if (cache.is_filled) {
+        restage_neighbor_cache(dataset[device_id], cache, nep_data[device_id]);
+      } else {
+        gpu_find_neighbor_list<<<dataset[device_id].Nc, 256>>>(
+          dataset[device_id].N,
+          dataset[device_id].Na.data(),
+          dataset[device_id].Na_sum.data(),
+          rc2_radial,
+          rc2_angular,
+          dataset[device_id].box.data(),
+          dataset[device_id].box_original.data(),
+          dataset[device_id].num_cell.data(),
+          dataset[device_id].r.data(),
+          dataset[device_id].r.data() + dataset[device_id].N,
+          dataset[device_id].r.data() + dataset[device_id].N * 2,
+          nep_data[device_id].NN_radial.data(),
+          nep_data[device_id].NL_radial.data(),
+          nep_data[device_id].NN_angular.data(),
+          nep_data[device_id].NL_angular.data(),
+          nep_data[device_id].x12_radial.data(),
+          nep_data[device_id].y12_radial.data(),
+          nep_data[device_id].z12_radial.data(),
+          nep_data[device_id].x12_angular.data(),
+          nep_data[device_id].y12_angular.data(),
+          nep_data[device_id].z12_angular.data());
+        CUDA_CHECK_KERNEL
+        if (device_id == 0) {
+          fill_neighbor_cache(para, dataset[0], nep_data[0]);
+        }
+      }
+      staged_dataset[device_id] = &dataset[device_id];
     }
 
     find_descriptors_radial<<<grid_size, block_size>>>(
@@ -17,8 +17,10 @@
 #include "potential.cuh"
 #include "utilities/common.cuh"
 #include "utilities/gpu_vector.cuh"
+#include <vector>
 class Parameters;
 class Dataset;
+struct Neighbor_Cache;
 
 struct NEP3_Data {
   GPU_Vector<int> NN_radial;  // radial neighbor number
@@ -105,5 +107,11 @@ private:
   ANN annmb[16];
   NEP3_Data nep_data[16];
   ZBL zbl;
+  const Dataset* staged_dataset[16]; // the dataset whose neighbor lists are in nep_data
+  size_t neighbor_cache_memory = 0;  // host memory (in bytes) used by all the neighbor caches
+  std::vector<int> NL_cpu;           // staging buffer for the neighbor lists
+  std::vector<float> r12_cpu;        // staging buffer for the relative positions
   void update_potential(Parameters& para, float* parameters, ANN& ann);
+  void fill_neighbor_cache(Parameters& para, Dataset& dataset, NEP3_Data& data);
+  void restage_neighbor_cache(Dataset& dataset, Neighbor_Cache& cache, NEP3_Data& data);
 };
@@ -0,0 +1,740 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Host (CPU) evaluation of the NEP model, used for the prediction mode on
+machines without a GPU. The numerics follow the CUDA kernels in nep3.cu; the
+atom loops are parallelized with OpenMP. Force accumulation is parallelized
+over configurations such that no two threads update the same atom.
+------------------------------------------------------------------------------*/
+
+#include "mic.cuh"
+#include "nep3_cpu.cuh"
+#include "parameters.cuh"
+#include "utilities/common.cuh"
+#include "utilities/error.cuh"
+#include "utilities/nep_utilities.cuh"
+#include <algorithm>
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+NEP3_CPU::NEP3_CPU(Parameters& para)
+{
+  paramb.version = para.version;
+  paramb.rc_radial = para.rc_radial;
+  paramb.rcinv_radial = 1.0f / paramb.rc_radial;
+  paramb.rc_angular = para.rc_angular;
+  paramb.rcinv_angular = 1.0f / paramb.rc_angular;
+  paramb.num_types = para.num_types;
+  paramb.n_max_radial = para.n_max_radial;
+  paramb.n_max_angular = para.n_max_angular;
+  paramb.L_max = para.L_max;
+  paramb.num_L = paramb.L_max;
+  if (paramb.version >= 3) {
+    if (para.L_max_4body == 2) {
+      paramb.num_L += 1;
+    }
+    if (para.L_max_5body == 1) {
+      paramb.num_L += 1;
+    }
+  }
+  paramb.dim_angular = (para.n_max_angular + 1) * paramb.num_L;
+
+  paramb.basis_size_radial = para.basis_size_radial;
+  paramb.basis_size_angular = para.basis_size_angular;
+  paramb.num_types_sq = para.num_types * para.num_types;
+  paramb.num_c_radial =
+    paramb.num_types_sq * (para.n_max_radial + 1) * (para.basis_size_radial + 1);
+
+  zbl.enabled = para.enable_zbl;
+  zbl.flexibled = para.flexible_zbl;
+  zbl.rc_inner = para.zbl_rc_inner;
+  zbl.rc_outer = para.zbl_rc_outer;
+  for (int n = 0; n < para.atomic_numbers.size(); ++n) {
+    zbl.atomic_numbers[n] = para.atomic_numbers[n];
+  }
+  if (zbl.flexibled) {
+    zbl.num_types = para.num_types;
+    int num_type_zbl = (para.num_types * (para.num_types + 1)) / 2;
+    for (int n = 0; n < num_type_zbl * 10; ++n) {
+      zbl.para[n] = para.zbl_para[n];
+    }
+  }
+
+  annmb.dim = para.dim;
+  annmb.num_neurons1 = para.num_neurons1;
+  annmb.num_para = para.number_of_variables;
+}
+
+void NEP3_CPU::update_potential(Parameters& para, const float* parameters)
+{
+  const float* pointer = parameters;
+  for (int t = 0; t < paramb.num_types; ++t) {
+    if (t > 0 && paramb.version != 4) { // Use the same set of NN parameters for NEP2 and NEP3
+      pointer -= (annmb.dim + 2) * annmb.num_neurons1;
+    }
+    annmb.w0[t] = pointer;
+    pointer += annmb.num_neurons1 * annmb.dim;
+    annmb.b0[t] = pointer;
+    pointer += annmb.num_neurons1;
+    annmb.w1[t] = pointer;
+    pointer += annmb.num_neurons1;
+  }
+  annmb.b1 = pointer;
+  pointer += 1;
+
+  if (para.train_mode == 2) {
+    for (int t = 0; t < paramb.num_types; ++t) {
+      if (t > 0 && paramb.version != 4) { // Use the same set of NN parameters for NEP2 and NEP3
+        pointer -= (annmb.dim + 2) * annmb.num_neurons1;
+      }
+      annmb.w0_pol[t] = pointer;
+      pointer += annmb.num_neurons1 * annmb.dim;
+      annmb.b0_pol[t] = pointer;
+      pointer += annmb.num_neurons1;
+      annmb.w1_pol[t] = pointer;
+      pointer += annmb.num_neurons1;
+    }
+    annmb.b1_pol = pointer;
+    pointer += 1;
+  }
+
+  annmb.c = pointer;
+}
+
+void NEP3_CPU::copy_structures(std::vector<Structure>& structures, const int n1, const int n2)
+{
+  Nc = n2 - n1;
+  Na.resize(Nc);
+  Na_sum.resize(Nc);
+  N = 0;
+  for (int nc = 0; nc < Nc; ++nc) {
+    Na[nc] = structures[n1 + nc].num_atom;
+    Na_sum[nc] = N;
+    N += Na[nc];
+  }
+
+  type.resize(N);
+  r.resize(N * 3);
+  config.resize(N);
+  for (int nc = 0; nc < Nc; ++nc) {
+    const Structure& structure = structures[n1 + nc];
+    for (int na = 0; na < Na[nc]; ++na) {
+      const int n = Na_sum[nc] + na;
+      type[n] = structure.type[na];
+      r[n * 3 + 0] = structure.x[na];
+      r[n * 3 + 1] = structure.y[na];
+      r[n * 3 + 2] = structure.z[na];
+      config[n] = nc;
+    }
+  }
+}
+
+// count (when NL is nullptr) or record the neighbors of atom n1
+static void find_neighbors_of_one_atom(
+  const int n1,
+  const int N1,
+  const int N2,
+  const float rc2,
+  const Structure& structure,
+  const float* r,
+  int& count,
+  int* NL,
+  float* r12)
+{
+  const float* box = structure.box;
+  const float* box_original = structure.box_original;
+  const int* num_cell = structure.num_cell;
+  count = 0;
+  for (int n2 = N1; n2 < N2; ++n2) {
+    for (int ia = 0; ia < num_cell[0]; ++ia) {
+      for (int ib = 0; ib < num_cell[1]; ++ib) {
+        for (int ic = 0; ic < num_cell[2]; ++ic) {
+          if (ia == 0 && ib == 0 && ic == 0 && n1 == n2) {
+            continue; // exclude self
+          }
+          float delta_x = box_original[0] * ia + box_original[1] * ib + box_original[2] * ic;
+          float delta_y = box_original[3] * ia + box_original[4] * ib + box_original[5] * ic;
+          float delta_z = box_original[6] * ia + box_original[7] * ib + box_original[8] * ic;
+          float x12 = r[n2 * 3 + 0] + delta_x - r[n1 * 3 + 0];
+          float y12 = r[n2 * 3 + 1] + delta_y - r[n1 * 3 + 1];
+          float z12 = r[n2 * 3 + 2] + delta_z - r[n1 * 3 + 2];
+          dev_apply_mic(box, x12, y12, z12);
+          float distance_square = x12 * x12 + y12 * y12 + z12 * z12;
+          if (distance_square < rc2) {
+            if (NL != nullptr) {
+              NL[count] = n2;
+              r12[count * 3 + 0] = x12;
+              r12[count * 3 + 1] = y12;
+              r12[count * 3 + 2] = z12;
+            }
+            count++;
+          }
+        }
+      }
+    }
+  }
+}
+
+void NEP3_CPU::find_neighbor_list(std::vector<Structure>& structures, const int n1)
+{
+  const float rc2_radial = paramb.rc_radial * paramb.rc_radial;
+  const float rc2_angular = paramb.rc_angular * paramb.rc_angular;
+  NN_radial.resize(N);
+  NN_angular.resize(N);
+  NN_radial_sum.resize(N);
+  NN_angular_sum.resize(N);
+
+  // the first pass only counts the neighbors such that the lists can be stored contiguously
+#pragma omp parallel for schedule(dynamic, 16)
+  for (int n = 0; n < N; ++n) {
+    const int nc = config[n];
+    const int N1 = Na_sum[nc];
+    const int N2 = N1 + Na[nc];
+    const Structure& structure = structures[n1 + nc];
+    find_neighbors_of_one_atom(
+      n, N1, N2, rc2_radial, structure, r.data(), NN_radial[n], nullptr, nullptr);
+    find_neighbors_of_one_atom(
+      n, N1, N2, rc2_angular, structure, r.data(), NN_angular[n], nullptr, nullptr);
+  }
+
+  int count_radial = 0;
+  int count_angular = 0;
+  for (int n = 0; n < N; ++n) {
+    NN_radial_sum[n] = count_radial;
+    NN_angular_sum[n] = count_angular;
+    count_radial += NN_radial[n];
+    count_angular += NN_angular[n];
+  }
+  NL_radial.resize(count_radial);
+  NL_angular.resize(count_angular);
+  r12_radial.resize(count_radial * 3);
+  r12_angular.resize(count_angular * 3);
+
+#pragma omp parallel for schedule(dynamic, 16)
+  for (int n = 0; n < N; ++n) {
+    const int nc = config[n];
+    const int N1 = Na_sum[nc];
+    const int N2 = N1 + Na[nc];
+    const Structure& structure = structures[n1 + nc];
+    find_neighbors_of_one_atom(
+      n,
+      N1,
+      N2,
+      rc2_radial,
+      structure,
+      r.data(),
+      NN_radial[n],
+      NL_radial.data() + NN_radial_sum[n],
+      r12_radial.data() + NN_radial_sum[n] * 3);
+    find_neighbors_of_one_atom(
+      n,
+      N1,
+      N2,
+      rc2_angular,
+      structure,
+      r.data(),
+      NN_angular[n],
+      NL_angular.data() + NN_angular_sum[n],
+      r12_angular.data() + NN_angular_sum[n] * 3);
+  }
+}
+
+void NEP3_CPU::find_descriptors()
+{
+  const int num_sum_fxyz = (paramb.n_max_angular + 1) * NUM_OF_ABC;
+  descriptors.resize(N * annmb.dim);
+  sum_fxyz.resize(N * num_sum_fxyz);
+
+#pragma omp parallel for
+  for (int n1 = 0; n1 < N; ++n1) {
+    int t1 = type[n1];
+    float* g_descriptors = descriptors.data() + n1 * annmb.dim;
+
+    // radial descriptors
+    float q[MAX_DIM] = {0.0f};
+    for (int i1 = 0; i1 < NN_radial[n1]; ++i1) {
+      int index = NN_radial_sum[n1] + i1;
+      int n2 = NL_radial[index];
+      float x12 = r12_radial[index * 3 + 0];
+      float y12 = r12_radial[index * 3 + 1];
+      float z12 = r12_radial[index * 3 + 2];
+      float d12 = sqrt(x12 * x12 + y12 * y12 + z12 * z12);
+      float fc12;
+      find_fc(paramb.rc_radial, paramb.rcinv_radial, d12, fc12);
+      int t2 = type[n2];
+      float fn12[MAX_NUM_N];
+      if (paramb.version == 2) {
+        find_fn(paramb.n_max_radial, paramb.rcinv_radial, d12, fc12, fn12);
+        for (int n = 0; n <= paramb.n_max_radial; ++n) {
+          float c = (paramb.num_types == 1)
+                      ? 1.0f
+                      : annmb.c[(n * paramb.num_types + t1) * paramb.num_types + t2];
+          q[n] += fn12[n] * c;
+        }
+      } else {
+        find_fn(paramb.basis_size_radial, paramb.rcinv_radial, d12, fc12, fn12);
+        for (int n = 0; n <= paramb.n_max_radial; ++n) {
+          float gn12 = 0.0f;
+          for (int k = 0; k <= paramb.basis_size_radial; ++k) {
+            int c_index = (n * (paramb.basis_size_radial + 1) + k) * paramb.num_types_sq;
+            c_index += t1 * paramb.num_types + t2;
+            gn12 += fn12[k] * annmb.c[c_index];
+          }
+          q[n] += gn12;
+        }
+      }
+    }
+    for (int n = 0; n <= paramb.n_max_radial; ++n) {
+      g_descriptors[n] = q[n];
+    }
+
+    // angular descriptors
+    float q_angular[MAX_DIM_ANGULAR] = {0.0f};
+    for (int n = 0; n <= paramb.n_max_angular; ++n) {
+      float s[NUM_OF_ABC] = {0.0f};
+      for (int i1 = 0; i1 < NN_angular[n1]; ++i1) {
+        int index = NN_angular_sum[n1] + i1;
+        int n2 = NL_angular[index];
+        float x12 = r12_angular[index * 3 + 0];
+        float y12 = r12_angular[index * 3 + 1];
+        float z12 = r12_angular[index * 3 + 2];
+        float d12 = sqrt(x12 * x12 + y12 * y12 + z12 * z12);
+        float fc12;
+        find_fc(paramb.rc_angular, paramb.rcinv_angular, d12, fc12);
+        int t2 = type[n2];
+        if (paramb.version == 2) {
+          float fn;
+          find_fn(n, paramb.rcinv_angular, d12, fc12, fn);
+          fn *=
+            (paramb.num_types == 1)
+              ? 1.0f
+              : annmb.c
+                  [((paramb.n_max_radial + 1 + n) * paramb.num_types + t1) * paramb.num_types + t2];
+          accumulate_s(d12, x12, y12, z12, fn, s);
+        } else {
+          float fn12[MAX_NUM_N];
+          find_fn(paramb.basis_size_angular, paramb.rcinv_angular, d12, fc12, fn12);
+          float gn12 = 0.0f;
+          for (int k = 0; k <= paramb.basis_size_angular; ++k) {
+            int c_index = (n * (paramb.basis_size_angular + 1) + k) * paramb.num_types_sq;
+            c_index += t1 * paramb.num_types + t2 + paramb.num_c_radial;
+            gn12 += fn12[k] * annmb.c[c_index];
+          }
+          accumulate_s(d12, x12, y12, z12, gn12, s);
+        }
+      }
+      if (paramb.num_L == paramb.L_max) {
+        find_q(paramb.n_max_angular + 1, n, s, q_angular);
+      } else if (paramb.num_L == paramb.L_max + 1) {
+        find_q_with_4body(paramb.n_max_angular + 1, n, s, q_angular);
+      } else {
+        find_q_with_5body(paramb.n_max_angular + 1, n, s, q_angular);
+      }
+      for (int abc = 0; abc < NUM_OF_ABC; ++abc) {
+        sum_fxyz[n1 * num_sum_fxyz + n * NUM_OF_ABC + abc] = s[abc];
+      }
+    }
+    for (int n = 0; n <= paramb.n_max_angular; ++n) {
+      for (int l = 0; l < paramb.num_L; ++l) {
+        int ln = l * (paramb.n_max_angular + 1) + n;
+        g_descriptors[(paramb.n_max_radial + 1) + ln] = q_angular[ln];
+      }
+    }
+  }
+}
+
+void NEP3_CPU::apply_ann(Parameters& para, std::vector<Structure>& structures, const int n1)
+{
+  // the temperature component is scaled by a fixed factor, as in the GPU version
+  std::vector<float> q_scaler(para.q_scaler_cpu);
+  if (para.train_mode == 3) {
+    q_scaler[annmb.dim - 1] = 0.001f;
+  }
+
+  energy.resize(N);
+  Fp.resize(N * annmb.dim);
+  virial.assign(N * 6, 0.0f);
+
+#pragma omp parallel for
+  for (int n = 0; n < N; ++n) {
+    int t = type[n];
+    float q[MAX_DIM] = {0.0f};
+    for (int d = 0; d < annmb.dim; ++d) {
+      q[d] = descriptors[n * annmb.dim + d] * q_scaler[d];
+    }
+    if (para.train_mode == 3) {
+      q[annmb.dim - 1] = structures[n1 + config[n]].temperature * q_scaler[annmb.dim - 1];
+    }
+
+    float F = 0.0f, Fp_n[MAX_DIM] = {0.0f};
+    if (para.train_mode == 2) {
+      // scalar part
+      apply_ann_one_layer(
+        annmb.dim,
+        annmb.num_neurons1,
+        annmb.w0_pol[t],
+        annmb.b0_pol[t],
+        annmb.w1_pol[t],
+        annmb.b1_pol,
+        q,
+        F,
+        Fp_n);
+      virial[n * 6 + 0] = F;
+      virial[n * 6 + 1] = F;
+      virial[n * 6 + 2] = F;
+
+      // tensor part
+      for (int d = 0; d < annmb.dim; ++d) {
+        Fp_n[d] = 0.0f;
+      }
+    }
+    apply_ann_one_layer(
+      annmb.dim, annmb.num_neurons1, annmb.w0[t], annmb.b0[t], annmb.w1[t], annmb.b1, q, F, Fp_n);
+    energy[n] = (para.train_mode == 2) ? 0.0f : F;
+
+    for (int d = 0; d < annmb.dim; ++d) {
+      Fp[n * annmb.dim + d] = Fp_n[d] * q_scaler[d];
+    }
+  }
+}
+
+static void accumulate_force_and_virial(
+  const bool is_dipole,
+  const int n1,
+  const int n2,
+  const float* r12,
+  const float* f12,
+  float* force,
+  float* virial)
+{
+  for (int d = 0; d < 3; ++d) {
+    force[n1 * 3 + d] += f12[d];
+    force[n2 * 3 + d] -= f12[d];
+  }
+  if (is_dipole) {
+    float r12_square = r12[0] * r12[0] + r12[1] * r12[1] + r12[2] * r12[2];
+    virial[n1 * 6 + 0] -= r12_square * f12[0];
+    virial[n1 * 6 + 1] -= r12_square * f12[1];
+    virial[n1 * 6 + 2] -= r12_square * f12[2];
+  } else {
+    virial[n1 * 6 + 0] -= r12[0] * f12[0];
+    virial[n1 * 6 + 1] -= r12[1] * f12[1];
+    virial[n1 * 6 + 2] -= r12[2] * f12[2];
+  }
+  virial[n1 * 6 + 3] -= r12[0] * f12[1];
+  virial[n1 * 6 + 4] -= r12[1] * f12[2];
+  virial[n1 * 6 + 5] -= r12[2] * f12[0];
+}
+
+void NEP3_CPU::find_force_radial_and_angular(Parameters& para)
+{
+  const bool is_dipole = para.train_mode == 1;
+  const int num_sum_fxyz = (paramb.n_max_angular + 1) * NUM_OF_ABC;
+  force.assign(N * 3, 0.0f);
+
+  // an atom only interacts with atoms in the same configuration
+#pragma omp parallel for schedule(dynamic)
+  for (int nc = 0; nc < Nc; ++nc) {
+    for (int n1 = Na_sum[nc]; n1 < Na_sum[nc] + Na[nc]; ++n1) {
+      int t1 = type[n1];
+      const float* Fp_n1 = Fp.data() + n1 * annmb.dim;
+
+      for (int i1 = 0; i1 < NN_radial[n1]; ++i1) {
+        int index = NN_radial_sum[n1] + i1;
+        int n2 = NL_radial[index];
+        int t2 = type[n2];
+        const float* r12 = r12_radial.data() + index * 3;
+        float d12 = sqrt(r12[0] * r12[0] + r12[1] * r12[1] + r12[2] * r12[2]);
+        float d12inv = 1.0f / d12;
+        float fc12, fcp12;
+        find_fc_and_fcp(paramb.rc_radial, paramb.rcinv_radial, d12, fc12, fcp12);
+        float fn12[MAX_NUM_N];
+        float fnp12[MAX_NUM_N];
+        float f12[3] = {0.0f};
+
+        if (paramb.version == 2) {
+          find_fn_and_fnp(
+            paramb.n_max_radial, paramb.rcinv_radial, d12, fc12, fcp12, fn12, fnp12);
+          for (int n = 0; n <= paramb.n_max_radial; ++n) {
+            float tmp12 = Fp_n1[n] * fnp12[n] * d12inv;
+            tmp12 *= (paramb.num_types == 1)
+                       ? 1.0f
+                       : annmb.c[(n * paramb.num_types + t1) * paramb.num_types + t2];
+            for (int d = 0; d < 3; ++d) {
+              f12[d] += tmp12 * r12[d];
+            }
+          }
+        } else {
+          find_fn_and_fnp(
+            paramb.basis_size_radial, paramb.rcinv_radial, d12, fc12, fcp12, fn12, fnp12);
+          for (int n = 0; n <= paramb.n_max_radial; ++n) {
+            float gnp12 = 0.0f;
+            for (int k = 0; k <= paramb.basis_size_radial; ++k) {
+              int c_index = (n * (paramb.basis_size_radial + 1) + k) * paramb.num_types_sq;
+              c_index += t1 * paramb.num_types + t2;
+              gnp12 += fnp12[k] * annmb.c[c_index];
+            }
+            float tmp12 = Fp_n1[n] * gnp12 * d12inv;
+            for (int d = 0; d < 3; ++d) {
+              f12[d] += tmp12 * r12[d];
+            }
+          }
+        }
+        accumulate_force_and_virial(is_dipole, n1, n2, r12, f12, force.data(), virial.data());
+      }
+
+      float Fp_angular[MAX_DIM_ANGULAR] = {0.0f};
+      for (int d = 0; d < paramb.dim_angular; ++d) {
+        Fp_angular[d] = Fp_n1[paramb.n_max_radial + 1 + d];
+      }
+      const float* sum_fxyz_n1 = sum_fxyz.data() + n1 * num_sum_fxyz;
+
+      for (int i1 = 0; i1 < NN_angular[n1]; ++i1) {
+        int index = NN_angular_sum[n1] + i1;
+        int n2 = NL_angular[index];
+        int t2 = type[n2];
+        const float* r12 = r12_angular.data() + index * 3;
+        float d12 = sqrt(r12[0] * r12[0] + r12[1] * r12[1] + r12[2] * r12[2]);
+        float fc12, fcp12;
+        find_fc_and_fcp(paramb.rc_angular, paramb.rcinv_angular, d12, fc12, fcp12);
+        float f12[3] = {0.0f};
+
+        if (paramb.version == 2) {
+          for (int n = 0; n <= paramb.n_max_angular; ++n) {
+            float fn;
+            float fnp;
+            find_fn_and_fnp(n, paramb.rcinv_angular, d12, fc12, fcp12, fn, fnp);
+            const float c =
+              (paramb.num_types == 1)
+                ? 1.0f
+                : annmb.c
+                    [((paramb.n_max_radial + 1 + n) * paramb.num_types + t1) * paramb.num_types +
+                     t2];
+            fn *= c;
+            fnp *= c;
+            accumulate_f12(
+              n, paramb.n_max_angular + 1, d12, r12, fn, fnp, Fp_angular, sum_fxyz_n1, f12);
+          }
+        } else {
+          float fn12[MAX_NUM_N];
+          float fnp12[MAX_NUM_N];
+          find_fn_and_fnp(
+            paramb.basis_size_angular, paramb.rcinv_angular, d12, fc12, fcp12, fn12, fnp12);
+          for (int n = 0; n <= paramb.n_max_angular; ++n) {
+            float gn12 = 0.0f;
+            float gnp12 = 0.0f;
+            for (int k = 0; k <= paramb.basis_size_angular; ++k) {
+              int c_index = (n * (paramb.basis_size_angular + 1) + k) * paramb.num_types_sq;
+              c_index += t1 * paramb.num_types + t2 + paramb.num_c_radial;
+              gn12 += fn12[k] * annmb.c[c_index];
+              gnp12 += fnp12[k] * annmb.c[c_index];
+            }
+            if (paramb.num_L == paramb.L_max) {
+              accumulate_f12(
+                n, paramb.n_max_angular + 1, d12, r12, gn12, gnp12, Fp_angular, sum_fxyz_n1, f12);
+            } else if (paramb.num_L == paramb.L_max + 1) {
+              accumulate_f12_with_4body(
+                n, paramb.n_max_angular + 1, d12, r12, gn12, gnp12, Fp_angular, sum_fxyz_n1, f12);
+            } else {
+              accumulate_f12_with_5body(
+                n, paramb.n_max_angular + 1, d12, r12, gn12, gnp12, Fp_angular, sum_fxyz_n1, f12);
+            }
+          }
+        }
+        accumulate_force_and_virial(is_dipole, n1, n2, r12, f12, force.data(), virial.data());
+      }
+    }
+  }
+}
+
+void NEP3_CPU::find_force_zbl()
+{
+#pragma omp parallel for schedule(dynamic)
+  for (int nc = 0; nc < Nc; ++nc) {
+    for (int n1 = Na_sum[nc]; n1 < Na_sum[nc] + Na[nc]; ++n1) {
+      int type1 = type[n1];
+      float zi = zbl.atomic_numbers[type1];
+      float pow_zi = pow(zi, 0.23f);
+      for (int i1 = 0; i1 < NN_angular[n1]; ++i1) {
+        int index = NN_angular_sum[n1] + i1;
+        int n2 = NL_angular[index];
+        const float* r12 = r12_angular.data() + index * 3;
+        float d12 = sqrt(r12[0] * r12[0] + r12[1] * r12[1] + r12[2] * r12[2]);
+        float d12inv = 1.0f / d12;
+        float f, fp;
+        int type2 = type[n2];
+        float zj = zbl.atomic_numbers[type2];
+        float a_inv = (pow_zi + pow(zj, 0.23f)) * 2.134563f;
+        float zizj = K_C_SP * zi * zj;
+        if (zbl.flexibled) {
+          int t1, t2;
+          if (type1 < type2) {
+            t1 = type1;
+            t2 = type2;
+          } else {
+            t1 = type2;
+            t2 = type1;
+          }
+          int zbl_index = t1 * zbl.num_types - (t1 * (t1 - 1)) / 2 + (t2 - t1);
+          float ZBL_para[10];
+          for (int i = 0; i < 10; ++i) {
+            ZBL_para[i] = zbl.para[10 * zbl_index + i];
+          }
+          find_f_and_fp_zbl(ZBL_para, zizj, a_inv, d12, d12inv, f, fp);
+        } else {
+          find_f_and_fp_zbl(zizj, a_inv, zbl.rc_inner, zbl.rc_outer, d12, d12inv, f, fp);
+        }
+        float f2 = fp * d12inv * 0.5f;
+        float f12[3] = {r12[0] * f2, r12[1] * f2, r12[2] * f2};
+        accumulate_force_and_virial(false, n1, n2, r12, f12, force.data(), virial.data());
+        energy[n1] += f * 0.5f;
+      }
+    }
+  }
+}
+
+void NEP3_CPU::find_force(
+  Parameters& para,
+  const float* parameters,
+  std::vector<Structure>& structures,
+  const int n1,
+  const int n2)
+{
+  update_potential(para, parameters);
+  copy_structures(structures, n1, n2);
+  find_neighbor_list(structures, n1);
+  find_descriptors();
+  apply_ann(para, structures, n1);
+  find_force_radial_and_angular(para);
+  if (zbl.enabled) {
+    find_force_zbl();
+  }
+}
+
+// the same format as Fitness::output()
+static void output_per_structure(
+  const bool is_energy,
+  const bool is_stress,
+  const int num_components,
+  const int stride,
+  FILE* fid,
+  const float* prediction,
+  const std::vector<int>& Na,
+  const std::vector<int>& Na_sum,
+  std::vector<Structure>& structures,
+  const int n1)
+{
+  for (int nc = 0; nc < Na.size(); ++nc) {
+    const Structure& structure = structures[n1 + nc];
+    for (int n = 0; n < num_components; ++n) {
+      float data_nc = 0.0f;
+      for (int m = 0; m < Na[nc]; ++m) {
+        data_nc += prediction[(Na_sum[nc] + m) * stride + n];
+      }
+      if (!is_stress) {
+        fprintf(fid, "%g ", data_nc / Na[nc]);
+      } else {
+        fprintf(fid, "%g ", data_nc / structure.volume * PRESSURE_UNIT_CONVERSION);
+      }
+    }
+    for (int n = 0; n < num_components; ++n) {
+      float ref_value = is_energy ? structure.energy : structure.virial[n];
+      if (is_stress) {
+        ref_value *= Na[nc] / structure.volume * PRESSURE_UNIT_CONVERSION;
+      }
+      if (n == num_components - 1) {
+        fprintf(fid, "%g\n", ref_value);
+      } else {
+        fprintf(fid, "%g ", ref_value);
+      }
+    }
+  }
+}
+
+void NEP3_CPU::output(
+  Parameters& para,
+  std::vector<Structure>& structures,
+  const int n1,
+  FILE* fid_energy,
+  FILE* fid_force,
+  FILE* fid_virial,
+  FILE* fid_stress)
+{
+  if (para.train_mode == 0 || para.train_mode == 3) {
+    for (int nc = 0; nc < Nc; ++nc) {
+      const Structure& structure = structures[n1 + nc];
+      for (int m = 0; m < Na[nc]; ++m) {
+        int n = Na_sum[nc] + m;
+        fprintf(
+          fid_force,
+          "%g %g %g %g %g %g\n",
+          force[n * 3 + 0],
+          force[n * 3 + 1],
+          force[n * 3 + 2],
+          structure.fx[m],
+          structure.fy[m],
+          structure.fz[m]);
+      }
+    }
+    output_per_structure(true, false, 1, 1, fid_energy, energy.data(), Na, Na_sum, structures, n1);
+    output_per_structure(false, false, 6, 6, fid_virial, virial.data(), Na, Na_sum, structures, n1);
+    output_per_structure(false, true, 6, 6, fid_stress, virial.data(), Na, Na_sum, structures, n1);
+  } else {
+    // the dipole or polarizability is taken as the virial
+    const int num_components = (para.train_mode == 1) ? 3 : 6;
+    output_per_structure(
+      false, false, num_components, 6, fid_virial, virial.data(), Na, Na_sum, structures, n1);
+  }
+}
+
+void NEP3_CPU::predict(
+  Parameters& para, const float* parameters, std::vector<Structure>& structures)
+{
+#ifdef _OPENMP
+  printf("Number of OpenMP threads = %d\n", omp_get_max_threads());
+#endif
+
+  FILE* fid_energy = nullptr;
+  FILE* fid_force = nullptr;
+  FILE* fid_virial = nullptr;
+  FILE* fid_stress = nullptr;
+  if (para.train_mode == 0 || para.train_mode == 3) {
+    fid_energy = my_fopen("energy_train.out", "w");
+    fid_force = my_fopen("force_train.out", "w");
+    fid_virial = my_fopen("virial_train.out", "w");
+    fid_stress = my_fopen("stress_train.out", "w");
+  } else if (para.train_mode == 1) {
+    fid_virial = my_fopen("dipole_train.out", "w");
+  } else {
+    fid_virial = my_fopen("polarizability_train.out", "w");
+  }
+
+  const int num_structures = structures.size();
+  for (int n1 = 0; n1 < num_structures; n1 += para.batch_size) {
+    const int n2 = std::min(num_structures, n1 + para.batch_size);
+    find_force(para, parameters, structures, n1, n2);
+    output(para, structures, n1, fid_energy, fid_force, fid_virial, fid_stress);
+  }
+
+  fclose(fid_virial);
+  if (para.train_mode == 0 || para.train_mode == 3) {
+    fclose(fid_energy);
+    fclose(fid_force);
+    fclose(fid_stress);
+  }
+}
@@ -0,0 +1,127 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include "structure.cuh"
+#include "utilities/common.cuh"
+#include <stdio.h>
+#include <vector>
+class Parameters;
+
+class NEP3_CPU
+{
+public:
+  struct ParaMB {
+    float rc_radial = 0.0f;     // radial cutoff
+    float rc_angular = 0.0f;    // angular cutoff
+    float rcinv_radial = 0.0f;  // inverse of the radial cutoff
+    float rcinv_angular = 0.0f; // inverse of the angular cutoff
+    int basis_size_radial = 0;  // for nep3
+    int basis_size_angular = 0; // for nep3
+    int n_max_radial = 0;       // n_radial = 0, 1, 2, ..., n_max_radial
+    int n_max_angular = 0;      // n_angular = 0, 1, 2, ..., n_max_angular
+    int L_max = 0;              // l = 1, 2, ..., L_max
+    int dim_angular;
+    int num_L;
+    int num_types = 0;
+    int num_types_sq = 0; // for nep3
+    int num_c_radial = 0; // for nep3
+    int version = 2;      // 2 for NEP2 and 3 for NEP3
+  };
+
+  struct ANN {
+    int dim = 0;          // dimension of the descriptor
+    int num_neurons1 = 0; // number of neurons in the hidden layer
+    int num_para = 0;     // number of parameters
+    const float* w0[100]; // weight from the input layer to the hidden layer
+    const float* b0[100]; // bias for the hidden layer
+    const float* w1[100]; // weight from the hidden layer to the output layer
+    const float* b1;      // bias for the output layer
+    // for the scalar part of polarizability
+    const float* w0_pol[10]; // weight from the input layer to the hidden layer
+    const float* b0_pol[10]; // bias for the hidden layer
+    const float* w1_pol[10]; // weight from the hidden layer to the output layer
+    const float* b1_pol;     // bias for the output layer
+    // for elements in descriptor
+    const float* c;
+  };
+
+  struct ZBL {
+    bool enabled = false;
+    bool flexibled = false;
+    float rc_inner = 1.0f;
+    float rc_outer = 2.0f;
+    int num_types;
+    float para[550];
+    float atomic_numbers[NUM_ELEMENTS];
+  };
+
+  NEP3_CPU(Parameters& para);
+
+  // calculate energy, force and virial for structures[n1] to structures[n2 - 1]
+  void find_force(
+    Parameters& para,
+    const float* parameters,
+    std::vector<Structure>& structures,
+    const int n1,
+    const int n2);
+
+  // evaluate all the structures batch by batch and write the *_train.out files
+  void predict(Parameters& para, const float* parameters, std::vector<Structure>& structures);
+
+private:
+  ParaMB paramb;
+  ANN annmb;
+  ZBL zbl;
+
+  // data for the structures in the current batch, all in the host memory
+  int Nc = 0;                      // number of configurations
+  int N = 0;                       // total number of atoms
+  std::vector<int> Na;             // number of atoms in each configuration
+  std::vector<int> Na_sum;         // prefix sum of Na
+  std::vector<int> type;           // atom type
+  std::vector<float> r;            // position (x, y, z of each atom)
+  std::vector<int> NN_radial;      // radial neighbor number
+  std::vector<int> NN_angular;     // angular neighbor number
+  std::vector<int> NL_radial;      // radial neighbor list (with offsets in NN_radial_sum)
+  std::vector<int> NL_angular;     // angular neighbor list (with offsets in NN_angular_sum)
+  std::vector<int> NN_radial_sum;  // prefix sum of NN_radial
+  std::vector<int> NN_angular_sum; // prefix sum of NN_angular
+  std::vector<int> config;         // configuration index of each atom
+  std::vector<float> r12_radial;   // x12, y12, z12 of each radial neighbor
+  std::vector<float> r12_angular;  // x12, y12, z12 of each angular neighbor
+  std::vector<float> descriptors;  // descriptors (dim components of each atom)
+  std::vector<float> Fp;           // gradient of descriptors (dim components of each atom)
+  std::vector<float> sum_fxyz;     // the s_nlm sums of each atom
+  std::vector<float> energy;       // energy of each atom
+  std::vector<float> force;        // fx, fy, fz of each atom
+  std::vector<float> virial;       // xx, yy, zz, xy, yz, zx of each atom
+
+  void update_potential(Parameters& para, const float* parameters);
+  void copy_structures(std::vector<Structure>& structures, const int n1, const int n2);
+  void find_neighbor_list(std::vector<Structure>& structures, const int n1);
+  void find_descriptors();
+  void apply_ann(Parameters& para, std::vector<Structure>& structures, const int n1);
+  void find_force_radial_and_angular(Parameters& para);
+  void find_force_zbl();
+  void output(
+    Parameters& para,
+    std::vector<Structure>& structures,
+    const int n1,
+    FILE* fid_energy,
+    FILE* fid_force,
+    FILE* fid_virial,
+    FILE* fid_stress);
+};
@@ -13,12 +13,15 @@
     along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include "checkpoint.cuh"
 #include "parameters.cuh"
 #include "utilities/common.cuh"
 #include "utilities/error.cuh"
 #include "utilities/read_file.cuh"
+#include <chrono>
 #include <cmath>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 
 const std::string ELEMENTS[NUM_ELEMENTS] = {
@@ -42,6 +45,9 @@ Parameters::Parameters()
     read_zbl_in();
   }
   calculate_parameters();
+  if (prediction == 0 && checkpoint_interval > 0) {
+    read_checkpoint_header();
+  }
   report_inputs();
 
   print_line_1();
@@ -72,6 +78,11 @@ void Parameters::set_default_parameters()
   is_type_weight_set = false;
   is_zbl_set = false;
   is_force_delta_set = false;
+  is_neighbor_cache_set = false;
+  is_checkpoint_set = false;
+  is_sampling_set = false;
+  is_adaptive_population_set = false;
+  is_target_loss_set = false;
 
   train_mode = 0;              // potential
   prediction = 0;              // not prediction mode
@@ -102,6 +113,20 @@ void Parameters::set_default_parameters()
   }
   enable_zbl = false;   // default is not to include ZBL
   flexible_zbl = false; // default Universal ZBL
+
+  neighbor_cache_memory = 2048.0f; // enough for the neighbor lists of typical training sets
+  checkpoint_interval = 0;         // default is not to write checkpoints
+  sampling = 0;                    // plain SNES sampling
+  mixing_rate = 0.1f;              // minimal refresh rate suggested for importance mixing
+  min_population = 0;              // fixed population size
+  target_loss = 0.0f;              // not used
+  population_step = 1;             // updated according to the number of GPUs
+  start_generation = 0;            // default is to start from the first generation
+#ifdef DEBUG
+  shuffle_seed = 54321;
+#else
+  shuffle_seed = std::chrono::system_clock::now().time_since_epoch().count();
+#endif
 }
 
 void Parameters::read_nep_in()
@@ -207,8 +232,42 @@ void Parameters::calculate_parameters()
     }
   }
 
+  if (prediction == 2) {
+    return; // no GPU is needed for the prediction mode on the CPU
+  }
+
   int deviceCount;
   CHECK(cudaGetDeviceCount(&deviceCount));
+  population_step = deviceCount;
+  if (sampling == 1 && population_step % 2 != 0) {
+    population_step *= 2; // mirrored samples come in pairs
+  }
+  if (is_population_set || sampling == 1) {
+    int fully_used_device = population_size % population_step;
+    int population_should_increase;
+    if (fully_used_device != 0) {
+      population_should_increase = population_step - fully_used_device;
+      population_size += population_should_increase;
+    } else {
+      population_should_increase = 0;
+    }
+    if (population_should_increase != 0) {
+      if (sampling == 1) {
+        printf("Mirrored sampling needs a population size divisible by %d.\n", population_step);
+      } else {
+        printf("The input population size is not divisible by the number of GPUs.\n");
+        printf("This causes an inefficient use of resources.\n");
+      }
+      printf("The population size has therefore been increased to %d.\n", population_size);
+    }
+  }
+  if (min_population > 0) {
+    min_population = (min_population + population_step - 1) / population_step * population_step;
+    if (min_population > population_size) {
+      PRINT_INPUT_ERROR("minimal population size should <= population size.");
+    }
+  }
+
   for (int device_id = 0; device_id < deviceCount; device_id++) {
     CHECK(cudaSetDevice(device_id));
     q_scaler_gpu[device_id].resize(dim);
@@ -241,6 +300,8 @@ void Parameters::report_inputs()
   std::string calculation_mode_name = "train";
   if (prediction == 1) {
     calculation_mode_name = "predict";
+  } else if (prediction == 2) {
+    calculation_mode_name = "predict on the CPU";
   }
   if (is_prediction_set) {
     printf("    (input)   calculation mode = %s.\n", calculation_mode_name.c_str());
@@ -391,6 +452,40 @@ void Parameters::report_inputs()
     printf("    (default) maximum number of generations = %d.\n", maximum_generation);
   }
 
+  if (is_neighbor_cache_set) {
+    printf("    (input)   neighbor list cache memory = %g MB.\n", neighbor_cache_memory);
+  } else {
+    printf("    (default) neighbor list cache memory = %g MB.\n", neighbor_cache_memory);
+  }
+
+  if (is_checkpoint_set) {
+    printf("    (input)   checkpoint interval = %d generations.\n", checkpoint_interval);
+    if (start_generation > 0) {
+      printf("        resume training from generation %d.\n", start_generation);
+    }
+  } else {
+    printf("    (default) no checkpoint is written.\n");
+  }
+
+  if (sampling == 1) {
+    printf("    (input)   use mirrored sampling.\n");
+  } else if (sampling == 2) {
+    printf("    (input)   use importance mixing with a minimal refresh rate of %g.\n", mixing_rate);
+  } else {
+    printf("    (default) use plain SNES sampling.\n");
+  }
+
+  if (is_adaptive_population_set) {
+    printf(
+      "    (input)   adapt population size between %d and %d.\n", min_population, population_size);
+  } else {
+    printf("    (default) use a fixed population size.\n");
+  }
+
+  if (is_target_loss_set) {
+    printf("    (input)   report fitness evaluations to reach loss %g.\n", target_loss);
+  }
+
   // some calcuated parameters:
   printf("Some calculated parameters:\n");
   printf("    number of radial descriptor components = %d.\n", dim_radial);
@@ -454,6 +549,16 @@ void Parameters::parse_one_keyword(std::vector<std::string>& tokens)
     parse_force_delta(param, num_param);
   } else if (strcmp(param[0], "zbl") == 0) {
     parse_zbl(param, num_param);
+  } else if (strcmp(param[0], "neighbor_cache") == 0) {
+    parse_neighbor_cache(param, num_param);
+  } else if (strcmp(param[0], "checkpoint") == 0) {
+    parse_checkpoint(param, num_param);
+  } else if (strcmp(param[0], "sampling") == 0) {
+    parse_sampling(param, num_param);
+  } else if (strcmp(param[0], "adaptive_population") == 0) {
+    parse_adaptive_population(param, num_param);
+  } else if (strcmp(param[0], "target_loss") == 0) {
+    parse_target_loss(param, num_param);
   } else {
     PRINT_KEYWORD_ERROR(param[0]);
   }
@@ -484,8 +589,8 @@ void Parameters::parse_prediction(const char** param, int num_param)
   if (!is_valid_int(param[1], &prediction)) {
     PRINT_INPUT_ERROR("prediction should be an integer.\n");
   }
-  if (prediction != 0 && prediction != 1) {
-    PRINT_INPUT_ERROR("prediction should = 0 or 1.");
+  if (prediction != 0 && prediction != 1 && prediction != 2) {
+    PRINT_INPUT_ERROR("prediction should = 0 or 1 or 2.");
   }
 }
 
@@ -885,22 +990,6 @@ void Parameters::parse_population(const char** param, int num_param)
   } else if (population_size > 200) {
     PRINT_INPUT_ERROR("population size should <= 200.");
   }
-
-  int deviceCount;
-  CHECK(cudaGetDeviceCount(&deviceCount));
-  int fully_used_device = population_size % deviceCount;
-  int population_should_increase;
-  if (fully_used_device != 0) {
-    population_should_increase = deviceCount - fully_used_device;
-    population_size += population_should_increase;
-  } else {
-    population_should_increase = 0;
-  }
-  if (population_should_increase != 0) {
-    printf("The input population size is not divisible by the number of GPUs.\n");
-    printf("This causes an inefficient use of resources.\n");
-    printf("The population size has therefore been increased to %d.\n", population_size);
-  }
 }
 
 void Parameters::parse_generation(const char** param, int num_param)
@@ -919,3 +1008,162 @@ void Parameters::parse_generation(const char** param, int num_param)
     PRINT_INPUT_ERROR("maximum number of generations should <= 10000000.");
   }
 }
+
+void Parameters::parse_neighbor_cache(const char** param, int num_param)
+{
+  is_neighbor_cache_set = true;
+
+  if (num_param != 2) {
+    PRINT_INPUT_ERROR("neighbor_cache should have 1 parameter.\n");
+  }
+
+  double neighbor_cache_memory_tmp = 0.0;
+  if (!is_valid_real(param[1], &neighbor_cache_memory_tmp)) {
+    PRINT_INPUT_ERROR("neighbor list cache memory should be a number.\n");
+  }
+  neighbor_cache_memory = neighbor_cache_memory_tmp;
+
+  if (neighbor_cache_memory < 0.0f) {
+    PRINT_INPUT_ERROR("neighbor list cache memory should >= 0.");
+  }
+}
+
+void Parameters::parse_checkpoint(const char** param, int num_param)
+{
+  is_checkpoint_set = true;
+
+  if (num_param != 2) {
+    PRINT_INPUT_ERROR("checkpoint should have 1 parameter.\n");
+  }
+  if (!is_valid_int(param[1], &checkpoint_interval)) {
+    PRINT_INPUT_ERROR("checkpoint interval should be an integer.\n");
+  }
+  if (checkpoint_interval < 0) {
+    PRINT_INPUT_ERROR("checkpoint interval should >= 0.");
+  }
+}
+
+void Parameters::parse_sampling(const char** param, int num_param)
+{
+  is_sampling_set = true;
+
+  if (num_param < 2) {
+    PRINT_INPUT_ERROR("sampling should have at least 1 parameter.\n");
+  }
+  if (strcmp(param[1], "standard") == 0) {
+    sampling = 0;
+  } else if (strcmp(param[1], "mirrored") == 0) {
+    sampling = 1;
+  } else if (strcmp(param[1], "mixing") == 0) {
+    sampling = 2;
+  } else {
+    PRINT_INPUT_ERROR("sampling should be standard, mirrored, or mixing.\n");
+  }
+
+  if (sampling == 2) {
+    if (num_param > 3) {
+      PRINT_INPUT_ERROR("sampling mixing should have at most 1 more parameter.\n");
+    }
+    if (num_param == 3) {
+      double mixing_rate_tmp = 0.0;
+      if (!is_valid_real(param[2], &mixing_rate_tmp)) {
+        PRINT_INPUT_ERROR("minimal refresh rate should be a number.\n");
+      }
+      mixing_rate = mixing_rate_tmp;
+    }
+    if (mixing_rate <= 0.0f) {
+      PRINT_INPUT_ERROR("minimal refresh rate should > 0.");
+    } else if (mixing_rate > 1.0f) {
+      PRINT_INPUT_ERROR("minimal refresh rate should <= 1.");
+    }
+  } else if (num_param != 2) {
+    PRINT_INPUT_ERROR("sampling standard or mirrored should have no more parameter.\n");
+  }
+}
+
+void Parameters::parse_adaptive_population(const char** param, int num_param)
+{
+  is_adaptive_population_set = true;
+
+  if (num_param != 2) {
+    PRINT_INPUT_ERROR("adaptive_population should have 1 parameter.\n");
+  }
+  if (!is_valid_int(param[1], &min_population)) {
+    PRINT_INPUT_ERROR("minimal population size should be an integer.\n");
+  }
+  if (min_population < 4) {
+    PRINT_INPUT_ERROR("minimal population size should >= 4.");
+  }
+}
+
+void Parameters::parse_target_loss(const char** param, int num_param)
+{
+  is_target_loss_set = true;
+
+  if (num_param != 2) {
+    PRINT_INPUT_ERROR("target_loss should have 1 parameter.\n");
+  }
+  double target_loss_tmp = 0.0;
+  if (!is_valid_real(param[1], &target_loss_tmp)) {
+    PRINT_INPUT_ERROR("target loss should be a number.\n");
+  }
+  target_loss = target_loss_tmp;
+  if (target_loss <= 0.0f) {
+    PRINT_INPUT_ERROR("target loss should > 0.");
+  }
+}
+
+void Parameters::read_checkpoint_header()
+{
+  FILE* fid = fopen(CHECKPOINT_FILE, "rb");
+  if (fid == NULL) {
+    return; // nothing to resume from
+  }
+  Checkpoint_Header header;
+  size_t count = fread(&header, sizeof(Checkpoint_Header), 1, fid);
+  fclose(fid);
+  if (count != 1 || !header.is_valid()) {
+    PRINT_INPUT_ERROR("nep.checkpoint is corrupted or written by another version.");
+  }
+  if (header.number_of_variables != number_of_variables) {
+    PRINT_INPUT_ERROR("number of parameters in nep.checkpoint does not match nep.in.");
+  }
+  if (header.population_size != population_size) {
+    PRINT_INPUT_ERROR("population size in nep.checkpoint does not match nep.in.");
+  }
+  if (header.dim != dim) {
+    PRINT_INPUT_ERROR("descriptor dimension in nep.checkpoint does not match nep.in.");
+  }
+  if (header.generation > maximum_generation) {
+    PRINT_INPUT_ERROR("generation in nep.checkpoint is larger than the maximum generation.");
+  }
+  start_generation = header.generation;
+  shuffle_seed = header.shuffle_seed;
+}
+
+void Parameters::read_nep_txt(float* parameters)
+{
+  std::ifstream input("nep.txt");
+  if (!input.is_open()) {
+    PRINT_INPUT_ERROR("Failed to open nep.txt.");
+  }
+  std::vector<std::string> tokens;
+  tokens = get_tokens(input);
+  int num_lines_to_be_skipped = 5;
+  if (tokens[0] == "nep3_zbl" || tokens[0] == "nep4_zbl") {
+    num_lines_to_be_skipped = 6;
+  } else if (tokens[0] == "nep") {
+    num_lines_to_be_skipped = 4;
+  }
+  for (int n = 0; n < num_lines_to_be_skipped; ++n) {
+    tokens = get_tokens(input);
+  }
+  for (int n = 0; n < number_of_variables; ++n) {
+    tokens = get_tokens(input);
+    parameters[n] = get_float_from_token(tokens[0], __FILE__, __LINE__);
+  }
+  for (int d = 0; d < dim; ++d) {
+    tokens = get_tokens(input);
+    q_scaler_cpu[d] = get_float_from_token(tokens[0], __FILE__, __LINE__);
+  }
+}
@@ -52,7 +52,16 @@ public:
   float zbl_rc_inner;     // inner cutoff for the universal ZBL potential
   float zbl_rc_outer;     // outer cutoff for the universal ZBL potential
   int train_mode; // 0=potential, 1=dipole, 2=polarizability, 3=temperature-dependent free energy
-  int prediction; // 0=no, 1=yes
+  int prediction; // 0=no, 1=yes (on the GPU), 2=yes (on the CPU)
+  float neighbor_cache_memory; // maximum host memory (in MB) for caching neighbor lists
+  int checkpoint_interval;     // write nep.checkpoint every this many generations (0 = never)
+  int start_generation;        // first generation to be computed (> 0 when resuming)
+  unsigned int shuffle_seed;   // seed for shuffling the structures in train.xyz
+  int sampling;                // 0=plain, 1=mirrored, 2=importance mixing
+  float mixing_rate;           // minimal refresh rate of importance mixing
+  int min_population;          // minimal population size (0 = fixed population size)
+  int population_step;         // population sizes are multiples of this
+  float target_loss;           // report the fitness evaluations needed to reach this loss
 
   // check if a parameter has been set:
   bool is_train_mode_set;
@@ -76,6 +85,11 @@ public:
   bool is_type_weight_set;
   bool is_force_delta_set;
   bool is_zbl_set;
+  bool is_neighbor_cache_set;
+  bool is_checkpoint_set;
+  bool is_sampling_set;
+  bool is_adaptive_population_set;
+  bool is_target_loss_set;
 
   // other parameters
   int dim;                            // dimension of the descriptor vector
@@ -95,12 +109,16 @@ public:
 
   GPU_Vector<float> q_scaler_gpu[16]; // used to scale some descriptor components (GPU)
 
+  // read the model parameters and q_scaler_cpu from nep.txt (prediction mode)
+  void read_nep_txt(float* parameters);
+
 private:
   void set_default_parameters();
   void read_nep_in();
   void read_zbl_in();
   void calculate_parameters();
   void report_inputs();
+  void read_checkpoint_header();
 
   void parse_one_keyword(std::vector<std::string>& tokens);
 
@@ -125,4 +143,9 @@ private:
   void parse_batch(const char** param, int num_param);
   void parse_population(const char** param, int num_param);
   void parse_generation(const char** param, int num_param);
+  void parse_neighbor_cache(const char** param, int num_param);
+  void parse_checkpoint(const char** param, int num_param);
+  void parse_sampling(const char** param, int num_param);
+  void parse_adaptive_population(const char** param, int num_param);
+  void parse_target_loss(const char** param, int num_param);
 };
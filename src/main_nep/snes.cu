@@ -23,13 +23,27 @@ High Dimensions and Heavy Tails for Natural Evolution Strategies,
 https://doi.org/10.1145/2001576.2001692
 ------------------------------------------------------------------------------*/
 
+#include "checkpoint.cuh"
 #include "fitness.cuh"
 #include "parameters.cuh"
 #include "snes.cuh"
 #include "utilities/error.cuh"
+#include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <csignal>
+#include <cstdio>
 #include <iostream>
+#include <string>
+
+// constants for adapting the population size from the evolution path of mu
+const float PSA_CUMULATION = 0.1f; // decay rate of the evolution path
+const float PSA_THRESHOLD = 1.5f;  // ratio between the squared path length and its null value
+const float PSA_DAMPING = 0.1f;    // log change rate of the population size
+
+static volatile std::sig_atomic_t stop_requested = 0;
+
+static void handle_stop_signal(int) { stop_requested = 1; }
 
 static __global__ void initialize_curand_states(curandState* state, int N, int seed)
 {
@@ -44,6 +58,9 @@ SNES::SNES(Parameters& para, Fitness* fitness_function)
   maximum_generation = para.maximum_generation;
   number_of_variables = para.number_of_variables;
   population_size = para.population_size;
+  population_active = population_size;
+  population_real = population_size;
+  CHECK(cudaGetDeviceCount(&num_devices));
   const int N =  population_size * number_of_variables;
   int num = number_of_variables;
   if (para.version == 4) {
@@ -59,12 +76,21 @@ SNES::SNES(Parameters& para, Fitness* fitness_function)
   cost_L2reg.resize(population_size);
   utility.resize(population_size);
   type_of_variable.resize(number_of_variables, para.num_types);
+  evolution_path.resize(number_of_variables, 0.0f);
+  if (para.sampling == 2) {
+    population_old.resize(N);
+    population_trial.resize(N);
+    loss_old.resize(population_size * 3 * (para.num_types + 1));
+    mu_old.resize(number_of_variables);
+    sigma_old.resize(number_of_variables);
+    reused_from.resize(population_size);
+  }
   initialize_rng();
 
   cudaSetDevice(0); // normally use GPU-0
   gpu_type_of_variable.resize(number_of_variables);
   gpu_index.resize(population_size * (para.num_types + 1));
-  gpu_utility.resize(number_of_variables);
+  gpu_utility.resize(population_size);
   gpu_sigma.resize(number_of_variables);
   gpu_mu.resize(number_of_variables);
   gpu_cost_L1reg.resize(population_size);
@@ -122,12 +148,15 @@ void SNES::initialize_mu_and_sigma(Parameters& para)
 void SNES::calculate_utility()
 {
   float utility_sum = 0.0f;
-  for (int n = 0; n < population_size; ++n) {
-    utility[n] = std::max(0.0f, std::log(population_size * 0.5f + 1.0f) - std::log(n + 1.0f));
+  for (int n = 0; n < population_active; ++n) {
+    utility[n] = std::max(0.0f, std::log(population_active * 0.5f + 1.0f) - std::log(n + 1.0f));
     utility_sum += utility[n];
   }
-  for (int n = 0; n < population_size; ++n) {
-    utility[n] = utility[n] / utility_sum - 1.0f / population_size;
+  for (int n = 0; n < population_active; ++n) {
+    utility[n] = utility[n] / utility_sum - 1.0f / population_active;
+  }
+  for (int n = population_active; n < population_size; ++n) {
+    utility[n] = 0.0f;
   }
 }
 
@@ -240,9 +269,25 @@ void SNES::compute(Parameters& para, Fitness* fitness_function)
   }
 
   if (para.prediction == 0) {
-    for (int n = 0; n < maximum_generation; ++n) {
-      create_population(para);
-      fitness_function->compute(n, para, population.data(), fitness.data());
+    if (para.checkpoint_interval > 0) {
+      std::signal(SIGTERM, handle_stop_signal);
+    }
+    if (para.start_generation > 0) {
+      // build the neighbor lists, then restore q_scaler and the SNES state
+      fitness_function->compute(0, para, population_active, population.data(), fitness.data());
+      read_checkpoint(para);
+    }
+    for (int n = para.start_generation; n < maximum_generation; ++n) {
+      const int num_new = create_population(para, n);
+      const int num_evaluated =
+        std::min(population_active, (num_new - 1) / num_devices * num_devices + num_devices);
+      fitness_function->compute(n, para, num_evaluated, population.data(), fitness.data());
+      if (n > 0) {
+        num_evaluations += num_evaluated; // generation 0 only prepares the neighbor lists
+        if (para.sampling == 2) {
+          update_old_population(para, num_evaluated);
+        }
+      }
 
       if (para.version == 4) {
         regularize_NEP4(para);
@@ -256,6 +301,15 @@ void SNES::compute(Parameters& para, Fitness* fitness_function)
       float fitness_total = fitness[0 + (6 * para.num_types + 0) * population_size];
       float fitness_L1 = fitness[best_index + (6 * para.num_types + 1) * population_size];
       float fitness_L2 = fitness[best_index + (6 * para.num_types + 2) * population_size];
+      if (para.is_target_loss_set && !is_target_reached && n > 0 &&
+          fitness_total <= para.target_loss) {
+        is_target_reached = true;
+        printf(
+          "Reached the target loss %g in generation %d after %lld fitness evaluations.\n",
+          para.target_loss,
+          n + 1,
+          num_evaluations);
+      }
       fitness_function->report_error(
         para,
         n,
@@ -264,35 +318,35 @@ void SNES::compute(Parameters& para, Fitness* fitness_function)
         fitness_L2,
         population.data() + number_of_variables * best_index);
 
+      if (para.min_population > 0) {
+        cudaSetDevice(0); // normally use GPU-0
+        gpu_mu.copy_to_host(mu.data());
+        gpu_sigma.copy_to_host(sigma.data());
+      }
       update_mu_and_sigma();
+      if (para.min_population > 0) {
+        adapt_population_size(para);
+      }
       if (0 == (n + 1) % 100) {
         output_mu_and_sigma(para);
       }
+      if (para.checkpoint_interval > 0) {
+        if (stop_requested) {
+          write_checkpoint(para, n + 1);
+          printf("Stopped training after generation %d on SIGTERM.\n", n + 1);
+          break;
+        }
+        if (0 == (n + 1) % para.checkpoint_interval) {
+          write_checkpoint(para, n + 1);
+        }
+      }
     }
-  } else {
-    std::ifstream input("nep.txt");
-    if (!input.is_open()) {
-      PRINT_INPUT_ERROR("Failed to open nep.txt.");
-    }
-    std::vector<std::string> tokens;
-    tokens = get_tokens(input);
-    int num_lines_to_be_skipped = 5;
-    if (tokens[0] == "nep3_zbl" || tokens[0] == "nep4_zbl") {
-      num_lines_to_be_skipped = 6;
-    } else if (tokens[0] == "nep") {
-      num_lines_to_be_skipped = 4;
-    }
-    for (int n = 0; n < num_lines_to_be_skipped; ++n) {
-      tokens = get_tokens(input);
-    }
-    for (int n = 0; n < number_of_variables; ++n) {
-      tokens = get_tokens(input);
-      population[n] = get_float_from_token(tokens[0], __FILE__, __LINE__);
-    }
-    for (int d = 0; d < para.dim; ++d) {
-      tokens = get_tokens(input);
-      para.q_scaler_cpu[d] = get_float_from_token(tokens[0], __FILE__, __LINE__);
+    printf("Number of fitness evaluations = %lld.\n", num_evaluations);
+    if (para.is_target_loss_set && !is_target_reached) {
+      printf("The target loss %g has not been reached.\n", para.target_loss);
     }
+  } else {
+    para.read_nep_txt(population.data());
     para.q_scaler_gpu[0].copy_from_host(para.q_scaler_cpu.data());
     fitness_function->predict(para, population.data());
   }
@@ -318,20 +372,237 @@ static __global__ void gpu_create_population(
   }
 }
 
-void SNES::create_population(Parameters& para)
+static __global__ void gpu_create_population_mirrored(
+  const int N_half,
+  const int number_of_variables,
+  const float* g_mu,
+  const float* g_sigma,
+  curandState* g_state,
+  float* g_s,
+  float* g_population)
+{
+  int n = blockIdx.x * blockDim.x + threadIdx.x;
+  if (n < N_half) {
+    int v = n % number_of_variables;
+    curandState state = g_state[n];
+    float s = curand_normal(&state);
+    g_s[n] = s;
+    g_s[n + N_half] = -s;
+    g_population[n] = g_sigma[v] * s + g_mu[v];
+    g_population[n + N_half] = g_mu[v] - g_sigma[v] * s;
+    g_state[n] = state;
+  }
+}
+
+static __global__ void gpu_find_s(
+  const int N,
+  const int number_of_variables,
+  const float* g_mu,
+  const float* g_sigma,
+  const float* g_population,
+  float* g_s)
+{
+  int n = blockIdx.x * blockDim.x + threadIdx.x;
+  if (n < N) {
+    int v = n % number_of_variables;
+    const float sigma = g_sigma[v];
+    g_s[n] = (sigma > 0.0f) ? (g_population[n] - g_mu[v]) / sigma : 0.0f;
+  }
+}
+
+// log of the probability density of x, up to a constant
+static double find_log_density(
+  const int number_of_variables, const float* x, const float* mu, const float* sigma)
+{
+  double log_density = 0.0;
+  for (int v = 0; v < number_of_variables; ++v) {
+    if (sigma[v] > 0.0f) {
+      const double z = (x[v] - mu[v]) / sigma[v];
+      log_density -= std::log(sigma[v]) + 0.5 * z * z;
+    }
+  }
+  return log_density;
+}
+
+int SNES::create_population(Parameters& para, const int generation)
 {
+  if (para.sampling == 2 && num_old > 0) {
+    return create_population_with_mixing(para, generation);
+  }
+
   cudaSetDevice(0); // normally use GPU-0
-  const int N = population_size * number_of_variables;
-  gpu_create_population<<<(N - 1) / 128 + 1, 128>>>(
-    N, 
-    number_of_variables, 
-    gpu_mu.data(), 
-    gpu_sigma.data(), 
-    curand_states.data(), 
-    gpu_s.data(), 
-    gpu_population.data());
+  const int N = population_active * number_of_variables;
+  if (para.sampling == 1) {
+    gpu_create_population_mirrored<<<(N / 2 - 1) / 128 + 1, 128>>>(
+      N / 2,
+      number_of_variables,
+      gpu_mu.data(),
+      gpu_sigma.data(),
+      curand_states.data(),
+      gpu_s.data(),
+      gpu_population.data());
+  } else {
+    gpu_create_population<<<(N - 1) / 128 + 1, 128>>>(
+      N,
+      number_of_variables,
+      gpu_mu.data(),
+      gpu_sigma.data(),
+      curand_states.data(),
+      gpu_s.data(),
+      gpu_population.data());
+  }
   CUDA_CHECK_KERNEL
-  gpu_population.copy_to_host(population.data());
+  gpu_population.copy_to_host(population.data(), N);
+  if (para.sampling == 2) {
+    gpu_mu.copy_to_host(mu.data());
+    gpu_sigma.copy_to_host(sigma.data());
+    for (int p = 0; p < population_active; ++p) {
+      reused_from[p] = -1;
+    }
+  }
+  return population_active;
+}
+
+// Importance mixing: Y. Sun, D. Wierstra, T. Schaul, and J. Schmidhuber,
+// Efficient Natural Evolution Strategies, https://doi.org/10.1145/1569901.1569976
+// The new individuals are placed before the reused ones, which need no evaluation.
+int SNES::create_population_with_mixing(Parameters& para, const int generation)
+{
+  cudaSetDevice(0); // normally use GPU-0
+  gpu_mu.copy_to_host(mu.data());
+  gpu_sigma.copy_to_host(sigma.data());
+  rng.seed(para.shuffle_seed + generation); // reproducible after resuming from a checkpoint
+  std::uniform_real_distribution<double> r1(0, 1);
+
+  // keep an old individual with probability min(1, (1 - rate) * p_new / p_old)
+  std::vector<int> reused;
+  for (int i = 0; i < num_old && int(reused.size()) < population_active; ++i) {
+    const float* x = population_old.data() + i * number_of_variables;
+    const double log_ratio =
+      find_log_density(number_of_variables, x, mu.data(), sigma.data()) -
+      find_log_density(number_of_variables, x, mu_old.data(), sigma_old.data());
+    // the ratio is capped only to avoid overflow; any value above 1 / (1 - rate) means acceptance
+    if (r1(rng) < (1.0 - para.mixing_rate) * std::exp(std::min(log_ratio, 50.0))) {
+      reused.push_back(i);
+    }
+  }
+
+  // accept a new individual with probability max(rate, 1 - p_old / p_new)
+  const int num_new = population_active - reused.size();
+  const int N = population_active * number_of_variables;
+  int count = 0;
+  while (count < num_new) {
+    gpu_create_population<<<(N - 1) / 128 + 1, 128>>>(
+      N,
+      number_of_variables,
+      gpu_mu.data(),
+      gpu_sigma.data(),
+      curand_states.data(),
+      gpu_s.data(),
+      gpu_population.data());
+    CUDA_CHECK_KERNEL
+    gpu_population.copy_to_host(population_trial.data(), N);
+    for (int p = 0; p < population_active && count < num_new; ++p) {
+      const float* x = population_trial.data() + p * number_of_variables;
+      const double log_ratio =
+        find_log_density(number_of_variables, x, mu_old.data(), sigma_old.data()) -
+        find_log_density(number_of_variables, x, mu.data(), sigma.data());
+      if (r1(rng) < std::max(double(para.mixing_rate), 1.0 - std::exp(std::min(log_ratio, 0.0)))) {
+        std::copy(x, x + number_of_variables, population.data() + count * number_of_variables);
+        reused_from[count++] = -1;
+      }
+    }
+  }
+
+  for (int p = num_new; p < population_active; ++p) {
+    const int i = reused[p - num_new];
+    std::copy(
+      population_old.data() + i * number_of_variables,
+      population_old.data() + (i + 1) * number_of_variables,
+      population.data() + p * number_of_variables);
+    reused_from[p] = i;
+  }
+
+  gpu_population.copy_from_host(population.data(), N);
+  gpu_find_s<<<(N - 1) / 128 + 1, 128>>>(
+    N, number_of_variables, gpu_mu.data(), gpu_sigma.data(), gpu_population.data(), gpu_s.data());
+  CUDA_CHECK_KERNEL
+  return num_new;
+}
+
+void SNES::update_old_population(Parameters& para, const int num_evaluated)
+{
+  // the reused individuals that have not been evaluated again keep their losses
+  for (int p = num_evaluated; p < population_active; ++p) {
+    for (int t = 0; t <= para.num_types; ++t) {
+      for (int k = 0; k < 3; ++k) {
+        fitness[p + (6 * t + 3 + k) * population_size] =
+          loss_old[reused_from[p] + (3 * t + k) * population_size];
+      }
+    }
+  }
+
+  num_old = population_active;
+  std::copy(
+    population.begin(),
+    population.begin() + population_active * number_of_variables,
+    population_old.begin());
+  for (int p = 0; p < population_active; ++p) {
+    for (int t = 0; t <= para.num_types; ++t) {
+      for (int k = 0; k < 3; ++k) {
+        loss_old[p + (3 * t + k) * population_size] =
+          fitness[p + (6 * t + 3 + k) * population_size];
+      }
+    }
+  }
+  mu_old = mu;
+  sigma_old = sigma;
+}
+
+// Population size adaptation in the spirit of
+// K. Nishida and Y. Akimoto, PSA-CMA-ES, https://doi.org/10.1145/3205455.3205467
+// The step of mu normalized by its spread under random selection is accumulated in an evolution
+// path, whose squared length per variable is about 1 without selection signal. A long path means
+// a strong signal and the population shrinks; a short path means a weak signal and it grows.
+void SNES::adapt_population_size(Parameters& para)
+{
+  std::vector<float> mu_new(number_of_variables);
+  cudaSetDevice(0); // normally use GPU-0
+  gpu_mu.copy_to_host(mu_new.data());
+
+  double utility_norm = 0.0;
+  for (int p = 0; p < population_active; ++p) {
+    utility_norm += utility[p] * utility[p];
+  }
+  utility_norm = sqrt(utility_norm);
+
+  const double c = PSA_CUMULATION;
+  double path_length_square = 0.0;
+  int count = 0;
+  for (int v = 0; v < number_of_variables; ++v) {
+    if (sigma[v] > 0.0f) {
+      const double step = (mu_new[v] - mu[v]) / (sigma[v] * utility_norm);
+      evolution_path[v] = (1.0 - c) * evolution_path[v] + sqrt(c * (2.0 - c)) * step;
+      path_length_square += evolution_path[v] * evolution_path[v];
+      ++count;
+    }
+  }
+  if (count == 0) {
+    return;
+  }
+
+  const double ratio = path_length_square / count;
+  population_real *= std::exp(PSA_DAMPING * (1.0 - ratio / PSA_THRESHOLD));
+  population_real =
+    std::min(std::max(population_real, float(para.min_population)), float(population_size));
+
+  const int step = para.population_step;
+  int population_new = int(population_real / step + 0.5f) * step;
+  population_new = std::min(std::max(population_new, para.min_population), population_size);
+  if (population_new != population_active) {
+    population_active = population_new;
+    calculate_utility();
+  }
 }
 
 static __global__ void gpu_find_L1_L2_NEP4(
@@ -390,7 +661,7 @@ void SNES::regularize_NEP4(Parameters& para)
       num_variables = para.number_of_variables;
     }
     
-    gpu_find_L1_L2_NEP4<<<population_size, 1024>>>(
+    gpu_find_L1_L2_NEP4<<<population_active, 1024>>>(
       number_of_variables, 
       para.num_types,
       t, 
@@ -403,7 +674,7 @@ void SNES::regularize_NEP4(Parameters& para)
     gpu_cost_L1reg.copy_to_host(cost_L1reg.data());
     gpu_cost_L2reg.copy_to_host(cost_L2reg.data());
 
-    for (int p = 0; p < population_size; ++p) {
+    for (int p = 0; p < population_active; ++p) {
       float cost_L1 = para.lambda_1 * cost_L1reg[p] / num_variables;
       float cost_L2 = para.lambda_2 * sqrt(cost_L2reg[p] / num_variables);
       fitness[p + (6 * t + 0) * population_size] =
@@ -459,13 +730,13 @@ static __global__ void gpu_find_L1_L2(
 void SNES::regularize(Parameters& para)
 {
   cudaSetDevice(0); // normally use GPU-0
-  gpu_find_L1_L2<<<population_size, 1024>>>(
+  gpu_find_L1_L2<<<population_active, 1024>>>(
     number_of_variables, gpu_population.data(), gpu_cost_L1reg.data(), gpu_cost_L2reg.data());
   CUDA_CHECK_KERNEL
   gpu_cost_L1reg.copy_to_host(cost_L1reg.data());
   gpu_cost_L2reg.copy_to_host(cost_L2reg.data());
 
-  for (int p = 0; p < population_size; ++p) {
+  for (int p = 0; p < population_active; ++p) {
     float cost_L1 = para.lambda_1 * cost_L1reg[p] / number_of_variables;
     float cost_L2 = para.lambda_2 * sqrt(cost_L2reg[p] / number_of_variables);
 
@@ -497,19 +768,20 @@ static void insertion_sort(float array[], int index[], int n)
 void SNES::sort_population(Parameters& para)
 {
   for (int t = 0; t < para.num_types + 1; ++t) {
-    for (int n = 0; n < population_size; ++n) {
+    for (int n = 0; n < population_active; ++n) {
       index[t * population_size + n] = n;
     }
 
     insertion_sort(
       fitness.data() + t * population_size * 6,
       index.data() + t * population_size,
-      population_size);
+      population_active);
   }
 }
 
 static __global__ void gpu_update_mu_and_sigma(
   const int population_size,
+  const int population_active,
   const int number_of_variables,
   const float eta_sigma,
   const int* g_type_of_variable,
@@ -523,7 +795,7 @@ static __global__ void gpu_update_mu_and_sigma(
   if (v < number_of_variables) {
     const int type = g_type_of_variable[v];
     float gradient_mu = 0.0f, gradient_sigma = 0.0f;
-    for (int p = 0; p < population_size; ++p) {
+    for (int p = 0; p < population_active; ++p) {
       const int pv = g_index[type * population_size + p] * number_of_variables + v;
       const float utility = g_utility[p];
       const float s = g_s[pv];
@@ -544,6 +816,7 @@ void SNES::update_mu_and_sigma()
   gpu_utility.copy_from_host(utility.data());
   gpu_update_mu_and_sigma<<<(number_of_variables - 1) / 128 + 1, 128>>>(
     population_size,
+    population_active,
     number_of_variables,
     eta_sigma,
     gpu_type_of_variable.data(),
@@ -566,3 +839,123 @@ void SNES::output_mu_and_sigma(Parameters& para)
   }
   fclose(fid_restart);
 }
+
+void SNES::write_checkpoint(Parameters& para, const int generation)
+{
+  int deviceCount;
+  CHECK(cudaGetDeviceCount(&deviceCount));
+
+  Checkpoint_Header header;
+  header.number_of_variables = number_of_variables;
+  header.population_size = population_size;
+  header.dim = para.dim;
+  header.num_devices = deviceCount;
+  header.generation = generation;
+  header.population_active = population_active;
+  header.population_real = population_real;
+  header.num_evaluations = num_evaluations;
+  header.shuffle_seed = para.shuffle_seed;
+  header.size_of_rng_state = sizeof(curandState);
+  header.num_rng_states = curand_states.size();
+  header.sampling = para.sampling;
+  header.num_old = num_old;
+
+  std::vector<float> q_scaler(deviceCount * para.dim);
+  for (int device_id = 0; device_id < deviceCount; ++device_id) {
+    CHECK(cudaSetDevice(device_id));
+    para.q_scaler_gpu[device_id].copy_to_host(q_scaler.data() + device_id * para.dim);
+  }
+  CHECK(cudaSetDevice(0)); // normally use GPU-0
+  gpu_mu.copy_to_host(mu.data());
+  gpu_sigma.copy_to_host(sigma.data());
+  std::vector<curandState> states(curand_states.size());
+  curand_states.copy_to_host(states.data());
+
+  // write to a temporary file first such that an interruption never leaves a broken checkpoint
+  std::string filename_tmp = std::string(CHECKPOINT_FILE) + ".tmp";
+  FILE* fid = my_fopen(filename_tmp.c_str(), "wb");
+  bool ok = fwrite(&header, sizeof(Checkpoint_Header), 1, fid) == 1;
+  ok = ok && fwrite(mu.data(), sizeof(float), mu.size(), fid) == mu.size();
+  ok = ok && fwrite(sigma.data(), sizeof(float), sigma.size(), fid) == sigma.size();
+  ok = ok && fwrite(q_scaler.data(), sizeof(float), q_scaler.size(), fid) == q_scaler.size();
+  ok = ok && fwrite(evolution_path.data(), sizeof(float), evolution_path.size(), fid) ==
+               evolution_path.size();
+  ok = ok && fwrite(states.data(), sizeof(curandState), states.size(), fid) == states.size();
+  if (para.sampling == 2) {
+    ok = ok && fwrite(population_old.data(), sizeof(float), population_old.size(), fid) ==
+                 population_old.size();
+    ok = ok && fwrite(loss_old.data(), sizeof(float), loss_old.size(), fid) == loss_old.size();
+    ok = ok && fwrite(mu_old.data(), sizeof(float), mu_old.size(), fid) == mu_old.size();
+    ok = ok && fwrite(sigma_old.data(), sizeof(float), sigma_old.size(), fid) == sigma_old.size();
+  }
+  ok = (fflush(fid) == 0) && ok;
+  fclose(fid);
+  if (!ok) {
+    PRINT_INPUT_ERROR("Failed to write nep.checkpoint.tmp.");
+  }
+#ifdef _WIN32
+  remove(CHECKPOINT_FILE); // rename does not overwrite an existing file on Windows
+#endif
+  if (rename(filename_tmp.c_str(), CHECKPOINT_FILE) != 0) {
+    PRINT_INPUT_ERROR("Failed to rename nep.checkpoint.tmp to nep.checkpoint.");
+  }
+}
+
+void SNES::read_checkpoint(Parameters& para)
+{
+  int deviceCount;
+  CHECK(cudaGetDeviceCount(&deviceCount));
+
+  FILE* fid = my_fopen(CHECKPOINT_FILE, "rb");
+  Checkpoint_Header header;
+  bool ok = fread(&header, sizeof(Checkpoint_Header), 1, fid) == 1;
+  if (!ok || header.size_of_rng_state != sizeof(curandState) ||
+      header.num_rng_states != (int)curand_states.size()) {
+    PRINT_INPUT_ERROR("nep.checkpoint is not compatible with this nep executable.");
+  }
+
+  std::vector<float> q_scaler(header.num_devices * para.dim);
+  std::vector<curandState> states(curand_states.size());
+  ok = fread(mu.data(), sizeof(float), mu.size(), fid) == mu.size();
+  ok = ok && fread(sigma.data(), sizeof(float), sigma.size(), fid) == sigma.size();
+  ok = ok && fread(q_scaler.data(), sizeof(float), q_scaler.size(), fid) == q_scaler.size();
+  ok = ok && fread(evolution_path.data(), sizeof(float), evolution_path.size(), fid) ==
+               evolution_path.size();
+  ok = ok && fread(states.data(), sizeof(curandState), states.size(), fid) == states.size();
+  // without the importance-mixing state, the first generation is created without reusing
+  if (para.sampling == 2 && header.sampling == 2) {
+    ok = ok && fread(population_old.data(), sizeof(float), population_old.size(), fid) ==
+                 population_old.size();
+    ok = ok && fread(loss_old.data(), sizeof(float), loss_old.size(), fid) == loss_old.size();
+    ok = ok && fread(mu_old.data(), sizeof(float), mu_old.size(), fid) == mu_old.size();
+    ok = ok && fread(sigma_old.data(), sizeof(float), sigma_old.size(), fid) == sigma_old.size();
+    num_old = std::min(header.num_old, population_size);
+  }
+  fclose(fid);
+  if (!ok) {
+    PRINT_INPUT_ERROR("nep.checkpoint is truncated.");
+  }
+
+  // with a different number of GPUs, keep the q_scaler just calculated from the training set
+  if (header.num_devices == deviceCount) {
+    for (int device_id = 0; device_id < deviceCount; ++device_id) {
+      CHECK(cudaSetDevice(device_id));
+      para.q_scaler_gpu[device_id].copy_from_host(q_scaler.data() + device_id * para.dim);
+    }
+  } else {
+    printf("The number of GPUs differs from that in nep.checkpoint; q_scaler is recalculated.\n");
+  }
+  CHECK(cudaSetDevice(0)); // normally use GPU-0
+  gpu_mu.copy_from_host(mu.data());
+  gpu_sigma.copy_from_host(sigma.data());
+  curand_states.copy_from_host(states.data());
+
+  num_evaluations = header.num_evaluations;
+  if (para.min_population > 0 && header.population_active >= para.min_population &&
+      header.population_active <= population_size &&
+      header.population_active % para.population_step == 0) {
+    population_active = header.population_active;
+    population_real = header.population_real;
+    calculate_utility();
+  }
+}
@@ -32,6 +32,12 @@ protected:
   int number_of_variables = 10;
   int population_size = 20;
   float eta_sigma = 0.1f;
+  int num_devices = 1;            // number of GPUs
+  int population_active = 20;     // current population size (<= population_size)
+  float population_real = 20.0f;  // unrounded population size (adaptive population size)
+  int num_old = 0;                // number of evaluated individuals of the last generation
+  long long num_evaluations = 0;  // number of fitness evaluations so far
+  bool is_target_reached = false; // if the target loss has been reached
   
   std::vector<int> index;
   std::vector<float> fitness;
@@ -42,6 +48,13 @@ protected:
   std::vector<float> cost_L1reg;
   std::vector<float> cost_L2reg;
   std::vector<int> type_of_variable;
+  std::vector<float> population_old;   // evaluated individuals of the last generation
+  std::vector<float> population_trial; // trial individuals for importance mixing
+  std::vector<float> loss_old;         // RMSE losses of population_old
+  std::vector<float> mu_old;           // mean of the distribution sampling population_old
+  std::vector<float> sigma_old;        // standard deviation of the same distribution
+  std::vector<int> reused_from;        // index in population_old of each reused individual
+  std::vector<float> evolution_path;   // accumulated normalized steps of mu
 
   GPU_Vector<curandState> curand_states;
   GPU_Vector<int> gpu_type_of_variable;
@@ -59,10 +72,15 @@ protected:
   void calculate_utility();
   void find_type_of_variable(Parameters& para);
   void compute(Parameters&, Fitness*);
-  void create_population(Parameters&);
+  int create_population(Parameters&, const int generation);
+  int create_population_with_mixing(Parameters& para, const int generation);
+  void update_old_population(Parameters& para, const int num_evaluated);
+  void adapt_population_size(Parameters& para);
   void regularize(Parameters&);
   void regularize_NEP4(Parameters& para);
   void sort_population(Parameters& para);
   void update_mu_and_sigma();
   void output_mu_and_sigma(Parameters& para);
+  void write_checkpoint(Parameters& para, const int generation);
+  void read_checkpoint(Parameters& para);
 };
@@ -18,7 +18,7 @@
 #include "utilities/error.cuh"
 #include <algorithm>
 #include <cctype>
-#include <chrono>
+#include <climits>
 #include <fstream>
 #include <iostream>
 #include <iterator>
@@ -417,14 +417,9 @@ read_exyz(const Parameters& para, std::ifstream& input, std::vector<Structure>&
   }
 }
 
-static void find_permuted_indices(std::vector<int>& permuted_indices)
+static void find_permuted_indices(const unsigned int seed, std::vector<int>& permuted_indices)
 {
-  std::mt19937 rng;
-#ifdef DEBUG
-  rng = std::mt19937(54321);
-#else
-  rng = std::mt19937(std::chrono::system_clock::now().time_since_epoch().count());
-#endif
+  std::mt19937 rng(seed);
   for (int i = 0; i < permuted_indices.size(); ++i) {
     permuted_indices[i] = i;
   }
@@ -437,10 +432,10 @@ static void find_permuted_indices(std::vector<int>& permuted_indices)
   }
 }
 
-static void reorder(std::vector<Structure>& structures)
+static void reorder(const unsigned int seed, std::vector<Structure>& structures)
 {
   std::vector<int> configuration_id(structures.size());
-  find_permuted_indices(configuration_id);
+  find_permuted_indices(seed, configuration_id);
 
   std::vector<Structure> structures_copy(structures.size());
 
@@ -540,7 +535,7 @@ bool read_structures(bool is_train, Parameters& para, std::vector<Structure>& st
   }
 
   if ((para.prediction == 0) && is_train && (para.batch_size < structures.size())) {
-    reorder(structures);
+    reorder(para.shuffle_seed, structures);
   }
 
   return has_test_set;
@@ -0,0 +1,44 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Convert an extended XYZ model file into the binary model file (model.bin) which
+can be read by gpumd in place of model.xyz:
+    xyz2bin [input.xyz] [output.bin]
+The default input and output files are model.xyz and model.bin.
+------------------------------------------------------------------------------*/
+
+#include "model/read_xyz.cuh"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char* argv[])
+{
+  if (argc > 3) {
+    printf("Usage: xyz2bin [input.xyz] [output.bin]\n");
+    return EXIT_FAILURE;
+  }
+  const char* filename_xyz = (argc > 1) ? argv[1] : "model.xyz";
+  const char* filename_binary = (argc > 2) ? argv[2] : "model.bin";
+
+  const auto time_begin = std::chrono::high_resolution_clock::now();
+  convert_xyz_to_binary(filename_xyz, filename_binary);
+  const auto time_finish = std::chrono::high_resolution_clock::now();
+  const std::chrono::duration<double> time_used = time_finish - time_begin;
+  printf("Time used = %f s.\n", time_used.count());
+
+  return EXIT_SUCCESS;
+}
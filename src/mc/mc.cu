@@ -30,7 +30,11 @@ void MC::initialize(void)
   // todo
 }
 
-void MC::finalize(void) { do_mcmd = false; }
+void MC::finalize(void)
+{
+  do_mcmd = false;
+  batch_size = 1;
+}
 
 void MC::compute(int step, int num_steps, Atom& atom, Box& box, std::vector<Group>& group)
 {
@@ -304,12 +308,32 @@ void MC::parse_mc(const char** param, int num_param, std::vector<Group>& groups,
     num_param_before_group = 8 + num_types_mc * 2;
   }
 
-  if (num_param > num_param_before_group) {
-    if (num_param != num_param_before_group + 3) {
-      PRINT_INPUT_ERROR("reading error grouping method.\n");
+  for (int k = num_param_before_group; k < num_param;) {
+    if (strcmp(param[k], "group") == 0) {
+      if (num_param < k + 3) {
+        PRINT_INPUT_ERROR("reading error grouping method.\n");
+      }
+      parse_group(param, num_param, groups, k);
+      printf("    only for atoms in group %d of grouping method %d.\n", group_id, grouping_method);
+      k += 3;
+    } else if (strcmp(param[k], "batch") == 0) {
+      if (num_param < k + 2) {
+        PRINT_INPUT_ERROR("reading error for batch size of MCMD.\n");
+      }
+      if (!is_valid_int(param[k + 1], &batch_size)) {
+        PRINT_INPUT_ERROR("batch size of MCMD should be an integer.\n");
+      }
+      if (batch_size <= 0) {
+        PRINT_INPUT_ERROR("batch size of MCMD should be positive.\n");
+      }
+      if (mc_ensemble_type == 2 && batch_size > 1) {
+        PRINT_INPUT_ERROR("batched trials are not supported for VCSGC MCMD.\n");
+      }
+      printf("    with up to %d non-interacting trials in each batch.\n", batch_size);
+      k += 2;
+    } else {
+      PRINT_INPUT_ERROR("unrecognized option for MCMD.\n");
     }
-    parse_group(param, num_param, groups, num_param_before_group);
-    printf("    only for atoms in group %d of grouping method %d.\n", group_id, grouping_method);
   }
 
   types.resize(num_types_mc);
@@ -317,15 +341,33 @@ void MC::parse_mc(const char** param, int num_param, std::vector<Group>& groups,
   std::fill(num_atoms_species.begin(), num_atoms_species.end(), 0);
   if (mc_ensemble_type == 0) {
     check_species_canonical(groups, atom);
-    mc_ensemble.reset(new MC_Ensemble_Canonical(param, num_param, num_steps_mc));
+    mc_ensemble.reset(new MC_Ensemble_Canonical(param, num_param, num_steps_mc, batch_size));
   } else if (mc_ensemble_type == 1) {
     check_species_sgc(groups, atom);
     mc_ensemble.reset(new MC_Ensemble_SGC(
-      param, num_param, num_steps_mc, false, species, types, num_atoms_species, mu_or_phi, kappa));
+      param,
+      num_param,
+      num_steps_mc,
+      batch_size,
+      false,
+      species,
+      types,
+      num_atoms_species,
+      mu_or_phi,
+      kappa));
   } else if (mc_ensemble_type == 2) {
     check_species_sgc(groups, atom);
     mc_ensemble.reset(new MC_Ensemble_SGC(
-      param, num_param, num_steps_mc, true, species, types, num_atoms_species, mu_or_phi, kappa));
+      param,
+      num_param,
+      num_steps_mc,
+      batch_size,
+      true,
+      species,
+      types,
+      num_atoms_species,
+      mu_or_phi,
+      kappa));
   }
 
   do_mcmd = true;
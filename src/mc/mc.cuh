@@ -41,6 +41,7 @@ private:
   int num_types_mc = 0;
   int grouping_method = -1;
   int group_id = -1;
+  int batch_size = 1;
   double temperature_initial = 0.0;
   double temperature_final = 0.0;
   double kappa = 0.0;
@@ -17,6 +17,7 @@
 The abstract base class (ABC) for the MC_Ensemble classes.
 ------------------------------------------------------------------------------*/
 
+#include "force/neighbor.cuh"
 #include "mc_ensemble.cuh"
 #include "utilities/common.cuh"
 #include <chrono>
@@ -124,4 +125,363 @@ bool MC_Ensemble::check_if_small_box(const double rc, const Box& box)
     is_small_box = true;
   }
   return is_small_box;
-}
\ No newline at end of file
+}
+static __global__ void gpu_set_new_types(
+  const int num_sites, const int* g_sites, const int* g_new_types, int* g_type_after)
+{
+  int s = blockIdx.x * blockDim.x + threadIdx.x;
+  if (s < num_sites) {
+    g_type_after[g_sites[s]] = g_new_types[s];
+  }
+}
+
+// one thread for each site and each of its neighbor slots (slot 0 is the site itself)
+static __global__ void gpu_find_local_atoms(
+  const int N,
+  const int num_sites,
+  const int num_sites_per_trial,
+  const int max_neighbors,
+  const int* g_sites,
+  const int* g_NN,
+  const int* g_NL,
+  int* g_trial_of_atom,
+  int* g_num_local,
+  int* g_NL_local,
+  int* g_trial_of_local)
+{
+  int index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (index < num_sites * (max_neighbors + 1)) {
+    int s = index / (max_neighbors + 1);
+    int m = index % (max_neighbors + 1);
+    int site = g_sites[s];
+    int n = -1;
+    if (m == 0) {
+      n = site;
+    } else if (m - 1 < g_NN[site]) {
+      n = g_NL[(m - 1) * N + site];
+    }
+    if (n >= 0) {
+      int trial = s / num_sites_per_trial;
+      // an atom close to several sites of the same trial is counted once
+      if (atomicCAS(&g_trial_of_atom[n], -1, trial) == -1) {
+        int k = atomicAdd(g_num_local, 1);
+        g_NL_local[k] = n;
+        g_trial_of_local[k] = trial;
+      }
+    }
+  }
+}
+
+static __global__ void gpu_create_inputs_batch(
+  const int N,
+  const int N_local,
+  const int* g_NL_local,
+  const int* g_NN,
+  const int* g_NL,
+  const Box box,
+  const float rc_angular_square,
+  const double* __restrict__ g_x,
+  const double* __restrict__ g_y,
+  const double* __restrict__ g_z,
+  const int* g_type_before,
+  const int* g_type_after,
+  int* g_local_type_before,
+  int* g_local_type_after,
+  int* g_NN_radial,
+  int* g_NN_angular,
+  int* g_t2_radial_before,
+  int* g_t2_radial_after,
+  int* g_t2_angular_before,
+  int* g_t2_angular_after,
+  float* g_x12_radial,
+  float* g_y12_radial,
+  float* g_z12_radial,
+  float* g_x12_angular,
+  float* g_y12_angular,
+  float* g_z12_angular)
+{
+  int k = blockIdx.x * blockDim.x + threadIdx.x;
+  if (k < N_local) {
+    int n1 = g_NL_local[k];
+    g_local_type_before[k] = g_type_before[n1];
+    g_local_type_after[k] = g_type_after[n1];
+    double x1 = g_x[n1];
+    double y1 = g_y[n1];
+    double z1 = g_z[n1];
+    int count_radial = 0;
+    int count_angular = 0;
+    for (int i1 = 0; i1 < g_NN[n1]; ++i1) {
+      int n2 = g_NL[i1 * N + n1];
+      double x12 = g_x[n2] - x1;
+      double y12 = g_y[n2] - y1;
+      double z12 = g_z[n2] - z1;
+      apply_mic(box, x12, y12, z12);
+      float distance_square = float(x12 * x12 + y12 * y12 + z12 * z12);
+      int index_radial = count_radial++ * N_local + k;
+      g_t2_radial_before[index_radial] = g_type_before[n2];
+      g_t2_radial_after[index_radial] = g_type_after[n2];
+      g_x12_radial[index_radial] = float(x12);
+      g_y12_radial[index_radial] = float(y12);
+      g_z12_radial[index_radial] = float(z12);
+      if (distance_square < rc_angular_square) {
+        int index_angular = count_angular++ * N_local + k;
+        g_t2_angular_before[index_angular] = g_type_before[n2];
+        g_t2_angular_after[index_angular] = g_type_after[n2];
+        g_x12_angular[index_angular] = float(x12);
+        g_y12_angular[index_angular] = float(y12);
+        g_z12_angular[index_angular] = float(z12);
+      }
+    }
+    g_NN_radial[k] = count_radial;
+    g_NN_angular[k] = count_angular;
+  }
+}
+
+static __global__ void gpu_sum_energy_change(
+  const int N_local,
+  const int* g_NL_local,
+  const int* g_trial_of_local,
+  const float* g_pe_before,
+  const float* g_pe_after,
+  int* g_trial_of_atom,
+  float* g_energy_change)
+{
+  int k = blockIdx.x * blockDim.x + threadIdx.x;
+  if (k < N_local) {
+    atomicAdd(&g_energy_change[g_trial_of_local[k]], g_pe_after[k] - g_pe_before[k]);
+    g_trial_of_atom[g_NL_local[k]] = -1;
+  }
+}
+
+static __global__ void gpu_finish_batch(
+  const int num_sites,
+  const int num_sites_per_trial,
+  const int* g_sites,
+  const int* g_accepted,
+  int* g_type,
+  int* g_type_after)
+{
+  int s = blockIdx.x * blockDim.x + threadIdx.x;
+  if (s < num_sites) {
+    int n = g_sites[s];
+    if (g_accepted[s / num_sites_per_trial]) {
+      g_type[n] = g_type_after[n];
+    } else {
+      g_type_after[n] = g_type[n];
+    }
+  }
+}
+
+void MC_Ensemble::resize_local_arrays(const int N_local)
+{
+  if (local_type_before.size() < N_local) {
+    NN_radial.resize(N_local);
+    NN_angular.resize(N_local);
+    local_type_before.resize(N_local);
+    local_type_after.resize(N_local);
+    pe_before.resize(N_local);
+    pe_after.resize(N_local);
+  }
+  const int size_radial = N_local * nep_energy.paramb.MN_radial;
+  if (x12_radial.size() < size_radial) {
+    t2_radial_before.resize(size_radial);
+    t2_radial_after.resize(size_radial);
+    x12_radial.resize(size_radial);
+    y12_radial.resize(size_radial);
+    z12_radial.resize(size_radial);
+  }
+  const int size_angular = N_local * nep_energy.paramb.MN_angular;
+  if (x12_angular.size() < size_angular) {
+    t2_angular_before.resize(size_angular);
+    t2_angular_after.resize(size_angular);
+    x12_angular.resize(size_angular);
+    y12_angular.resize(size_angular);
+    z12_angular.resize(size_angular);
+  }
+}
+
+void MC_Ensemble::prepare_batch(Atom& atom, Box& box)
+{
+  const int N = atom.number_of_atoms;
+  if (NN_atom.size() != N) {
+    NN_atom.resize(N);
+    NL_atom.resize(N * nep_energy.paramb.MN_radial);
+    cell_count.resize(N);
+    cell_count_sum.resize(N);
+    cell_contents.resize(N);
+    trial_of_atom.resize(N, -1);
+  }
+  if (batch_accepted.size() < batch_size) {
+    const int max_sites = batch_size * 2;
+    batch_sites.resize(max_sites);
+    batch_new_types.resize(max_sites);
+    batch_accepted.resize(batch_size);
+    energy_change.resize(batch_size);
+    num_local.resize(1);
+    NL_local.resize(max_sites * (nep_energy.paramb.MN_radial + 1));
+    trial_of_local.resize(max_sites * (nep_energy.paramb.MN_radial + 1));
+    cpu_batch_sites.reserve(max_sites);
+    cpu_batch_new_types.reserve(max_sites);
+    cpu_batch_accepted.resize(batch_size);
+    cpu_energy_change.resize(batch_size);
+  }
+
+  // the positions do not change during the MC trials
+  find_neighbor(
+    0,
+    N,
+    nep_energy.paramb.rc_radial,
+    box,
+    atom.type,
+    atom.position_per_atom,
+    cell_count,
+    cell_count_sum,
+    cell_contents,
+    NN_atom,
+    NL_atom);
+  atom.position_per_atom.copy_to_host(atom.cpu_position_per_atom.data());
+  type_after.copy_from_device(atom.type.data(), N);
+}
+
+// Two trials do not interact if their sites are at least 2 rc apart, as no atom is then
+// within the cutoff of both. Their energy changes are additive and they can be accepted or
+// rejected independently, which preserves detailed balance [Sadigh2012a].
+bool MC_Ensemble::is_far_from_batch(const Atom& atom, const Box& box, const int n)
+{
+  const int N = atom.number_of_atoms;
+  const double* x = atom.cpu_position_per_atom.data();
+  const double* y = x + N;
+  const double* z = x + N * 2;
+  const double min_distance = 2.0 * nep_energy.paramb.rc_radial;
+  const double min_distance_square = min_distance * min_distance;
+  for (int s = 0; s < cpu_batch_sites.size(); ++s) {
+    const int m = cpu_batch_sites[s];
+    double x12 = x[m] - x[n];
+    double y12 = y[m] - y[n];
+    double z12 = z[m] - z[n];
+    apply_mic(box, x12, y12, z12);
+    if (x12 * x12 + y12 * y12 + z12 * z12 < min_distance_square) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void MC_Ensemble::find_energy_change_batch(
+  Atom& atom, Box& box, const int num_trials, const int num_sites_per_trial)
+{
+  const int N = atom.number_of_atoms;
+  const int num_sites = num_trials * num_sites_per_trial;
+  batch_sites.copy_from_host(cpu_batch_sites.data(), num_sites);
+  batch_new_types.copy_from_host(cpu_batch_new_types.data(), num_sites);
+
+  gpu_set_new_types<<<(num_sites - 1) / 64 + 1, 64>>>(
+    num_sites, batch_sites.data(), batch_new_types.data(), type_after.data());
+  CUDA_CHECK_KERNEL
+
+  const int max_neighbors = nep_energy.paramb.MN_radial;
+  CHECK(cudaMemset(num_local.data(), 0, sizeof(int)));
+  gpu_find_local_atoms<<<(num_sites * (max_neighbors + 1) - 1) / 64 + 1, 64>>>(
+    N,
+    num_sites,
+    num_sites_per_trial,
+    max_neighbors,
+    batch_sites.data(),
+    NN_atom.data(),
+    NL_atom.data(),
+    trial_of_atom.data(),
+    num_local.data(),
+    NL_local.data(),
+    trial_of_local.data());
+  CUDA_CHECK_KERNEL
+
+  int N_local;
+  num_local.copy_to_host(&N_local);
+  resize_local_arrays(N_local);
+
+  gpu_create_inputs_batch<<<(N_local - 1) / 64 + 1, 64>>>(
+    N,
+    N_local,
+    NL_local.data(),
+    NN_atom.data(),
+    NL_atom.data(),
+    box,
+    nep_energy.paramb.rc_angular * nep_energy.paramb.rc_angular,
+    atom.position_per_atom.data(),
+    atom.position_per_atom.data() + N,
+    atom.position_per_atom.data() + N * 2,
+    atom.type.data(),
+    type_after.data(),
+    local_type_before.data(),
+    local_type_after.data(),
+    NN_radial.data(),
+    NN_angular.data(),
+    t2_radial_before.data(),
+    t2_radial_after.data(),
+    t2_angular_before.data(),
+    t2_angular_after.data(),
+    x12_radial.data(),
+    y12_radial.data(),
+    z12_radial.data(),
+    x12_angular.data(),
+    y12_angular.data(),
+    z12_angular.data());
+  CUDA_CHECK_KERNEL
+
+  nep_energy.find_energy(
+    N_local,
+    NN_radial.data(),
+    NN_angular.data(),
+    local_type_before.data(),
+    t2_radial_before.data(),
+    t2_angular_before.data(),
+    x12_radial.data(),
+    y12_radial.data(),
+    z12_radial.data(),
+    x12_angular.data(),
+    y12_angular.data(),
+    z12_angular.data(),
+    pe_before.data());
+
+  nep_energy.find_energy(
+    N_local,
+    NN_radial.data(),
+    NN_angular.data(),
+    local_type_after.data(),
+    t2_radial_after.data(),
+    t2_angular_after.data(),
+    x12_radial.data(),
+    y12_radial.data(),
+    z12_radial.data(),
+    x12_angular.data(),
+    y12_angular.data(),
+    z12_angular.data(),
+    pe_after.data());
+
+  CHECK(cudaMemset(energy_change.data(), 0, sizeof(float) * num_trials));
+  gpu_sum_energy_change<<<(N_local - 1) / 64 + 1, 64>>>(
+    N_local,
+    NL_local.data(),
+    trial_of_local.data(),
+    pe_before.data(),
+    pe_after.data(),
+    trial_of_atom.data(),
+    energy_change.data());
+  CUDA_CHECK_KERNEL
+
+  energy_change.copy_to_host(cpu_energy_change.data(), num_trials);
+}
+
+void MC_Ensemble::finish_batch(Atom& atom, const int num_trials, const int num_sites_per_trial)
+{
+  const int num_sites = num_trials * num_sites_per_trial;
+  batch_accepted.copy_from_host(cpu_batch_accepted.data(), num_trials);
+  gpu_finish_batch<<<(num_sites - 1) / 64 + 1, 64>>>(
+    num_sites,
+    num_sites_per_trial,
+    batch_sites.data(),
+    batch_accepted.data(),
+    atom.type.data(),
+    type_after.data());
+  CUDA_CHECK_KERNEL
+}
@@ -41,6 +41,7 @@ public:
 
 protected:
   int num_steps_mc = 0;
+  int batch_size = 1;
   double temperature = 0.0;
   std::mt19937 rng;
 
@@ -65,7 +66,35 @@ protected:
   GPU_Vector<float> pe_before;
   GPU_Vector<float> pe_after;
 
+  // for the batched trials
+  GPU_Vector<int> NN_atom;
+  GPU_Vector<int> NL_atom;
+  GPU_Vector<int> cell_count;
+  GPU_Vector<int> cell_count_sum;
+  GPU_Vector<int> cell_contents;
+  GPU_Vector<int> trial_of_atom;   // trial index of each atom in the batch, -1 otherwise
+  GPU_Vector<int> num_local;       // number of local atoms in the batch
+  GPU_Vector<int> NL_local;        // local atoms of all the trials
+  GPU_Vector<int> trial_of_local;  // trial index of each local atom
+  GPU_Vector<int> batch_sites;     // sites changed by the trials
+  GPU_Vector<int> batch_new_types; // new types of these sites
+  GPU_Vector<int> batch_accepted;  // 1 for accepted trials and 0 otherwise
+  GPU_Vector<float> energy_change; // energy change of each trial
+  std::vector<int> cpu_batch_sites;
+  std::vector<int> cpu_batch_new_types;
+  std::vector<int> cpu_batch_accepted;
+  std::vector<float> cpu_energy_change;
+
   NEP_Energy nep_energy;
 
   bool check_if_small_box(const double rc, const Box& box);
+
+  void prepare_batch(Atom& atom, Box& box);
+  bool is_far_from_batch(const Atom& atom, const Box& box, const int n);
+  void find_energy_change_batch(
+    Atom& atom, Box& box, const int num_trials, const int num_sites_per_trial);
+  void finish_batch(Atom& atom, const int num_trials, const int num_sites_per_trial);
+
+private:
+  void resize_local_arrays(const int N_local);
 };
@@ -18,12 +18,14 @@ The canonical ensemble for MCMD.
 ------------------------------------------------------------------------------*/
 
 #include "mc_ensemble_canonical.cuh"
+#include <algorithm>
 
 MC_Ensemble_Canonical::MC_Ensemble_Canonical(
-  const char** param, int num_param, int num_steps_mc_input)
+  const char** param, int num_param, int num_steps_mc_input, int batch_size_input)
   : MC_Ensemble(param, num_param)
 {
   num_steps_mc = num_steps_mc_input;
+  batch_size = batch_size_input;
   NN_ij.resize(1);
   NL_ij.resize(1000);
 }
@@ -203,6 +205,39 @@ static __global__ void exchange(
   g_vz[j] = vz_i;
 }
 
+// one thread for each trial; the types have been exchanged in finish_batch
+static __global__ void exchange_batch(
+  const int num_trials,
+  const int* g_sites,
+  const int* g_accepted,
+  double* g_mass,
+  double* g_vx,
+  double* g_vy,
+  double* g_vz)
+{
+  int t = blockIdx.x * blockDim.x + threadIdx.x;
+  if (t < num_trials && g_accepted[t]) {
+    int i = g_sites[t * 2 + 0];
+    int j = g_sites[t * 2 + 1];
+
+    double mass_i = g_mass[i];
+    g_mass[i] = g_mass[j];
+    g_mass[j] = mass_i;
+
+    double vx_i = g_vx[i];
+    g_vx[i] = g_vx[j];
+    g_vx[j] = vx_i;
+
+    double vy_i = g_vy[i];
+    g_vy[i] = g_vy[j];
+    g_vy[j] = vy_i;
+
+    double vz_i = g_vz[i];
+    g_vz[i] = g_vz[j];
+    g_vz[j] = vz_i;
+  }
+}
+
 void MC_Ensemble_Canonical::compute(
   int md_step,
   double temperature,
@@ -222,6 +257,11 @@ void MC_Ensemble_Canonical::compute(
     type_after.resize(atom.number_of_atoms);
   }
 
+  if (batch_size > 1) {
+    compute_batch(md_step, temperature, atom, box, groups, grouping_method, group_id);
+    return;
+  }
+
   int group_size =
     grouping_method >= 0 ? groups[grouping_method].cpu_size[group_id] : atom.number_of_atoms;
   std::uniform_int_distribution<int> r1(0, group_size - 1);
@@ -384,3 +424,95 @@ void MC_Ensemble_Canonical::compute(
 
   mc_output << md_step << "  " << num_accepted / double(num_steps_mc) << std::endl;
 }
+
+void MC_Ensemble_Canonical::compute_batch(
+  int md_step,
+  double temperature,
+  Atom& atom,
+  Box& box,
+  std::vector<Group>& groups,
+  int grouping_method,
+  int group_id)
+{
+  prepare_batch(atom, box);
+
+  int group_size =
+    grouping_method >= 0 ? groups[grouping_method].cpu_size[group_id] : atom.number_of_atoms;
+  std::uniform_int_distribution<int> r1(0, group_size - 1);
+  std::uniform_real_distribution<float> r2(0, 1);
+
+  int num_accepted = 0;
+  int num_trials_done = 0;
+  while (num_trials_done < num_steps_mc) {
+    const int max_trials = std::min(batch_size, num_steps_mc - num_trials_done);
+    cpu_batch_sites.clear();
+    cpu_batch_new_types.clear();
+
+    // proposals overlapping with the batch are discarded and do not count as trials
+    for (int attempt = 0; attempt < max_trials * 10; ++attempt) {
+      int i = grouping_method >= 0
+                ? groups[grouping_method]
+                    .cpu_contents[groups[grouping_method].cpu_size_sum[group_id] + r1(rng)]
+                : r1(rng);
+      int type_i = atom.cpu_type[i];
+      int j = 0, type_j = type_i;
+      while (type_i == type_j) {
+        j = grouping_method >= 0
+              ? groups[grouping_method]
+                  .cpu_contents[groups[grouping_method].cpu_size_sum[group_id] + r1(rng)]
+              : r1(rng);
+        type_j = atom.cpu_type[j];
+      }
+      if (is_far_from_batch(atom, box, i) && is_far_from_batch(atom, box, j)) {
+        cpu_batch_sites.push_back(i);
+        cpu_batch_sites.push_back(j);
+        cpu_batch_new_types.push_back(type_j);
+        cpu_batch_new_types.push_back(type_i);
+        if (cpu_batch_sites.size() == max_trials * 2) {
+          break;
+        }
+      }
+    }
+
+    const int num_trials = cpu_batch_sites.size() / 2;
+    find_energy_change_batch(atom, box, num_trials, 2);
+
+    for (int t = 0; t < num_trials; ++t) {
+      float random_number = r2(rng);
+      float probability = exp(-cpu_energy_change[t] / (K_B * temperature));
+      cpu_batch_accepted[t] = random_number < probability;
+
+      if (cpu_batch_accepted[t]) {
+        ++num_accepted;
+
+        int i = cpu_batch_sites[t * 2 + 0];
+        int j = cpu_batch_sites[t * 2 + 1];
+        atom.cpu_type[i] = cpu_batch_new_types[t * 2 + 0];
+        atom.cpu_type[j] = cpu_batch_new_types[t * 2 + 1];
+
+        auto atom_symbol_i = atom.cpu_atom_symbol[i];
+        atom.cpu_atom_symbol[i] = atom.cpu_atom_symbol[j];
+        atom.cpu_atom_symbol[j] = atom_symbol_i;
+
+        double mass_i = atom.cpu_mass[i];
+        atom.cpu_mass[i] = atom.cpu_mass[j];
+        atom.cpu_mass[j] = mass_i;
+      }
+    }
+
+    finish_batch(atom, num_trials, 2);
+    exchange_batch<<<(num_trials - 1) / 64 + 1, 64>>>(
+      num_trials,
+      batch_sites.data(),
+      batch_accepted.data(),
+      atom.mass.data(),
+      atom.velocity_per_atom.data(),
+      atom.velocity_per_atom.data() + atom.number_of_atoms,
+      atom.velocity_per_atom.data() + atom.number_of_atoms * 2);
+    CUDA_CHECK_KERNEL
+
+    num_trials_done += num_trials;
+  }
+
+  mc_output << md_step << "  " << num_accepted / double(num_steps_mc) << std::endl;
+}
@@ -19,7 +19,7 @@
 class MC_Ensemble_Canonical : public MC_Ensemble
 {
 public:
-  MC_Ensemble_Canonical(const char** param, int num_param, int num_steps_mc);
+  MC_Ensemble_Canonical(const char** param, int num_param, int num_steps_mc, int batch_size);
   virtual ~MC_Ensemble_Canonical(void);
 
   virtual void compute(
@@ -32,6 +32,15 @@ public:
     int group_id);
 
 private:
+  void compute_batch(
+    int md_step,
+    double temperature,
+    Atom& atom,
+    Box& box,
+    std::vector<Group>& group,
+    int grouping_method,
+    int group_id);
+
   GPU_Vector<int> NN_ij;
   GPU_Vector<int> NL_ij;
 };
@@ -27,6 +27,7 @@ integration across phase boundaries, Phys. Rev. B 86, 134204 (2012).
 ------------------------------------------------------------------------------*/
 
 #include "mc_ensemble_sgc.cuh"
+#include <algorithm>
 #include <map>
 
 const std::map<std::string, double> MASS_TABLE{
@@ -138,6 +139,7 @@ MC_Ensemble_SGC::MC_Ensemble_SGC(
   const char** param,
   int num_param,
   int num_steps_mc_input,
+  int batch_size_input,
   bool is_vcsgc_input,
   std::vector<std::string>& species_input,
   std::vector<int>& types_input,
@@ -147,6 +149,7 @@ MC_Ensemble_SGC::MC_Ensemble_SGC(
   : MC_Ensemble(param, num_param)
 {
   num_steps_mc = num_steps_mc_input;
+  batch_size = batch_size_input;
   is_vcsgc = is_vcsgc_input;
   species = species_input;
   types = types_input;
@@ -304,6 +307,28 @@ static __global__ void gpu_flip(
   g_vz[i] *= mass_scaler;
 }
 
+// one thread for each trial; the types have been flipped in finish_batch
+static __global__ void gpu_flip_batch(
+  const int num_trials,
+  const int* g_sites,
+  const int* g_accepted,
+  const double* g_mass_j,
+  const double* g_mass_scaler,
+  double* g_mass,
+  double* g_vx,
+  double* g_vy,
+  double* g_vz)
+{
+  int t = blockIdx.x * blockDim.x + threadIdx.x;
+  if (t < num_trials && g_accepted[t]) {
+    int i = g_sites[t];
+    g_mass[i] = g_mass_j[t];
+    g_vx[i] *= g_mass_scaler[t]; // momentum conservation
+    g_vy[i] *= g_mass_scaler[t];
+    g_vz[i] *= g_mass_scaler[t];
+  }
+}
+
 bool MC_Ensemble_SGC::allowed_species(std::string& species_found)
 {
   for (int k = 0; k < species.size(); ++k) {
@@ -334,6 +359,11 @@ void MC_Ensemble_SGC::compute(
     type_after.resize(atom.number_of_atoms);
   }
 
+  if (batch_size > 1) {
+    compute_batch(md_step, temperature, atom, box, groups, grouping_method, group_id);
+    return;
+  }
+
   int group_size =
     grouping_method >= 0 ? groups[grouping_method].cpu_size[group_id] : atom.number_of_atoms;
   std::uniform_int_distribution<int> r1(0, group_size - 1);
@@ -504,3 +534,119 @@ void MC_Ensemble_SGC::compute(
   }
   mc_output << std::endl;
 }
+
+void MC_Ensemble_SGC::compute_batch(
+  int md_step,
+  double temperature,
+  Atom& atom,
+  Box& box,
+  std::vector<Group>& groups,
+  int grouping_method,
+  int group_id)
+{
+  prepare_batch(atom, box);
+  if (batch_mass.size() < batch_size) {
+    batch_mass.resize(batch_size);
+    batch_mass_scaler.resize(batch_size);
+    cpu_batch_mass.resize(batch_size);
+    cpu_batch_mass_scaler.resize(batch_size);
+  }
+
+  int group_size =
+    grouping_method >= 0 ? groups[grouping_method].cpu_size[group_id] : atom.number_of_atoms;
+  std::uniform_int_distribution<int> r1(0, group_size - 1);
+  std::uniform_int_distribution<int> rand_int2(0, types.size() - 1);
+  std::uniform_real_distribution<float> r2(0, 1);
+  std::vector<int> index_old_species_batch(batch_size);
+  std::vector<int> index_new_species_batch(batch_size);
+
+  int num_accepted = 0;
+  int num_trials_done = 0;
+  while (num_trials_done < num_steps_mc) {
+    const int max_trials = std::min(batch_size, num_steps_mc - num_trials_done);
+    cpu_batch_sites.clear();
+    cpu_batch_new_types.clear();
+
+    // proposals overlapping with the batch are discarded and do not count as trials
+    for (int attempt = 0; attempt < max_trials * 10; ++attempt) {
+      int i = -1;
+      int type_i = -1;
+      std::string species_found;
+      while (!allowed_species(species_found)) {
+        i = grouping_method >= 0
+              ? groups[grouping_method]
+                  .cpu_contents[groups[grouping_method].cpu_size_sum[group_id] + r1(rng)]
+              : r1(rng);
+        species_found = atom.cpu_atom_symbol[i];
+        type_i = atom.cpu_type[i];
+      }
+
+      int type_j = type_i;
+      while (type_j == type_i) {
+        index_new_species = rand_int2(rng);
+        type_j = types[index_new_species];
+      }
+
+      if (is_far_from_batch(atom, box, i)) {
+        index_old_species_batch[cpu_batch_sites.size()] = index_old_species;
+        index_new_species_batch[cpu_batch_sites.size()] = index_new_species;
+        cpu_batch_sites.push_back(i);
+        cpu_batch_new_types.push_back(type_j);
+        if (cpu_batch_sites.size() == max_trials) {
+          break;
+        }
+      }
+    }
+
+    const int num_trials = cpu_batch_sites.size();
+    find_energy_change_batch(atom, box, num_trials, 1);
+
+    for (int t = 0; t < num_trials; ++t) {
+      const int index_old = index_old_species_batch[t];
+      const int index_new = index_new_species_batch[t];
+      float energy_difference = cpu_energy_change[t] + mu_or_phi[index_new] - mu_or_phi[index_old];
+      float random_number = r2(rng);
+      float probability = exp(-energy_difference / (K_B * temperature));
+      cpu_batch_accepted[t] = random_number < probability;
+
+      if (cpu_batch_accepted[t]) {
+        ++num_accepted;
+
+        ++num_atoms_species[index_new];
+        --num_atoms_species[index_old];
+
+        int i = cpu_batch_sites[t];
+        atom.cpu_type[i] = cpu_batch_new_types[t];
+        atom.cpu_atom_symbol[i] = species[index_new];
+        double mass_old = atom.cpu_mass[i];
+        double mass_new = MASS_TABLE.at(species[index_new]);
+        atom.cpu_mass[i] = mass_new;
+        cpu_batch_mass[t] = mass_new;
+        cpu_batch_mass_scaler[t] = mass_old / mass_new;
+      }
+    }
+
+    finish_batch(atom, num_trials, 1);
+    batch_mass.copy_from_host(cpu_batch_mass.data(), num_trials);
+    batch_mass_scaler.copy_from_host(cpu_batch_mass_scaler.data(), num_trials);
+    gpu_flip_batch<<<(num_trials - 1) / 64 + 1, 64>>>(
+      num_trials,
+      batch_sites.data(),
+      batch_accepted.data(),
+      batch_mass.data(),
+      batch_mass_scaler.data(),
+      atom.mass.data(),
+      atom.velocity_per_atom.data(),
+      atom.velocity_per_atom.data() + atom.number_of_atoms,
+      atom.velocity_per_atom.data() + atom.number_of_atoms * 2);
+    CUDA_CHECK_KERNEL
+
+    num_trials_done += num_trials;
+  }
+
+  mc_output << md_step << "  " << num_accepted / double(num_steps_mc) << " ";
+  for (int t = 0; t < types.size(); ++t) {
+    mc_output << num_atoms_species[t] / double(atom.number_of_atoms) << " ";
+  }
+  mc_output << std::endl;
+}
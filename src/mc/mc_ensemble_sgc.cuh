@@ -23,6 +23,7 @@ public:
     const char** param,
     int num_param,
     int num_steps_mc,
+    int batch_size,
     bool is_vcsgc,
     std::vector<std::string>& species,
     std::vector<int>& types,
@@ -41,6 +42,15 @@ public:
     int group_id);
 
 private:
+  void compute_batch(
+    int md_step,
+    double temperature,
+    Atom& atom,
+    Box& box,
+    std::vector<Group>& group,
+    int grouping_method,
+    int group_id);
+
   GPU_Vector<int> NN_ij;
   GPU_Vector<int> NL_ij;
   bool is_vcsgc = false;
@@ -51,6 +61,10 @@ private:
   int index_old_species;
   int index_new_species;
   double kappa;
+  GPU_Vector<double> batch_mass;        // new masses of the flipped sites
+  GPU_Vector<double> batch_mass_scaler; // velocity scalers of the flipped sites
+  std::vector<double> cpu_batch_mass;
+  std::vector<double> cpu_batch_mass_scaler;
 
   bool allowed_species(std::string& species_found);
 };
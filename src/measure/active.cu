@@ -195,6 +195,9 @@ void Active::process(
     number_of_atoms, mean_force_.data(), mean_force_sq_.data());
   CUDA_CHECK_KERNEL
 
+  // NEP models with the same neighbor list settings share the neighbor lists of the main potential
+  force.find_committee_neighbor_list(box, atom.position_per_atom);
+
   // Loop backwards over files to evaluate the main potential last, keeping it's properties intact
   for (int potential_index = number_of_potentials - 1; potential_index >= 0; potential_index--) {
     // Set potential/force/virials to zero
@@ -207,15 +210,16 @@ void Active::process(
       atom.virial_per_atom.data());
     CUDA_CHECK_KERNEL
     // Compute new potential properties
-    force.potentials[potential_index]->compute(
+    force.compute_committee_member(
+      potential_index,
       box,
-      atom.type,
       atom.position_per_atom,
+      atom.type,
       atom.potential_per_atom,
       atom.force_per_atom,
       atom.virial_per_atom);
-    // Write properties to GPU vector
-    compute_mean<<<(3 * number_of_atoms - 1) / 128 + 1, 128>>>(
+    // Accumulate the mean and the mean square of the forces
+    compute_mean<<<(number_of_atoms - 1) / 128 + 1, 128>>>(
       number_of_atoms,
       number_of_potentials,
       mean_force_.data(),
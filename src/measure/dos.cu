@@ -28,6 +28,7 @@ Reference for DOS:
 #include "model/group.cuh"
 #include "parse_utilities.cuh"
 #include "utilities/common.cuh"
+#include "utilities/fft.cuh"
 #include "utilities/error.cuh"
 #include "utilities/read_file.cuh"
 #include <cstring>
@@ -423,6 +424,10 @@ void DOS::find_dos()
 {
   const double d_omega = omega_max_ / num_dos_points_;
 
+  // DOS(omega) = sum_nc vac(nc) * cos(omega * nc * dt) with omega = d_omega, 2 * d_omega, ...
+  const Cosine_Sum cosine_sum(
+    num_correlation_steps_, num_dos_points_, d_omega * dt_in_ps_, d_omega * dt_in_ps_);
+
   for (int n = 0; n < num_groups_; ++n) {
 
     for (int nc = 0; nc < num_correlation_steps_; nc++) {
@@ -433,21 +438,18 @@ void DOS::find_dos()
       vacz_[nc + num_correlation_steps_ * n] *= multiply_factor;
     }
 
-    for (int nw = 0; nw < num_dos_points_; nw++) {
-      const double omega = d_omega + nw * d_omega;
-
-      for (int nc = 0; nc < num_correlation_steps_; nc++) {
-        const double cos_factor = cos(omega * nc * dt_in_ps_);
-        dosx_[nw + num_dos_points_ * n] += vacx_[nc + num_correlation_steps_ * n] * cos_factor;
-        dosy_[nw + num_dos_points_ * n] += vacy_[nc + num_correlation_steps_ * n] * cos_factor;
-        dosz_[nw + num_dos_points_ * n] += vacz_[nc + num_correlation_steps_ * n] * cos_factor;
-      }
-
-      const int group_size = (num_groups_ == 1) ? num_atoms_ : group_->cpu_size[n];
+    double* dosx = dosx_.data() + num_dos_points_ * n;
+    double* dosy = dosy_.data() + num_dos_points_ * n;
+    double* dosz = dosz_.data() + num_dos_points_ * n;
+    cosine_sum.transform(vacx_.data() + num_correlation_steps_ * n, dosx);
+    cosine_sum.transform(vacy_.data() + num_correlation_steps_ * n, dosy);
+    cosine_sum.transform(vacz_.data() + num_correlation_steps_ * n, dosz);
 
-      dosx_[nw + num_dos_points_ * n] *= dt_in_ps_ * 2.0 * group_size;
-      dosy_[nw + num_dos_points_ * n] *= dt_in_ps_ * 2.0 * group_size;
-      dosz_[nw + num_dos_points_ * n] *= dt_in_ps_ * 2.0 * group_size;
+    const int group_size = (num_groups_ == 1) ? num_atoms_ : group_->cpu_size[n];
+    for (int nw = 0; nw < num_dos_points_; nw++) {
+      dosx[nw] *= dt_in_ps_ * 2.0 * group_size;
+      dosy[nw] *= dt_in_ps_ * 2.0 * group_size;
+      dosz[nw] *= dt_in_ps_ * 2.0 * group_size;
     }
   }
 }
@@ -0,0 +1,249 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*-----------------------------------------------------------------------------------------------100
+Dump positions (and optionally velocities) to dump.ctraj in a compressed format with fixed
+precision (see utilities/compressed_trajectory.cuh), which can be converted to the extended XYZ
+format by tools/ctraj2exyz.
+--------------------------------------------------------------------------------------------------*/
+
+#include "dump_compressed.cuh"
+#include "model/atom.cuh"
+#include "model/box.cuh"
+#include "utilities/common.cuh"
+#include "utilities/error.cuh"
+#include "utilities/gpu_vector.cuh"
+#include "utilities/read_file.cuh"
+#include <algorithm>
+#include <cstring>
+
+void Dump_Compressed::parse(const char** param, int num_param)
+{
+  dump_ = true;
+  printf("Dump compressed trajectory.\n");
+
+  if (num_param < 3) {
+    PRINT_INPUT_ERROR("dump_compressed should have at least 2 parameters.\n");
+  }
+
+  if (!is_valid_int(param[1], &dump_interval_)) {
+    PRINT_INPUT_ERROR("dump interval should be an integer.");
+  }
+  if (dump_interval_ <= 0) {
+    PRINT_INPUT_ERROR("dump interval should > 0.");
+  }
+  printf("    every %d steps.\n", dump_interval_);
+
+  if (!is_valid_real(param[2], &precision_position_)) {
+    PRINT_INPUT_ERROR("position precision should be a number.");
+  }
+  if (precision_position_ <= 0) {
+    PRINT_INPUT_ERROR("position precision should > 0.");
+  }
+  printf("    with position precision %g A.\n", precision_position_);
+
+  precision_velocity_ = 0.0;
+  key_interval_ = 100;
+  for (int k = 3; k < num_param; k++) {
+    if (strcmp(param[k], "velocity") == 0) {
+      if (k + 2 > num_param) {
+        PRINT_INPUT_ERROR("Not enough arguments for option 'velocity'.\n");
+      }
+      if (!is_valid_real(param[++k], &precision_velocity_)) {
+        PRINT_INPUT_ERROR("velocity precision should be a number.");
+      }
+      if (precision_velocity_ <= 0) {
+        PRINT_INPUT_ERROR("velocity precision should > 0.");
+      }
+      printf("    with velocity precision %g A/fs.\n", precision_velocity_);
+    } else if (strcmp(param[k], "key_interval") == 0) {
+      if (k + 2 > num_param) {
+        PRINT_INPUT_ERROR("Not enough arguments for option 'key_interval'.\n");
+      }
+      if (!is_valid_int(param[++k], &key_interval_)) {
+        PRINT_INPUT_ERROR("key frame interval should be an integer.");
+      }
+      if (key_interval_ <= 0) {
+        PRINT_INPUT_ERROR("key frame interval should > 0.");
+      }
+    } else {
+      PRINT_INPUT_ERROR("Unrecognized argument in dump_compressed.\n");
+    }
+  }
+  printf("    with a key frame every %d frames.\n", key_interval_);
+}
+
+void Dump_Compressed::preprocess(Atom& atom, const bool is_async)
+{
+  if (!dump_) {
+    return;
+  }
+
+  fid_ = my_fopen("dump.ctraj", "ab");
+  fid_index_ = my_fopen("dump.ctraj.idx", "ab");
+#ifdef _WIN32
+  _fseeki64(fid_, 0, SEEK_END);
+  file_offset_ = _ftelli64(fid_);
+#else
+  fseeko(fid_, 0, SEEK_END);
+  file_offset_ = ftello(fid_);
+#endif
+  writer_.start("dump_compressed", is_async);
+
+  const int N = atom.number_of_atoms;
+  type_symbol_.clear();
+  key_type_.clear();
+  q_position_.resize(N * 3);
+  q_position_previous_.resize(N * 3);
+  q_velocity_.resize(precision_velocity_ > 0 ? N * 3 : 0);
+  frame_ = 0;
+  frames_since_key_ = 0;
+  bytes_written_ = 0;
+}
+
+// take the types of the current step and add the symbols of the types present
+void Dump_Compressed::update_types(const Atom& atom)
+{
+  const int N = atom.number_of_atoms;
+  key_type_.assign(atom.cpu_type.begin(), atom.cpu_type.begin() + N);
+  for (int n = 0; n < N; ++n) {
+    const int type = atom.cpu_type[n];
+    if (type >= int(type_symbol_.size())) {
+      type_symbol_.resize(type + 1, "X");
+    }
+    type_symbol_[type] = atom.cpu_atom_symbol[n];
+  }
+}
+
+// executed by the writer thread, which owns all the buffers used here except for type_symbol_ and
+// key_type_, of which key frames get a copy
+void Dump_Compressed::write_frame(
+  const Ctraj_Frame_Header& header_in,
+  const std::vector<long long>& type,
+  const std::vector<std::string>& type_symbol,
+  const std::vector<double>& snapshot)
+{
+  Ctraj_Frame_Header header = header_in;
+  const int N = header.number_of_atoms;
+
+  for (int i = 0; i < N * 3; ++i) {
+    q_position_[i] = quantize(snapshot[i], precision_position_);
+  }
+
+  if (header.has_velocity) {
+    const double natural_to_A_per_fs = 1.0 / TIME_UNIT_CONVERSION;
+    for (int i = 0; i < N * 3; ++i) {
+      q_velocity_[i] = quantize(snapshot[N * 3 + i] * natural_to_A_per_fs, precision_velocity_);
+    }
+  }
+  pack_frame(
+    header,
+    type_symbol,
+    type.data(),
+    q_position_.data(),
+    q_position_previous_.data(),
+    q_velocity_.data(),
+    work_,
+    payload_);
+  q_position_.swap(q_position_previous_);
+
+  header.payload_size = payload_.size();
+  Ctraj_Index_Entry entry;
+  entry.step = header.step;
+  entry.offset = file_offset_;
+  entry.is_key = header.is_key;
+
+  if (
+    fwrite(&header, sizeof(header), 1, fid_) != 1 ||
+    fwrite(payload_.data(), 1, payload_.size(), fid_) != payload_.size() ||
+    fwrite(&entry, sizeof(entry), 1, fid_index_) != 1) {
+    PRINT_INPUT_ERROR("Failed to write dump.ctraj.");
+  }
+  fflush(fid_);
+  fflush(fid_index_);
+  file_offset_ += sizeof(header) + payload_.size();
+  bytes_written_ += sizeof(header) + payload_.size() + sizeof(entry);
+}
+
+void Dump_Compressed::process(const int step, const double global_time, const Box& box, Atom& atom)
+{
+  if (!dump_)
+    return;
+  if ((step + 1) % dump_interval_ != 0)
+    return;
+
+  const int N = atom.number_of_atoms;
+  Ctraj_Frame_Header header;
+  // the delta frames use the types of the last key frame, so a change of the types (by MC)
+  // forces a key frame
+  const bool is_type_changed =
+    key_type_.empty() || !std::equal(key_type_.begin(), key_type_.end(), atom.cpu_type.begin());
+  header.is_key = (is_type_changed || frames_since_key_ >= key_interval_) ? 1 : 0;
+  header.step = step + 1;
+  header.time = global_time * TIME_UNIT_CONVERSION;
+  const int lattice_index[9] = {0, 3, 6, 1, 4, 7, 2, 5, 8};
+  for (int k = 0; k < 9; ++k) {
+    if (box.triclinic == 1) {
+      header.lattice[k] = box.cpu_h[lattice_index[k]];
+    } else {
+      header.lattice[k] = (k % 4 == 0) ? box.cpu_h[k / 4] : 0.0;
+    }
+  }
+  header.pbc[0] = box.pbc_x;
+  header.pbc[1] = box.pbc_y;
+  header.pbc[2] = box.pbc_z;
+  header.number_of_atoms = N;
+  std::vector<long long> type;
+  std::vector<std::string> type_symbol;
+  if (header.is_key) {
+    update_types(atom);
+    type.assign(key_type_.begin(), key_type_.end());
+    type_symbol = type_symbol_;
+    frames_since_key_ = 0;
+  }
+  ++frames_since_key_;
+  header.number_of_types = header.is_key ? type_symbol_.size() : 0;
+  header.has_velocity = (precision_velocity_ > 0) ? 1 : 0;
+  header.precision_position = precision_position_;
+  header.precision_velocity = precision_velocity_;
+  ++frame_;
+
+  std::vector<double>& snapshot = writer_.acquire();
+  snapshot.resize(N * (header.has_velocity ? 6 : 3));
+  atom.position_per_atom.copy_to_host(snapshot.data());
+  if (header.has_velocity) {
+    atom.velocity_per_atom.copy_to_host(snapshot.data() + N * 3);
+  }
+  writer_.submit([this, header, type, type_symbol](const std::vector<double>& snapshot) {
+    write_frame(header, type, type_symbol, snapshot);
+  });
+}
+
+void Dump_Compressed::postprocess()
+{
+  if (dump_) {
+    writer_.finish();
+    if (frame_ > 0) {
+      printf(
+        "dump_compressed: %d frames, %lld bytes (%g bytes per atom per frame).\n",
+        frame_,
+        bytes_written_,
+        double(bytes_written_) / (double(frame_) * q_position_.size() / 3));
+    }
+    fclose(fid_);
+    fclose(fid_index_);
+    dump_ = false;
+  }
+}
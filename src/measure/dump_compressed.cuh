@@ -0,0 +1,61 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "utilities/async_writer.cuh"
+#include "utilities/compressed_trajectory.cuh"
+#include "utilities/gpu_vector.cuh"
+#include <string>
+#include <vector>
+class Box;
+class Atom;
+
+class Dump_Compressed
+{
+public:
+  void parse(const char** param, int num_param);
+  void preprocess(Atom& atom, const bool is_async);
+  void process(const int step, const double global_time, const Box& box, Atom& atom);
+  void postprocess();
+
+private:
+  bool dump_ = false;
+  int dump_interval_ = 1;
+  int key_interval_ = 100;           // number of frames from one key frame to the next
+  double precision_position_ = 1e-3; // in units of A
+  double precision_velocity_ = 0.0;  // in units of A/fs; 0 means no velocities
+  FILE* fid_;
+  FILE* fid_index_;
+  int frame_ = 0;               // frame counter within the run
+  int frames_since_key_ = 0;    // frames written since the last key frame
+  long long file_offset_ = 0;   // size of dump.ctraj
+  long long bytes_written_ = 0; // bytes written in the run
+  // symbol of each type seen so far ("X" if none yet) and the types of the last key frame
+  std::vector<std::string> type_symbol_;
+  std::vector<int> key_type_;
+  std::vector<long long> q_position_;          // quantized positions of the current frame
+  std::vector<long long> q_position_previous_; // quantized positions of the previous frame
+  std::vector<long long> q_velocity_;          // quantized velocities of the current frame
+  std::vector<long long> work_;
+  std::vector<unsigned char> payload_;
+  Async_Writer writer_;
+  void update_types(const Atom& atom);
+  void write_frame(
+    const Ctraj_Frame_Header& header_in,
+    const std::vector<long long>& type,
+    const std::vector<std::string>& type_symbol,
+    const std::vector<double>& snapshot);
+};
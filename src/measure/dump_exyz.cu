@@ -116,42 +116,35 @@ void Dump_EXYZ::parse(const char** param, int num_param)
   }
 }
 
-void Dump_EXYZ::preprocess(const int number_of_atoms)
+void Dump_EXYZ::preprocess(const int number_of_atoms, const bool is_async)
 {
   if (dump_) {
     if (separated_ == 0) {
       fid_ = my_fopen("dump.xyz", "a");
     }
-    
+    writer_.start("dump_exyz", is_async);
     gpu_total_virial_.resize(6);
-    cpu_total_virial_.resize(6);
-    if (has_force_) {
-      cpu_force_per_atom_.resize(number_of_atoms * 3);
-    }
-    if (has_potential_) {
-      cpu_potential_per_atom_.resize(number_of_atoms);
-    }
   }
 }
 
 void Dump_EXYZ::output_line2(
+  FILE* fid,
   const double time,
   const Box& box,
-  const std::vector<std::string>& cpu_atom_symbol,
-  GPU_Vector<double>& virial_per_atom,
-  GPU_Vector<double>& gpu_thermo)
+  const double* cpu_thermo,
+  const double* cpu_total_virial)
 {
   // time
-  fprintf(fid_, "Time=%.8f", time * TIME_UNIT_CONVERSION); // output time is in units of fs
+  fprintf(fid, "Time=%.8f", time * TIME_UNIT_CONVERSION); // output time is in units of fs
 
   // PBC
   fprintf(
-    fid_, " pbc=\"%c %c %c\"", box.pbc_x ? 'T' : 'F', box.pbc_y ? 'T' : 'F', box.pbc_z ? 'T' : 'F');
+    fid, " pbc=\"%c %c %c\"", box.pbc_x ? 'T' : 'F', box.pbc_y ? 'T' : 'F', box.pbc_z ? 'T' : 'F');
 
   // box
   if (box.triclinic == 0) {
     fprintf(
-      fid_,
+      fid,
       " Lattice=\"%.8f %.8f %.8f %.8f %.8f %.8f %.8f %.8f %.8f\"",
       box.cpu_h[0],
       0.0,
@@ -164,7 +157,7 @@ void Dump_EXYZ::output_line2(
       box.cpu_h[2]);
   } else {
     fprintf(
-      fid_,
+      fid,
       " Lattice=\"%.8f %.8f %.8f %.8f %.8f %.8f %.8f %.8f %.8f\"",
       box.cpu_h[0],
       box.cpu_h[3],
@@ -178,27 +171,21 @@ void Dump_EXYZ::output_line2(
   }
 
   // energy and virial (symmetric tensor) in eV, and stress (symmetric tensor) in eV/A^3
-  double cpu_thermo[8];
-  gpu_thermo.copy_to_host(cpu_thermo, 8);
-  const int N = virial_per_atom.size() / 9;
-  gpu_sum<<<6, 1024>>>(N, virial_per_atom.data(), gpu_total_virial_.data());
-  gpu_total_virial_.copy_to_host(cpu_total_virial_.data());
-
-  fprintf(fid_, " energy=%.8f", cpu_thermo[1]);
+  fprintf(fid, " energy=%.8f", cpu_thermo[1]);
   fprintf(
-    fid_,
+    fid,
     " virial=\"%.8f %.8f %.8f %.8f %.8f %.8f %.8f %.8f %.8f\"",
-    cpu_total_virial_[0],
-    cpu_total_virial_[3],
-    cpu_total_virial_[4],
-    cpu_total_virial_[3],
-    cpu_total_virial_[1],
-    cpu_total_virial_[5],
-    cpu_total_virial_[4],
-    cpu_total_virial_[5],
-    cpu_total_virial_[2]);
+    cpu_total_virial[0],
+    cpu_total_virial[3],
+    cpu_total_virial[4],
+    cpu_total_virial[3],
+    cpu_total_virial[1],
+    cpu_total_virial[5],
+    cpu_total_virial[4],
+    cpu_total_virial[5],
+    cpu_total_virial[2]);
   fprintf(
-    fid_,
+    fid,
     " stress=\"%.8f %.8f %.8f %.8f %.8f %.8f %.8f %.8f %.8f\"",
     cpu_thermo[2],
     cpu_thermo[5],
@@ -211,20 +198,20 @@ void Dump_EXYZ::output_line2(
     cpu_thermo[4]);
 
   // Properties
-  fprintf(fid_, " Properties=species:S:1:pos:R:3");
+  fprintf(fid, " Properties=species:S:1:pos:R:3");
 
   if (has_velocity_) {
-    fprintf(fid_, ":vel:R:3");
+    fprintf(fid, ":vel:R:3");
   }
   if (has_force_) {
-    fprintf(fid_, ":forces:R:3");
+    fprintf(fid, ":forces:R:3");
   }
   if (has_potential_) {
-    fprintf(fid_, ":energy_atom:R:1");
+    fprintf(fid, ":energy_atom:R:1");
   }
 
   // Over
-  fprintf(fid_, "\n");
+  fprintf(fid, "\n");
 }
 
 void Dump_EXYZ::process(
@@ -239,63 +226,83 @@ void Dump_EXYZ::process(
   if ((step + 1) % dump_interval_ != 0)
     return;
 
+  // the snapshot: position, then velocity, force and potential if required
   const int num_atoms_total = atom.position_per_atom.size() / 3;
-  atom.position_per_atom.copy_to_host(atom.cpu_position_per_atom.data());
+  const int offset_velocity = num_atoms_total * 3;
+  const int offset_force = offset_velocity + (has_velocity_ ? num_atoms_total * 3 : 0);
+  const int offset_potential = offset_force + (has_force_ ? num_atoms_total * 3 : 0);
+  std::vector<double>& snapshot = writer_.acquire();
+  snapshot.resize(offset_potential + (has_potential_ ? num_atoms_total : 0));
+  atom.position_per_atom.copy_to_host(snapshot.data());
   if (has_velocity_) {
-    atom.velocity_per_atom.copy_to_host(atom.cpu_velocity_per_atom.data());
+    atom.velocity_per_atom.copy_to_host(snapshot.data() + offset_velocity);
   }
   if (has_force_) {
-    atom.force_per_atom.copy_to_host(cpu_force_per_atom_.data());
+    atom.force_per_atom.copy_to_host(snapshot.data() + offset_force);
   }
   if (has_potential_) {
-    atom.potential_per_atom.copy_to_host(cpu_potential_per_atom_.data());
+    atom.potential_per_atom.copy_to_host(snapshot.data() + offset_potential);
   }
-  
-  if (separated_) {
-    std::string filename = "dump."+std::to_string(step+1)+".xyz";
-    fid_ = my_fopen(filename.data(), "w");
-  }
-
-  // line 1
-  fprintf(fid_, "%d\n", num_atoms_total);
 
-  // line 2
-  output_line2(global_time, box, atom.cpu_atom_symbol, atom.virial_per_atom, gpu_thermo);
+  double cpu_thermo[8];
+  gpu_thermo.copy_to_host(cpu_thermo, 8);
+  double cpu_total_virial[6];
+  gpu_sum<<<6, 1024>>>(num_atoms_total, atom.virial_per_atom.data(), gpu_total_virial_.data());
+  gpu_total_virial_.copy_to_host(cpu_total_virial);
 
-  // other lines
-  for (int n = 0; n < num_atoms_total; n++) {
-    fprintf(fid_, "%s", atom.cpu_atom_symbol[n].c_str());
-    for (int d = 0; d < 3; ++d) {
-      fprintf(fid_, " %.8f", atom.cpu_position_per_atom[n + num_atoms_total * d]);
+  // the symbols (swapped by MC) are copied, as the formatting is done by the writer thread
+  // while the following steps are being computed
+  const std::vector<std::string> cpu_atom_symbol = atom.cpu_atom_symbol;
+  writer_.submit([=](const std::vector<double>& snapshot) {
+    FILE* fid = fid_;
+    if (separated_) {
+      std::string filename = "dump." + std::to_string(step + 1) + ".xyz";
+      fid = my_fopen(filename.data(), "w");
     }
-    if (has_velocity_) {
-      const double natural_to_A_per_fs = 1.0 / TIME_UNIT_CONVERSION;
+
+    // line 1
+    fprintf(fid, "%d\n", num_atoms_total);
+
+    // line 2
+    output_line2(fid, global_time, box, cpu_thermo, cpu_total_virial);
+
+    // other lines
+    for (int n = 0; n < num_atoms_total; n++) {
+      fprintf(fid, "%s", cpu_atom_symbol[n].c_str());
       for (int d = 0; d < 3; ++d) {
-        fprintf(
-          fid_, " %.8f", atom.cpu_velocity_per_atom[n + num_atoms_total * d] * natural_to_A_per_fs);
+        fprintf(fid, " %.8f", snapshot[n + num_atoms_total * d]);
       }
-    }
-    if (has_force_) {
-      for (int d = 0; d < 3; ++d) {
-        fprintf(fid_, " %.8f", cpu_force_per_atom_[n + num_atoms_total * d]);
+      if (has_velocity_) {
+        const double natural_to_A_per_fs = 1.0 / TIME_UNIT_CONVERSION;
+        for (int d = 0; d < 3; ++d) {
+          fprintf(
+            fid,
+            " %.8f",
+            snapshot[offset_velocity + n + num_atoms_total * d] * natural_to_A_per_fs);
+        }
+      }
+      if (has_force_) {
+        for (int d = 0; d < 3; ++d) {
+          fprintf(fid, " %.8f", snapshot[offset_force + n + num_atoms_total * d]);
+        }
+      }
+      if (has_potential_) {
+        fprintf(fid, " %.8f", snapshot[offset_potential + n]);
       }
+      fprintf(fid, "\n");
     }
-    if (has_potential_) {
-      fprintf(fid_, " %.8f", cpu_potential_per_atom_[n]);
+    if (separated_ == 0) {
+      fflush(fid);
+    } else {
+      fclose(fid);
     }
-    fprintf(fid_, "\n");
-  }
-  if (separated_ == 0) {
-    fflush(fid_);
-  } else {
-    fclose(fid_);
-  }
-  
+  });
 }
 
 void Dump_EXYZ::postprocess()
 {
   if (dump_) {
+    writer_.finish();
     if (separated_ == 0) {
       fclose(fid_);
     }
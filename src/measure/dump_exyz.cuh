@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "utilities/async_writer.cuh"
 #include "utilities/gpu_vector.cuh"
 #include <string>
 #include <vector>
@@ -25,7 +26,7 @@ class Dump_EXYZ
 {
 public:
   void parse(const char** param, int num_param);
-  void preprocess(const int number_of_atoms);
+  void preprocess(const int number_of_atoms, const bool is_async);
   void process(
     const int step,
     const double global_time,
@@ -44,13 +45,11 @@ private:
   FILE* fid_;
   char filename_[200];
   void output_line2(
+    FILE* fid,
     const double time,
     const Box& box,
-    const std::vector<std::string>& cpu_atom_symbol,
-    GPU_Vector<double>& virial_per_atom,
-    GPU_Vector<double>& gpu_thermo);
-  std::vector<double> cpu_force_per_atom_;
-  std::vector<double> cpu_potential_per_atom_;
+    const double* cpu_thermo,
+    const double* cpu_total_virial);
   GPU_Vector<double> gpu_total_virial_;
-  std::vector<double> cpu_total_virial_;
+  Async_Writer writer_;
 };
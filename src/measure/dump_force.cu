@@ -52,17 +52,16 @@ void Dump_Force::parse(const char** param, int num_param, const std::vector<Grou
   }
 }
 
-void Dump_Force::preprocess(const int number_of_atoms, const std::vector<Group>& groups)
+void Dump_Force::preprocess(
+  const int number_of_atoms, const std::vector<Group>& groups, const bool is_async)
 {
   if (dump_) {
     fid_ = my_fopen("force.out", "a");
+    writer_.start("dump_force", is_async);
 
-    if (grouping_method_ < 0) {
-      cpu_force_per_atom.resize(number_of_atoms * 3);
-    } else {
+    if (grouping_method_ >= 0) {
       const int group_size = groups[grouping_method_].cpu_size[group_id_];
       gpu_force_tmp.resize(group_size * 3);
-      cpu_force_per_atom.resize(group_size * 3);
     }
   }
 }
@@ -96,52 +95,46 @@ void Dump_Force::process(
     return;
 
   const int number_of_atoms = force_per_atom.size() / 3;
+  const int num_atoms =
+    (grouping_method_ < 0) ? number_of_atoms : groups[grouping_method_].cpu_size[group_id_];
 
+  std::vector<double>& cpu_force = writer_.acquire();
+  cpu_force.resize(num_atoms * 3);
   if (grouping_method_ < 0) {
-    force_per_atom.copy_to_host(cpu_force_per_atom.data());
-    for (int n = 0; n < number_of_atoms; n++) {
-      fprintf(
-        fid_,
-        "%25.15e%25.15e%25.15e\n",
-        cpu_force_per_atom[n],
-        cpu_force_per_atom[n + number_of_atoms],
-        cpu_force_per_atom[n + 2 * number_of_atoms]);
-    }
+    force_per_atom.copy_to_host(cpu_force.data());
   } else {
-    const int group_size = groups[grouping_method_].cpu_size[group_id_];
     const int group_size_sum = groups[grouping_method_].cpu_size_sum[group_id_];
 
-    copy_force<<<(group_size - 1) / 128 + 1, 128>>>(
-      group_size,
+    copy_force<<<(num_atoms - 1) / 128 + 1, 128>>>(
+      num_atoms,
       group_size_sum,
       groups[grouping_method_].contents.data(),
       force_per_atom.data(),
       force_per_atom.data() + number_of_atoms,
       force_per_atom.data() + 2 * number_of_atoms,
       gpu_force_tmp.data(),
-      gpu_force_tmp.data() + group_size,
-      gpu_force_tmp.data() + group_size * 2);
-    for (int d = 0; d < 3; ++d) {
-      double* cpu_f = cpu_force_per_atom.data() + group_size * d;
-      double* gpu_f = gpu_force_tmp.data() + group_size * d;
-      CHECK(cudaMemcpy(cpu_f, gpu_f, sizeof(double) * group_size, cudaMemcpyDeviceToHost));
-    }
-    for (int n = 0; n < group_size; n++) {
+      gpu_force_tmp.data() + num_atoms,
+      gpu_force_tmp.data() + num_atoms * 2);
+    gpu_force_tmp.copy_to_host(cpu_force.data());
+  }
+
+  writer_.submit([this, num_atoms](const std::vector<double>& cpu_force) {
+    for (int n = 0; n < num_atoms; n++) {
       fprintf(
         fid_,
         "%25.15e%25.15e%25.15e\n",
-        cpu_force_per_atom[n],
-        cpu_force_per_atom[n + group_size],
-        cpu_force_per_atom[n + 2 * group_size]);
+        cpu_force[n],
+        cpu_force[n + num_atoms],
+        cpu_force[n + 2 * num_atoms]);
     }
-  }
-
-  fflush(fid_);
+    fflush(fid_);
+  });
 }
 
 void Dump_Force::postprocess()
 {
   if (dump_) {
+    writer_.finish();
     fclose(fid_);
     dump_ = false;
     grouping_method_ = -1;
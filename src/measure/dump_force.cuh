@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "utilities/async_writer.cuh"
 #include "utilities/gpu_vector.cuh"
 #include <vector>
 class Group;
@@ -23,7 +24,8 @@ class Dump_Force
 {
 public:
   void parse(const char** param, int num_param, const std::vector<Group>& groups);
-  void preprocess(const int number_of_atoms, const std::vector<Group>& groups);
+  void preprocess(
+    const int number_of_atoms, const std::vector<Group>& groups, const bool is_async);
   void
   process(const int step, const std::vector<Group>& groups, GPU_Vector<double>& force_per_atom);
   void postprocess();
@@ -35,6 +37,6 @@ private:
   int group_id_ = -1;
   FILE* fid_;
   char filename_[200];
-  std::vector<double> cpu_force_per_atom;
   GPU_Vector<double> gpu_force_tmp;
+  Async_Writer writer_;
 };
@@ -172,6 +172,8 @@ void Dump_Observer::process(
     // If observing, calculate properties with all potentials.
     const int number_of_potentials = force.potentials.size();
     const int number_of_atoms = atom.type.size();
+    // NEP models with the same neighbor list settings share the neighbor lists of the main one
+    force.find_committee_neighbor_list(box, atom.position_per_atom);
     // Loop backwards over files to evaluate the main potential last, keeping it's properties intact
     for (int potential_index = number_of_potentials - 1; potential_index >= 0; potential_index--) {
       // Set potential/force/virials to zero
@@ -184,10 +186,11 @@ void Dump_Observer::process(
         atom.virial_per_atom.data());
       CUDA_CHECK_KERNEL
       // Compute new potential properties
-      force.potentials[potential_index]->compute(
+      force.compute_committee_member(
+        potential_index,
         box,
-        atom.type,
         atom.position_per_atom,
+        atom.type,
         atom.potential_per_atom,
         atom.force_per_atom,
         atom.virial_per_atom);
@@ -57,10 +57,11 @@ void Dump_Position::parse(const char** param, int num_param, const std::vector<G
   }
 }
 
-void Dump_Position::preprocess()
+void Dump_Position::preprocess(const bool is_async)
 {
   if (dump_) {
     fid_ = my_fopen("movie.xyz", "a");
+    writer_.start("dump_position", is_async);
     if (precision_ == 0)
       strcpy(precision_str_, "%s %g %g %g\n");
     else if (precision_ == 1) // single precision
@@ -90,7 +91,7 @@ __global__ void copy_position(
   }
 }
 
-void Dump_Position::output_line2(const Box& box, const std::vector<std::string>& cpu_atom_symbol)
+void Dump_Position::output_line2(const Box& box)
 {
   if (box.triclinic == 0) {
     fprintf(
@@ -129,8 +130,7 @@ void Dump_Position::process(
   const std::vector<Group>& groups,
   const std::vector<std::string>& cpu_atom_symbol,
   const std::vector<int>& cpu_type,
-  GPU_Vector<double>& position_per_atom,
-  std::vector<double>& cpu_position_per_atom)
+  GPU_Vector<double>& position_per_atom)
 {
   if (!dump_)
     return;
@@ -138,58 +138,60 @@ void Dump_Position::process(
     return;
 
   const int num_atoms_total = position_per_atom.size() / 3;
+  const int num_atoms =
+    (grouping_method_ < 0) ? num_atoms_total : groups[grouping_method_].cpu_size[group_id_];
 
+  std::vector<double>& cpu_position = writer_.acquire();
+  cpu_position.resize(num_atoms * 3);
   if (grouping_method_ < 0) {
-    position_per_atom.copy_to_host(cpu_position_per_atom.data());
-    fprintf(fid_, "%d\n", num_atoms_total);
-    output_line2(box, cpu_atom_symbol);
-    for (int n = 0; n < num_atoms_total; n++) {
-      fprintf(
-        fid_,
-        precision_str_,
-        cpu_atom_symbol[n].c_str(),
-        cpu_position_per_atom[n],
-        cpu_position_per_atom[n + num_atoms_total],
-        cpu_position_per_atom[n + 2 * num_atoms_total]);
-    }
+    position_per_atom.copy_to_host(cpu_position.data());
   } else {
-    const int group_size = groups[grouping_method_].cpu_size[group_id_];
     const int group_size_sum = groups[grouping_method_].cpu_size_sum[group_id_];
-    GPU_Vector<double> gpu_position_tmp(group_size * 3);
-    copy_position<<<(group_size - 1) / 128 + 1, 128>>>(
-      group_size,
+    GPU_Vector<double> gpu_position_tmp(num_atoms * 3);
+    copy_position<<<(num_atoms - 1) / 128 + 1, 128>>>(
+      num_atoms,
       group_size_sum,
       groups[grouping_method_].contents.data(),
       position_per_atom.data(),
       position_per_atom.data() + num_atoms_total,
       position_per_atom.data() + 2 * num_atoms_total,
       gpu_position_tmp.data(),
-      gpu_position_tmp.data() + group_size,
-      gpu_position_tmp.data() + group_size * 2);
-    for (int d = 0; d < 3; ++d) {
-      double* cpu_data = cpu_position_per_atom.data() + num_atoms_total * d;
-      double* gpu_data = gpu_position_tmp.data() + group_size * d;
-      CHECK(cudaMemcpy(cpu_data, gpu_data, sizeof(double) * group_size, cudaMemcpyDeviceToHost));
-    }
-    fprintf(fid_, "%d\n", group_size);
-    output_line2(box, cpu_atom_symbol);
-    for (int n = 0; n < group_size; n++) {
+      gpu_position_tmp.data() + num_atoms,
+      gpu_position_tmp.data() + num_atoms * 2);
+    gpu_position_tmp.copy_to_host(cpu_position.data());
+  }
+
+  // the symbols (swapped by MC) and the group contents (changed by regroup) are copied, as the
+  // formatting is done by the writer thread while the following steps are being computed
+  const int* cpu_contents = (grouping_method_ < 0)
+                              ? nullptr
+                              : groups[grouping_method_].cpu_contents.data() +
+                                  groups[grouping_method_].cpu_size_sum[group_id_];
+  std::vector<std::string> symbols(num_atoms);
+  for (int n = 0; n < num_atoms; n++) {
+    symbols[n] = cpu_atom_symbol[(cpu_contents == nullptr) ? n : cpu_contents[n]];
+  }
+
+  writer_.submit([this, box, num_atoms, symbols](const std::vector<double>& cpu_position) {
+    fprintf(fid_, "%d\n", num_atoms);
+    output_line2(box);
+    for (int n = 0; n < num_atoms; n++) {
       fprintf(
         fid_,
         precision_str_,
-        cpu_atom_symbol[groups[grouping_method_].cpu_contents[group_size_sum + n]].c_str(),
-        cpu_position_per_atom[n],
-        cpu_position_per_atom[n + num_atoms_total],
-        cpu_position_per_atom[n + 2 * num_atoms_total]);
+        symbols[n].c_str(),
+        cpu_position[n],
+        cpu_position[n + num_atoms],
+        cpu_position[n + 2 * num_atoms]);
     }
-  }
-
-  fflush(fid_);
+    fflush(fid_);
+  });
 }
 
 void Dump_Position::postprocess()
 {
   if (dump_) {
+    writer_.finish();
     fclose(fid_);
     dump_ = false;
     grouping_method_ = -1;
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "utilities/async_writer.cuh"
 #include "utilities/gpu_vector.cuh"
 #include <string>
 #include <vector>
@@ -25,15 +26,14 @@ class Dump_Position
 {
 public:
   void parse(const char** param, int num_param, const std::vector<Group>& groups);
-  void preprocess();
+  void preprocess(const bool is_async);
   void process(
     const int step,
     const Box& box,
     const std::vector<Group>& groups,
     const std::vector<std::string>& cpu_atom_symbol,
     const std::vector<int>& cpu_type,
-    GPU_Vector<double>& position_per_atom,
-    std::vector<double>& cpu_position_per_atom);
+    GPU_Vector<double>& position_per_atom);
   void postprocess();
 
 private:
@@ -45,5 +45,6 @@ private:
   FILE* fid_;
   char filename_[200];
   char precision_str_[25];
-  void output_line2(const Box& box, const std::vector<std::string>& cpu_atom_symbol);
+  Async_Writer writer_;
+  void output_line2(const Box& box);
 };
@@ -20,16 +20,18 @@ Dump a restart file
 #include "dump_restart.cuh"
 #include "model/box.cuh"
 #include "model/group.cuh"
+#include "model/read_xyz.cuh"
 #include "utilities/common.cuh"
 #include "utilities/error.cuh"
 #include "utilities/gpu_vector.cuh"
 #include "utilities/read_file.cuh"
+#include <cstring>
 #include <vector>
 
 void Dump_Restart::parse(const char** param, int num_param)
 {
-  if (num_param != 2) {
-    PRINT_INPUT_ERROR("dump_restart should have 1 parameter.");
+  if (num_param != 2 && num_param != 3) {
+    PRINT_INPUT_ERROR("dump_restart should have 1 or 2 parameters.");
   }
   if (!is_valid_int(param[1], &dump_interval_)) {
     PRINT_INPUT_ERROR("restart dump interval should be an integer.");
@@ -37,8 +39,19 @@ void Dump_Restart::parse(const char** param, int num_param)
   if (dump_interval_ <= 0) {
     PRINT_INPUT_ERROR("restart dump interval should > 0.");
   }
+  binary_ = false;
+  if (num_param == 3) {
+    if (strcmp(param[2], "binary") != 0) {
+      PRINT_INPUT_ERROR("The optional parameter of dump_restart can only be binary.");
+    }
+    binary_ = true;
+  }
   dump_ = true;
   printf("Dump restart every %d steps.\n", dump_interval_);
+  if (binary_) {
+    printf("    into restart.bin, which can be used as model.bin.\n");
+    return;
+  }
 
   print_line_1();
   printf("Warning: Starting from GPUMD-v3.4, the velocity data in restart.xyz will be in units of "
@@ -56,6 +69,7 @@ void Dump_Restart::preprocess()
 
 void Dump_Restart::process(
   const int step,
+  const double global_time,
   const Box& box,
   const std::vector<Group>& group,
   const std::vector<std::string>& cpu_atom_symbol,
@@ -71,13 +85,27 @@ void Dump_Restart::process(
   if ((step + 1) % dump_interval_ != 0)
     return;
 
+  position_per_atom.copy_to_host(cpu_position_per_atom.data());
+  velocity_per_atom.copy_to_host(cpu_velocity_per_atom.data());
+
+  if (binary_) {
+    write_model_binary(
+      "restart.bin",
+      step + 1,
+      global_time,
+      box,
+      group,
+      cpu_atom_symbol,
+      cpu_mass,
+      cpu_position_per_atom,
+      cpu_velocity_per_atom);
+    return;
+  }
+
   FILE* fid = my_fopen("restart.xyz", "w");
 
   const int number_of_atoms = cpu_mass.size();
 
-  position_per_atom.copy_to_host(cpu_position_per_atom.data());
-  velocity_per_atom.copy_to_host(cpu_velocity_per_atom.data());
-
   fprintf(fid, "%d\n", number_of_atoms);
 
   fprintf(fid, "triclinic=%c ", box.triclinic ? 'T' : 'F');
@@ -28,6 +28,7 @@ public:
   void preprocess();
   void process(
     const int step,
+    const double global_time,
     const Box& box,
     const std::vector<Group>& group,
     const std::vector<std::string>& cpu_atom_symbol,
@@ -42,4 +43,5 @@ public:
 private:
   bool dump_ = false;
   int dump_interval_ = 1;
+  bool binary_ = false; // write restart.bin instead of restart.xyz
 };
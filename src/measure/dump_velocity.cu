@@ -61,10 +61,11 @@ void Dump_Velocity::parse(const char** param, int num_param, const std::vector<G
   print_line_2();
 }
 
-void Dump_Velocity::preprocess()
+void Dump_Velocity::preprocess(const bool is_async)
 {
   if (dump_) {
     fid_ = my_fopen("velocity.out", "a");
+    writer_.start("dump_velocity", is_async);
   }
 }
 
@@ -89,10 +90,7 @@ __global__ void copy_velocity(
 }
 
 void Dump_Velocity::process(
-  const int step,
-  const std::vector<Group>& groups,
-  GPU_Vector<double>& velocity_per_atom,
-  std::vector<double>& cpu_velocity_per_atom)
+  const int step, const std::vector<Group>& groups, GPU_Vector<double>& velocity_per_atom)
 {
   if (!dump_)
     return;
@@ -100,53 +98,47 @@ void Dump_Velocity::process(
     return;
 
   const int num_atoms_total = velocity_per_atom.size() / 3;
-  const double natural_to_A_per_fs = 1.0 / TIME_UNIT_CONVERSION;
+  const int num_atoms =
+    (grouping_method_ < 0) ? num_atoms_total : groups[grouping_method_].cpu_size[group_id_];
 
+  std::vector<double>& cpu_velocity = writer_.acquire();
+  cpu_velocity.resize(num_atoms * 3);
   if (grouping_method_ < 0) {
-    velocity_per_atom.copy_to_host(cpu_velocity_per_atom.data());
-    for (int n = 0; n < num_atoms_total; n++) {
-      fprintf(
-        fid_,
-        "%g %g %g\n",
-        cpu_velocity_per_atom[n] * natural_to_A_per_fs,
-        cpu_velocity_per_atom[n + num_atoms_total] * natural_to_A_per_fs,
-        cpu_velocity_per_atom[n + 2 * num_atoms_total] * natural_to_A_per_fs);
-    }
+    velocity_per_atom.copy_to_host(cpu_velocity.data());
   } else {
-    const int group_size = groups[grouping_method_].cpu_size[group_id_];
     const int group_size_sum = groups[grouping_method_].cpu_size_sum[group_id_];
-    GPU_Vector<double> gpu_velocity_tmp(group_size * 3);
-    copy_velocity<<<(group_size - 1) / 128 + 1, 128>>>(
-      group_size,
+    GPU_Vector<double> gpu_velocity_tmp(num_atoms * 3);
+    copy_velocity<<<(num_atoms - 1) / 128 + 1, 128>>>(
+      num_atoms,
       group_size_sum,
       groups[grouping_method_].contents.data(),
       velocity_per_atom.data(),
       velocity_per_atom.data() + num_atoms_total,
       velocity_per_atom.data() + 2 * num_atoms_total,
       gpu_velocity_tmp.data(),
-      gpu_velocity_tmp.data() + group_size,
-      gpu_velocity_tmp.data() + group_size * 2);
-    for (int d = 0; d < 3; ++d) {
-      double* cpu_v = cpu_velocity_per_atom.data() + num_atoms_total * d;
-      double* gpu_v = gpu_velocity_tmp.data() + group_size * d;
-      CHECK(cudaMemcpy(cpu_v, gpu_v, sizeof(double) * group_size, cudaMemcpyDeviceToHost));
-    }
-    for (int n = 0; n < group_size; n++) {
+      gpu_velocity_tmp.data() + num_atoms,
+      gpu_velocity_tmp.data() + num_atoms * 2);
+    gpu_velocity_tmp.copy_to_host(cpu_velocity.data());
+  }
+
+  writer_.submit([this, num_atoms](const std::vector<double>& cpu_velocity) {
+    const double natural_to_A_per_fs = 1.0 / TIME_UNIT_CONVERSION;
+    for (int n = 0; n < num_atoms; n++) {
       fprintf(
         fid_,
         "%g %g %g\n",
-        cpu_velocity_per_atom[n] * natural_to_A_per_fs,
-        cpu_velocity_per_atom[n + num_atoms_total] * natural_to_A_per_fs,
-        cpu_velocity_per_atom[n + 2 * num_atoms_total] * natural_to_A_per_fs);
+        cpu_velocity[n] * natural_to_A_per_fs,
+        cpu_velocity[n + num_atoms] * natural_to_A_per_fs,
+        cpu_velocity[n + 2 * num_atoms] * natural_to_A_per_fs);
     }
-  }
-
-  fflush(fid_);
+    fflush(fid_);
+  });
 }
 
 void Dump_Velocity::postprocess()
 {
   if (dump_) {
+    writer_.finish();
     fclose(fid_);
     dump_ = false;
     grouping_method_ = -1;
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "utilities/async_writer.cuh"
 #include "utilities/gpu_vector.cuh"
 #include <vector>
 class Group;
@@ -23,12 +24,9 @@ class Dump_Velocity
 {
 public:
   void parse(const char** param, int num_param, const std::vector<Group>& groups);
-  void preprocess();
-  void process(
-    const int step,
-    const std::vector<Group>& groups,
-    GPU_Vector<double>& velocity_per_atom,
-    std::vector<double>& cpu_velocity_per_atom);
+  void preprocess(const bool is_async);
+  void
+  process(const int step, const std::vector<Group>& groups, GPU_Vector<double>& velocity_per_atom);
   void postprocess();
 
 private:
@@ -38,4 +36,5 @@ private:
   int group_id_ = -1;
   FILE* fid_;
   char filename_[200];
+  Async_Writer writer_;
 };
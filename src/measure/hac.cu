@@ -20,7 +20,10 @@ Calculate the heat current autocorrelation (HAC) function.
 #include "compute_heat.cuh"
 #include "hac.cuh"
 #include "utilities/common.cuh"
+#include "utilities/correlation.cuh"
+#include "utilities/error.cuh"
 #include "utilities/read_file.cuh"
+#include <algorithm>
 #include <cstring>
 #include <vector>
 
@@ -91,63 +94,38 @@ void HAC::process(
   CUDA_CHECK_KERNEL
 }
 
-// Calculate the Heat current Auto-Correlation function (HAC)
-__global__ void gpu_find_hac(const int Nc, const int Nd, const double* g_heat, double* g_hac)
+// Calculate the Heat current Auto-Correlation function (HAC) by FFT on the host, streaming
+// blocks of the heat current from the device; the in and out parts of each direction are
+// correlated with the total heat current in that direction
+static void find_hac(const int Nc, const int Nd, const double* g_heat, double* hac)
 {
-  //<<<Nc, 128>>>
-
-  __shared__ double s_hac_xi[128];
-  __shared__ double s_hac_xo[128];
-  __shared__ double s_hac_yi[128];
-  __shared__ double s_hac_yo[128];
-  __shared__ double s_hac_z[128];
-
-  int tid = threadIdx.x;
-  int bid = blockIdx.x;
-  int number_of_patches = (Nd - 1) / 128 + 1;
-  int number_of_data = Nd - bid;
-
-  s_hac_xi[tid] = 0.0;
-  s_hac_xo[tid] = 0.0;
-  s_hac_yi[tid] = 0.0;
-  s_hac_yo[tid] = 0.0;
-  s_hac_z[tid] = 0.0;
-
-  for (int patch = 0; patch < number_of_patches; ++patch) {
-    int index = tid + patch * 128;
-    if (index + bid < Nd) {
-      s_hac_xi[tid] += g_heat[index + Nd * 0] * g_heat[index + bid + Nd * 0] +
-                       g_heat[index + Nd * 0] * g_heat[index + bid + Nd * 1];
-      s_hac_xo[tid] += g_heat[index + Nd * 1] * g_heat[index + bid + Nd * 1] +
-                       g_heat[index + Nd * 1] * g_heat[index + bid + Nd * 0];
-      s_hac_yi[tid] += g_heat[index + Nd * 2] * g_heat[index + bid + Nd * 2] +
-                       g_heat[index + Nd * 2] * g_heat[index + bid + Nd * 3];
-      s_hac_yo[tid] += g_heat[index + Nd * 3] * g_heat[index + bid + Nd * 3] +
-                       g_heat[index + Nd * 3] * g_heat[index + bid + Nd * 2];
-      s_hac_z[tid] += g_heat[index + Nd * 4] * g_heat[index + bid + Nd * 4];
+  Correlation correlation(NUM_OF_HEAT_COMPONENTS, Nc);
+  const int block_size = correlation.block_size();
+  std::vector<double> heat(NUM_OF_HEAT_COMPONENTS * block_size);
+  std::vector<double> heat_total(NUM_OF_HEAT_COMPONENTS * block_size);
+
+  for (int nd = 0; nd < Nd; nd += block_size) {
+    const int num_samples = std::min(block_size, Nd - nd);
+    for (int k = 0; k < NUM_OF_HEAT_COMPONENTS; ++k) {
+      CHECK(cudaMemcpy(
+        heat.data() + num_samples * k,
+        g_heat + Nd * k + nd,
+        sizeof(double) * num_samples,
+        cudaMemcpyDeviceToHost));
     }
-  }
-  __syncthreads();
-
-#pragma unroll
-  for (int offset = blockDim.x >> 1; offset > 0; offset >>= 1) {
-    if (tid < offset) {
-      s_hac_xi[tid] += s_hac_xi[tid + offset];
-      s_hac_xo[tid] += s_hac_xo[tid + offset];
-      s_hac_yi[tid] += s_hac_yi[tid + offset];
-      s_hac_yo[tid] += s_hac_yo[tid + offset];
-      s_hac_z[tid] += s_hac_z[tid + offset];
+    for (int n = 0; n < num_samples; ++n) {
+      const double heat_x = heat[n + num_samples * 0] + heat[n + num_samples * 1];
+      const double heat_y = heat[n + num_samples * 2] + heat[n + num_samples * 3];
+      heat_total[n + num_samples * 0] = heat_x;
+      heat_total[n + num_samples * 1] = heat_x;
+      heat_total[n + num_samples * 2] = heat_y;
+      heat_total[n + num_samples * 3] = heat_y;
+      heat_total[n + num_samples * 4] = heat[n + num_samples * 4];
     }
-    __syncthreads();
+    correlation.add(heat.data(), heat_total.data(), num_samples);
   }
 
-  if (tid == 0) {
-    g_hac[bid + Nc * 0] = s_hac_xi[0] / number_of_data;
-    g_hac[bid + Nc * 1] = s_hac_xo[0] / number_of_data;
-    g_hac[bid + Nc * 2] = s_hac_yi[0] / number_of_data;
-    g_hac[bid + Nc * 3] = s_hac_yo[0] / number_of_data;
-    g_hac[bid + Nc * 4] = s_hac_z[0] / number_of_data;
-  }
+  correlation.get_correlation(hac);
 }
 
 // Calculate the Running Thermal Conductivity (RTC) from the HAC
@@ -177,14 +155,9 @@ void HAC::postprocess(
 
   // major data
   std::vector<double> rtc(Nc * NUM_OF_HEAT_COMPONENTS, 0.0);
-  GPU_Vector<double> hac_gpu(Nc * NUM_OF_HEAT_COMPONENTS);
   std::vector<double> hac_cpu(Nc * NUM_OF_HEAT_COMPONENTS);
 
-  // Here, the block size is fixed to 128, which is a good choice
-  gpu_find_hac<<<Nc, 128>>>(Nc, Nd, heat_all.data(), hac_gpu.data());
-  CUDA_CHECK_KERNEL
-
-  hac_gpu.copy_to_host(hac_cpu.data());
+  find_hac(Nc, Nd, heat_all.data(), hac_cpu.data());
 
   double factor = dt * 0.5 / (K_B * temperature * temperature * volume);
   factor *= KAPPA_UNIT_CONVERSION;
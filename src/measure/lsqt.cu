@@ -15,6 +15,7 @@
 
 #include "force/neighbor.cuh"
 #include "lsqt.cuh"
+#include "lsqt_utilities.cuh"
 #include "model/atom.cuh"
 #include "model/box.cuh"
 #include "utilities/common.cuh"
@@ -22,6 +23,8 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
 
 /*----------------------------------------------------------------------------80
     This file implements the linear-scaling quantum transport (LSQT) method
@@ -32,6 +35,10 @@
         charge:      e
         energy:      eV
         time:        hbar/eV
+
+    A block of R = number_of_vectors random states is propagated together,
+    stored as s[n * R + r], and the Hamiltonian is stored in the CSR format
+    (see lsqt_utilities.cuh). The results are averaged over the R states.
 ------------------------------------------------------------------------------*/
 
 namespace
@@ -73,8 +80,9 @@ __global__ void gpu_chebyshev_01(
 // will be used for U(t)
 __global__ void gpu_chebyshev_2(
   int N,
+  int R,
   double Em_inv,
-  int* NN,
+  int* row_ptr,
   int* NL,
   double* U,
   double* Hr,
@@ -91,22 +99,10 @@ __global__ void gpu_chebyshev_2(
   int label)
 {
   int n = blockIdx.x * blockDim.x + threadIdx.x;
-  if (n < N) {
-    double temp_real = U[n] * s1r[n]; // on-site
-    double temp_imag = U[n] * s1i[n]; // on-site
-    int neighbor_number = NN[n];
-    for (int m = 0; m < neighbor_number; ++m) {
-      int index_1 = m * N + n;
-      int index_2 = NL[index_1];
-      double a = Hr[index_1];
-      double b = Hi[index_1];
-      double c = s1r[index_2];
-      double d = s1i[index_2];
-      temp_real += a * c - b * d; // hopping
-      temp_imag += a * d + b * c; // hopping
-    }
-    temp_real *= Em_inv; // scale
-    temp_imag *= Em_inv; // scale
+  if (n < N * R) {
+    double temp_real, temp_imag;
+    lsqt_apply_hamiltonian(
+      n / R, n % R, R, Em_inv, row_ptr, NL, U, Hr, Hi, s1r, s1i, temp_real, temp_imag);
 
     temp_real = 2.0 * temp_real - s0r[n];
     temp_imag = 2.0 * temp_imag - s0i[n];
@@ -140,8 +136,9 @@ __global__ void gpu_chebyshev_2(
 // for KPM
 __global__ void gpu_kernel_polynomial(
   int N,
+  int R,
   double Em_inv,
-  int* NN,
+  int* row_ptr,
   int* NL,
   double* U,
   double* Hr,
@@ -154,24 +151,10 @@ __global__ void gpu_kernel_polynomial(
   double* s2i)
 {
   int n = blockIdx.x * blockDim.x + threadIdx.x;
-  if (n < N) {
-
-    double temp_real = U[n] * s1r[n]; // on-site
-    double temp_imag = U[n] * s1i[n]; // on-site
-    int neighbor_number = NN[n];
-    for (int m = 0; m < neighbor_number; ++m) {
-      int index_1 = m * N + n;
-      int index_2 = NL[index_1];
-      double a = Hr[index_1];
-      double b = Hi[index_1];
-      double c = s1r[index_2];
-      double d = s1i[index_2];
-      temp_real += a * c - b * d; // hopping
-      temp_imag += a * d + b * c; // hopping
-    }
-
-    temp_real *= Em_inv; // scale
-    temp_imag *= Em_inv; // scale
+  if (n < N * R) {
+    double temp_real, temp_imag;
+    lsqt_apply_hamiltonian(
+      n / R, n % R, R, Em_inv, row_ptr, NL, U, Hr, Hi, s1r, s1i, temp_real, temp_imag);
 
     temp_real = 2.0 * temp_real - s0r[n];
     temp_imag = 2.0 * temp_imag - s0i[n];
@@ -183,8 +166,9 @@ __global__ void gpu_kernel_polynomial(
 // apply the Hamiltonian: H * si = so
 __global__ void gpu_apply_hamiltonian(
   int N,
+  int R,
   double Em_inv,
-  int* NN,
+  int* row_ptr,
   int* NL,
   double* U,
   double* Hr,
@@ -195,31 +179,17 @@ __global__ void gpu_apply_hamiltonian(
   double* soi)
 {
   int n = blockIdx.x * blockDim.x + threadIdx.x;
-  if (n < N) {
-    double temp_real = U[n] * sir[n]; // on-site
-    double temp_imag = U[n] * sii[n]; // on-site
-    int neighbor_number = NN[n];
-    for (int m = 0; m < neighbor_number; ++m) {
-      int index_1 = m * N + n;
-      int index_2 = NL[index_1];
-      double a = Hr[index_1];
-      double b = Hi[index_1];
-      double c = sir[index_2];
-      double d = sii[index_2];
-      temp_real += a * c - b * d; // hopping
-      temp_imag += a * d + b * c; // hopping
-    }
-    temp_real *= Em_inv; // scale
-    temp_imag *= Em_inv; // scale
-    sor[n] = temp_real;
-    soi[n] = temp_imag;
+  if (n < N * R) {
+    lsqt_apply_hamiltonian(
+      n / R, n % R, R, Em_inv, row_ptr, NL, U, Hr, Hi, sir, sii, sor[n], soi[n]);
   }
 }
 
 // so = V * si (no scaling; no on-site)
 __global__ void gpu_apply_current(
   int N,
-  int* NN,
+  int R,
+  int* row_ptr,
   int* NL,
   double* Hr,
   double* Hi,
@@ -230,23 +200,8 @@ __global__ void gpu_apply_current(
   double* soi)
 {
   int n = blockIdx.x * blockDim.x + threadIdx.x;
-  if (n < N) {
-    double temp_real = 0.0;
-    double temp_imag = 0.0;
-    int neighbor_number = NN[n];
-    for (int m = 0; m < neighbor_number; ++m) {
-      int index_1 = m * N + n;
-      int index_2 = NL[index_1];
-      double a = Hr[index_1];
-      double b = Hi[index_1];
-      double c = sir[index_2];
-      double d = sii[index_2];
-      double xx = g_xx[index_1];
-      temp_real += (a * c - b * d) * xx;
-      temp_imag += (a * d + b * c) * xx;
-    }
-    sor[n] = +temp_imag;
-    soi[n] = -temp_real;
+  if (n < N * R) {
+    lsqt_apply_current(n / R, n % R, R, row_ptr, NL, Hr, Hi, g_xx, sir, sii, sor[n], soi[n]);
   }
 }
 
@@ -297,88 +252,6 @@ __global__ void gpu_find_inner_product_2(
     moments[blockIdx.x] = s_data[0];
 }
 
-// get the Chebyshev moments: <sl|T_m(H)|sr>
-void find_moments_chebyshev(
-  int N,
-  int Nm,
-  double Em,
-  int* NN,
-  int* NL,
-  double* U,
-  double* Hr,
-  double* Hi,
-  double* slr,
-  double* sli,
-  double* srr,
-  double* sri,
-  double* moments)
-{
-  int grid_size = (N - 1) / BLOCK_SIZE_EC + 1;
-  int number_of_blocks = grid_size;
-  int number_of_patches = (number_of_blocks - 1) / BLOCK_SIZE_EC + 1;
-
-  int memory_moments = sizeof(double) * Nm;
-  int memory_moments_tmp = memory_moments * grid_size;
-  double Em_inv = 1.0 / Em;
-
-  double *s0r, *s1r, *s2r, *s0i, *s1i, *s2i, *moments_tmp;
-  cudaMalloc((void**)&s0r, sizeof(double) * N);
-  cudaMalloc((void**)&s1r, sizeof(double) * N);
-  cudaMalloc((void**)&s2r, sizeof(double) * N);
-  cudaMalloc((void**)&s0i, sizeof(double) * N);
-  cudaMalloc((void**)&s1i, sizeof(double) * N);
-  cudaMalloc((void**)&s2i, sizeof(double) * N);
-  cudaMalloc((void**)&moments_tmp, memory_moments_tmp);
-
-  // T_0(H)
-  gpu_copy_state<<<grid_size, BLOCK_SIZE_EC>>>(N, srr, sri, s0r, s0i);
-  CUDA_CHECK_KERNEL
-  gpu_find_inner_product_1<<<grid_size, BLOCK_SIZE_EC>>>(
-    N, s0r, s0i, slr, sli, moments_tmp, 0 * grid_size);
-  CUDA_CHECK_KERNEL
-
-  // T_1(H)
-  gpu_apply_hamiltonian<<<grid_size, BLOCK_SIZE_EC>>>(
-    N, Em_inv, NN, NL, U, Hr, Hi, s0r, s0i, s1r, s1i);
-  CUDA_CHECK_KERNEL
-  gpu_find_inner_product_1<<<grid_size, BLOCK_SIZE_EC>>>(
-    N, s1r, s1i, slr, sli, moments_tmp, 1 * grid_size);
-  CUDA_CHECK_KERNEL
-
-  // T_m(H) (m >= 2)
-  for (int m = 2; m < Nm; ++m) {
-    gpu_kernel_polynomial<<<grid_size, BLOCK_SIZE_EC>>>(
-      N, Em_inv, NN, NL, U, Hr, Hi, s0r, s0i, s1r, s1i, s2r, s2i);
-    CUDA_CHECK_KERNEL
-    gpu_find_inner_product_1<<<grid_size, BLOCK_SIZE_EC>>>(
-      N, s2r, s2i, slr, sli, moments_tmp, m * grid_size);
-    CUDA_CHECK_KERNEL
-    // permute the pointers; do not need to copy the data
-    double* temp_real;
-    double* temp_imag;
-    temp_real = s0r;
-    temp_imag = s0i;
-    s0r = s1r;
-    s0i = s1i;
-    s1r = s2r;
-    s1i = s2i;
-    s2r = temp_real;
-    s2i = temp_imag;
-  }
-
-  gpu_find_inner_product_2<<<Nm, BLOCK_SIZE_EC>>>(
-    number_of_blocks, number_of_patches, moments_tmp, moments);
-  CUDA_CHECK_KERNEL
-
-  cudaFree(s0r);
-  cudaFree(s0i);
-  cudaFree(s1r);
-  cudaFree(s1i);
-  cudaFree(s2r);
-  cudaFree(s2i);
-  cudaFree(moments_tmp);
-}
-
 // Jackson damping
 void apply_damping(int Nm, double* moments)
 {
@@ -412,90 +285,15 @@ void perform_chebyshev_summation(
   }
 }
 
-// direction = +1: U(+t) |state>
-// direction = -1: U(-t) |state>
-void evolve(
-  int N,
-  double Em,
-  int direction,
-  double time_step_scaled,
-  int* NN,
-  int* NL,
-  double* U,
-  double* Hr,
-  double* Hi,
-  double* sr,
-  double* si)
+// number of nonzero hoppings of each orbital
+__global__ void gpu_find_row_size(const int N, const int* NN_atom, int* NN)
 {
-  int grid_size = (N - 1) / BLOCK_SIZE_EC + 1;
-  double Em_inv = 1.0 / Em;
-  double* s0r;
-  double* s1r;
-  double* s2r;
-  double* s0i;
-  double* s1i;
-  double* s2i;
-  cudaMalloc((void**)&s0r, sizeof(double) * N);
-  cudaMalloc((void**)&s0i, sizeof(double) * N);
-  cudaMalloc((void**)&s1r, sizeof(double) * N);
-  cudaMalloc((void**)&s1i, sizeof(double) * N);
-  cudaMalloc((void**)&s2r, sizeof(double) * N);
-  cudaMalloc((void**)&s2i, sizeof(double) * N);
-
-  // T_0(H) |psi> = |psi>
-  gpu_copy_state<<<grid_size, BLOCK_SIZE_EC>>>(N, sr, si, s0r, s0i);
-  CUDA_CHECK_KERNEL
-
-  // T_1(H) |psi> = H |psi>
-  gpu_apply_hamiltonian<<<grid_size, BLOCK_SIZE_EC>>>(
-    N, Em_inv, NN, NL, U, Hr, Hi, sr, si, s1r, s1i);
-  CUDA_CHECK_KERNEL
-
-  // |final_state> = c_0 * T_0(H) |psi> + c_1 * T_1(H) |psi>
-  double bessel_0 = j0(time_step_scaled);
-  double bessel_1 = 2.0 * j1(time_step_scaled);
-  gpu_chebyshev_01<<<grid_size, BLOCK_SIZE_EC>>>(
-    N, s0r, s0i, s1r, s1i, sr, si, bessel_0, bessel_1, direction);
-  CUDA_CHECK_KERNEL
-
-  for (int m = 2; m < 1000000; ++m) {
-    double bessel_m = jn(m, time_step_scaled);
-    if (bessel_m < 1.0e-15 && bessel_m > -1.0e-15) {
-      break;
-    }
-    bessel_m *= 2.0;
-    int label;
-    int m_mod_4 = m % 4;
-    if (m_mod_4 == 0) {
-      label = 1;
-    } else if (m_mod_4 == 2) {
-      label = 2;
-    } else if ((m_mod_4 == 1 && direction == 1) || (m_mod_4 == 3 && direction == -1)) {
-      label = 3;
-    } else {
-      label = 4;
+  int n1 = blockIdx.x * blockDim.x + threadIdx.x;
+  if (n1 < N) {
+    for (int k = 0; k < number_of_orbitals_per_atom; ++k) {
+      NN[n1 + k * N] = NN_atom[n1] * number_of_orbitals_per_atom;
     }
-    gpu_chebyshev_2<<<grid_size, BLOCK_SIZE_EC>>>(
-      N, Em_inv, NN, NL, U, Hr, Hi, s0r, s0i, s1r, s1i, s2r, s2i, sr, si, bessel_m, label);
-    CUDA_CHECK_KERNEL
-
-    // permute the pointers; do not need to copy the data
-    double *temp_real, *temp_imag;
-    temp_real = s0r;
-    temp_imag = s0i;
-    s0r = s1r;
-    s0i = s1i;
-    s1r = s2r;
-    s1i = s2i;
-    s2r = temp_real;
-    s2i = temp_imag;
   }
-  cudaFree(s0r);
-  cudaFree(s0i);
-  cudaFree(s1r);
-  cudaFree(s1i);
-  cudaFree(s2r);
-  cudaFree(s2i);
 }
 
 #ifdef USE_GRAPHENE_TB
@@ -508,7 +306,7 @@ __global__ void gpu_initialize_model(
   const double* z,
   const int* NN_atom,
   const int* NL_atom,
-  int* NN,
+  const int* row_ptr,
   int* NL,
   double* U,
   double* Hr,
@@ -518,13 +316,12 @@ __global__ void gpu_initialize_model(
   int n1 = blockIdx.x * blockDim.x + threadIdx.x;
   if (n1 < N) {
     int neighbor_number = NN_atom[n1];
-    NN[n1] = neighbor_number;
     double x1 = x[n1];
     double y1 = y[n1];
     double z1 = z[n1];
     for (int i1 = 0; i1 < neighbor_number; ++i1) {
-      int index = n1 + N * i1;
-      int n2 = NL_atom[index];
+      int n2 = NL_atom[n1 + N * i1];
+      int index = row_ptr[n1] + i1;
       NL[index] = n2;
       double x12 = x[n2] - x1;
       double y12 = y[n2] - y1;
@@ -560,7 +357,7 @@ __global__ void gpu_initialize_model(
   const double* z,
   const int* NN_atom,
   const int* NL_atom,
-  int* NN,
+  const int* row_ptr,
   int* NL,
   double* U,
   double* Hr,
@@ -571,7 +368,6 @@ __global__ void gpu_initialize_model(
   if (n1 < N) {
     int neighbor_number = NN_atom[n1];
     for (int k = 0; k < number_of_orbitals_per_atom; ++k) {
-      NN[n1 + k * N] = neighbor_number * number_of_orbitals_per_atom;
       U[n1 + k * N] = tb.onsite[k];
     }
 
@@ -622,8 +418,7 @@ __global__ void gpu_initialize_model(
 
       for (int k1 = 0; k1 < number_of_orbitals_per_atom; ++k1) {
         for (int k2 = 0; k2 < number_of_orbitals_per_atom; ++k2) {
-          int index_orbital =
-            (n1 + k1 * N) + (N * number_of_orbitals_per_atom) * (i1 + k2 * neighbor_number);
+          int index_orbital = row_ptr[n1 + k1 * N] + i1 * number_of_orbitals_per_atom + k2;
           NL[index_orbital] = n2 + k2 * N;
           if (direction == 1) {
             xx[index_orbital] = x12;
@@ -642,36 +437,13 @@ __global__ void gpu_initialize_model(
 }
 #endif
 
-void find_dos_or_others(
-  int N,
-  int Nm,
-  int Ne,
-  double Em,
-  double* E,
-  int* NN,
-  int* NL,
-  double* U,
-  double* Hr,
-  double* Hi,
-  double* slr,
-  double* sli,
-  double* srr,
-  double* sri,
-  double* dos_or_others)
-{
-  std::vector<double> moments_cpu(Nm);
-  GPU_Vector<double> moments_gpu(Nm);
-  find_moments_chebyshev(N, Nm, Em, NN, NL, U, Hr, Hi, slr, sli, srr, sri, moments_gpu.data());
-  moments_gpu.copy_to_host(moments_cpu.data());
-  apply_damping(Nm, moments_cpu.data());
-  perform_chebyshev_summation(Nm, Ne, Em, E, moments_cpu.data(), dos_or_others);
-}
-
-void initialize_state(int N, GPU_Vector<double>& sr, GPU_Vector<double>& si)
+// random phases for all the states of the block
+void initialize_state(GPU_Vector<double>& sr, GPU_Vector<double>& si)
 {
-  std::vector<double> sr_cpu(N);
-  std::vector<double> si_cpu(N);
-  for (int n = 0; n < N; ++n) {
+  const int size = sr.size();
+  std::vector<double> sr_cpu(size);
+  std::vector<double> si_cpu(size);
+  for (int n = 0; n < size; ++n) {
     double random_phase = rand() / double(RAND_MAX) * 2.0 * PI;
     sr_cpu[n] = cos(random_phase);
     si_cpu[n] = sin(random_phase);
@@ -702,6 +474,7 @@ void LSQT::preprocess(Atom& atom, int number_of_steps, double time_step)
   NN_atom.resize(number_of_atoms);
   NL_atom.resize(number_of_atoms * number_of_neighbors_per_atom);
   NN.resize(number_of_orbitals);
+  row_ptr.resize(number_of_orbitals + 1, 0);
   NL.resize(number_of_orbitals * number_of_neighbors_per_orbital);
 
   xx.resize(number_of_orbitals * number_of_neighbors_per_orbital);
@@ -711,12 +484,25 @@ void LSQT::preprocess(Atom& atom, int number_of_steps, double time_step)
 
   sigma.resize(number_of_energy_points);
 
-  slr.resize(number_of_orbitals);
-  sli.resize(number_of_orbitals);
-  srr.resize(number_of_orbitals);
-  sri.resize(number_of_orbitals);
-  scr.resize(number_of_orbitals);
-  sci.resize(number_of_orbitals);
+  const int block_size = number_of_orbitals * number_of_vectors;
+  slr.resize(block_size);
+  sli.resize(block_size);
+  srr.resize(block_size);
+  sri.resize(block_size);
+  scr.resize(block_size);
+  sci.resize(block_size);
+  sdr.resize(block_size);
+  sdi.resize(block_size);
+  sxr.resize(block_size);
+  sxi.resize(block_size);
+  s0r.resize(block_size);
+  s0i.resize(block_size);
+  s1r.resize(block_size);
+  s1i.resize(block_size);
+  s2r.resize(block_size);
+  s2i.resize(block_size);
+  moments.resize(number_of_moments);
+  moments_tmp.resize(number_of_moments * ((block_size - 1) / BLOCK_SIZE_EC + 1));
 }
 
 void LSQT::process(Atom& atom, Box& box, const int step)
@@ -738,6 +524,13 @@ void LSQT::process(Atom& atom, Box& box, const int step)
     NN_atom,
     NL_atom);
 
+  // the CSR row pointers, with row_ptr[0] = 0
+  gpu_find_row_size<<<(number_of_atoms - 1) / 64 + 1, 64>>>(
+    number_of_atoms, NN_atom.data(), NN.data());
+  CUDA_CHECK_KERNEL
+  thrust::inclusive_scan(
+    thrust::device, NN.data(), NN.data() + number_of_orbitals, row_ptr.data() + 1);
+
   gpu_initialize_model<<<(number_of_atoms - 1) / 64 + 1, 64>>>(
     box,
 #ifndef USE_GRAPHENE_TB
@@ -750,7 +543,7 @@ void LSQT::process(Atom& atom, Box& box, const int step)
     atom.position_per_atom.data() + number_of_atoms * 2,
     NN_atom.data(),
     NL_atom.data(),
-    NN.data(),
+    row_ptr.data(),
     NL.data(),
     U.data(),
     Hr.data(),
@@ -762,35 +555,209 @@ void LSQT::process(Atom& atom, Box& box, const int step)
   find_sigma(atom, box, step);
 }
 
-void LSQT::find_dos_and_velocity(Atom& atom, Box& box)
+// so = V * si for the block of states
+void LSQT::apply_current(double* sir, double* sii, double* sor, double* soi)
 {
-  std::vector<double> dos(number_of_energy_points);
-  std::vector<double> velocity(number_of_energy_points);
+  const int block_size = number_of_orbitals * number_of_vectors;
+  gpu_apply_current<<<(block_size - 1) / 64 + 1, 64>>>(
+    number_of_orbitals,
+    number_of_vectors,
+    row_ptr.data(),
+    NL.data(),
+    Hr.data(),
+    Hi.data(),
+    xx.data(),
+    sir,
+    sii,
+    sor,
+    soi);
+  CUDA_CHECK_KERNEL
+}
 
-  GPU_Vector<double> sr(number_of_orbitals);
-  GPU_Vector<double> si(number_of_orbitals);
-  GPU_Vector<double> sxr(number_of_orbitals);
-  GPU_Vector<double> sxi(number_of_orbitals);
+// get the Chebyshev moments: sum_r <sl_r|T_m(H)|sr_r>
+void LSQT::find_moments_chebyshev(double* slr, double* sli, double* srr, double* sri)
+{
+  const int N = number_of_orbitals;
+  const int R = number_of_vectors;
+  const int Nm = number_of_moments;
+  int grid_size = (N * R - 1) / BLOCK_SIZE_EC + 1;
+  int number_of_blocks = grid_size;
+  int number_of_patches = (number_of_blocks - 1) / BLOCK_SIZE_EC + 1;
+  double Em_inv = 1.0 / maximum_energy;
 
-  initialize_state(number_of_orbitals, sr, si);
+  // the work arrays are persistent; only the pointers are permuted below
+  double* s0r = this->s0r.data();
+  double* s0i = this->s0i.data();
+  double* s1r = this->s1r.data();
+  double* s1i = this->s1i.data();
+  double* s2r = this->s2r.data();
+  double* s2i = this->s2i.data();
 
-  // dos
-  find_dos_or_others(
-    number_of_orbitals,
+  // T_0(H)
+  gpu_copy_state<<<grid_size, BLOCK_SIZE_EC>>>(N * R, srr, sri, s0r, s0i);
+  CUDA_CHECK_KERNEL
+  gpu_find_inner_product_1<<<grid_size, BLOCK_SIZE_EC>>>(
+    N * R, s0r, s0i, slr, sli, moments_tmp.data(), 0 * grid_size);
+  CUDA_CHECK_KERNEL
+
+  // T_1(H)
+  gpu_apply_hamiltonian<<<grid_size, BLOCK_SIZE_EC>>>(
+    N, R, Em_inv, row_ptr.data(), NL.data(), U.data(), Hr.data(), Hi.data(), s0r, s0i, s1r, s1i);
+  CUDA_CHECK_KERNEL
+  gpu_find_inner_product_1<<<grid_size, BLOCK_SIZE_EC>>>(
+    N * R, s1r, s1i, slr, sli, moments_tmp.data(), 1 * grid_size);
+  CUDA_CHECK_KERNEL
+
+  // T_m(H) (m >= 2)
+  for (int m = 2; m < Nm; ++m) {
+    gpu_kernel_polynomial<<<grid_size, BLOCK_SIZE_EC>>>(
+      N,
+      R,
+      Em_inv,
+      row_ptr.data(),
+      NL.data(),
+      U.data(),
+      Hr.data(),
+      Hi.data(),
+      s0r,
+      s0i,
+      s1r,
+      s1i,
+      s2r,
+      s2i);
+    CUDA_CHECK_KERNEL
+    gpu_find_inner_product_1<<<grid_size, BLOCK_SIZE_EC>>>(
+      N * R, s2r, s2i, slr, sli, moments_tmp.data(), m * grid_size);
+    CUDA_CHECK_KERNEL
+    // permute the pointers; do not need to copy the data
+    double* temp_real;
+    double* temp_imag;
+    temp_real = s0r;
+    temp_imag = s0i;
+    s0r = s1r;
+    s0i = s1i;
+    s1r = s2r;
+    s1i = s2i;
+    s2r = temp_real;
+    s2i = temp_imag;
+  }
+
+  gpu_find_inner_product_2<<<Nm, BLOCK_SIZE_EC>>>(
+    number_of_blocks, number_of_patches, moments_tmp.data(), moments.data());
+  CUDA_CHECK_KERNEL
+}
+
+// the correlation averaged over the block of states
+void LSQT::find_dos_or_others(
+  double* slr, double* sli, double* srr, double* sri, double* dos_or_others)
+{
+  std::vector<double> moments_cpu(number_of_moments);
+  find_moments_chebyshev(slr, sli, srr, sri);
+  moments.copy_to_host(moments_cpu.data());
+  for (int m = 0; m < number_of_moments; ++m) {
+    moments_cpu[m] /= number_of_vectors;
+  }
+  apply_damping(number_of_moments, moments_cpu.data());
+  perform_chebyshev_summation(
     number_of_moments,
     number_of_energy_points,
     maximum_energy,
     E.data(),
-    NN.data(),
-    NL.data(),
-    U.data(),
-    Hr.data(),
-    Hi.data(),
-    sr.data(),
-    si.data(),
-    sr.data(),
-    si.data(),
-    dos.data());
+    moments_cpu.data(),
+    dos_or_others);
+}
+
+// direction = +1: U(+t) |state>
+// direction = -1: U(-t) |state>
+void LSQT::evolve(int direction, double time_step_scaled, double* sr, double* si)
+{
+  const int N = number_of_orbitals;
+  const int R = number_of_vectors;
+  int grid_size = (N * R - 1) / BLOCK_SIZE_EC + 1;
+  double Em_inv = 1.0 / maximum_energy;
+  double* s0r = this->s0r.data();
+  double* s0i = this->s0i.data();
+  double* s1r = this->s1r.data();
+  double* s1i = this->s1i.data();
+  double* s2r = this->s2r.data();
+  double* s2i = this->s2i.data();
+
+  // T_0(H) |psi> = |psi>
+  gpu_copy_state<<<grid_size, BLOCK_SIZE_EC>>>(N * R, sr, si, s0r, s0i);
+  CUDA_CHECK_KERNEL
+
+  // T_1(H) |psi> = H |psi>
+  gpu_apply_hamiltonian<<<grid_size, BLOCK_SIZE_EC>>>(
+    N, R, Em_inv, row_ptr.data(), NL.data(), U.data(), Hr.data(), Hi.data(), sr, si, s1r, s1i);
+  CUDA_CHECK_KERNEL
+
+  // |final_state> = c_0 * T_0(H) |psi> + c_1 * T_1(H) |psi>
+  double bessel_0 = j0(time_step_scaled);
+  double bessel_1 = 2.0 * j1(time_step_scaled);
+  gpu_chebyshev_01<<<grid_size, BLOCK_SIZE_EC>>>(
+    N * R, s0r, s0i, s1r, s1i, sr, si, bessel_0, bessel_1, direction);
+  CUDA_CHECK_KERNEL
+
+  for (int m = 2; m < 1000000; ++m) {
+    double bessel_m = jn(m, time_step_scaled);
+    if (bessel_m < 1.0e-15 && bessel_m > -1.0e-15) {
+      break;
+    }
+    bessel_m *= 2.0;
+    int label;
+    int m_mod_4 = m % 4;
+    if (m_mod_4 == 0) {
+      label = 1;
+    } else if (m_mod_4 == 2) {
+      label = 2;
+    } else if ((m_mod_4 == 1 && direction == 1) || (m_mod_4 == 3 && direction == -1)) {
+      label = 3;
+    } else {
+      label = 4;
+    }
+    gpu_chebyshev_2<<<grid_size, BLOCK_SIZE_EC>>>(
+      N,
+      R,
+      Em_inv,
+      row_ptr.data(),
+      NL.data(),
+      U.data(),
+      Hr.data(),
+      Hi.data(),
+      s0r,
+      s0i,
+      s1r,
+      s1i,
+      s2r,
+      s2i,
+      sr,
+      si,
+      bessel_m,
+      label);
+    CUDA_CHECK_KERNEL
+
+    // permute the pointers; do not need to copy the data
+    double *temp_real, *temp_imag;
+    temp_real = s0r;
+    temp_imag = s0i;
+    s0r = s1r;
+    s0i = s1i;
+    s1r = s2r;
+    s1i = s2i;
+    s2r = temp_real;
+    s2i = temp_imag;
+  }
+}
+
+void LSQT::find_dos_and_velocity(Atom& atom, Box& box)
+{
+  std::vector<double> dos(number_of_energy_points);
+  std::vector<double> velocity(number_of_energy_points);
+
+  initialize_state(sdr, sdi);
+
+  // dos
+  find_dos_or_others(sdr.data(), sdi.data(), sdr.data(), sdi.data(), dos.data());
 
   FILE* os_dos = my_fopen("lsqt_dos.out", "a");
   for (int n = 0; n < number_of_energy_points; ++n)
@@ -799,34 +766,8 @@ void LSQT::find_dos_and_velocity(Atom& atom, Box& box)
   fclose(os_dos);
 
   // velocity
-  gpu_apply_current<<<(number_of_orbitals - 1) / 64 + 1, 64>>>(
-    number_of_orbitals,
-    NN.data(),
-    NL.data(),
-    Hr.data(),
-    Hi.data(),
-    xx.data(),
-    sr.data(),
-    si.data(),
-    sxr.data(),
-    sxi.data());
-
-  find_dos_or_others(
-    number_of_orbitals,
-    number_of_moments,
-    number_of_energy_points,
-    maximum_energy,
-    E.data(),
-    NN.data(),
-    NL.data(),
-    U.data(),
-    Hr.data(),
-    Hi.data(),
-    sxr.data(),
-    sxi.data(),
-    sxr.data(),
-    sxi.data(),
-    velocity.data());
+  apply_current(sdr.data(), sdi.data(), sxr.data(), sxi.data());
+  find_dos_or_others(sxr.data(), sxi.data(), sxr.data(), sxi.data(), velocity.data());
 
   FILE* os_vel = my_fopen("lsqt_velocity.out", "a");
   const double m_per_s_conversion = 1.60217663e5 / 1.054571817;
@@ -842,78 +783,17 @@ void LSQT::find_sigma(Atom& atom, Box& box, const int step)
   double V = box.get_volume();
 
   if (step == 0) {
-    initialize_state(number_of_orbitals, slr, sli);
-    gpu_apply_current<<<(number_of_orbitals - 1) / 64 + 1, 64>>>(
-      number_of_orbitals,
-      NN.data(),
-      NL.data(),
-      Hr.data(),
-      Hi.data(),
-      xx.data(),
-      slr.data(),
-      sli.data(),
-      srr.data(),
-      sri.data());
-    CUDA_CHECK_KERNEL
+    initialize_state(slr, sli);
+    apply_current(slr.data(), sli.data(), srr.data(), sri.data());
   } else {
-    evolve(
-      number_of_orbitals,
-      maximum_energy,
-      -1,
-      time_step_scaled,
-      NN.data(),
-      NL.data(),
-      U.data(),
-      Hr.data(),
-      Hi.data(),
-      slr.data(),
-      sli.data());
-
-    evolve(
-      number_of_orbitals,
-      maximum_energy,
-      -1,
-      time_step_scaled,
-      NN.data(),
-      NL.data(),
-      U.data(),
-      Hr.data(),
-      Hi.data(),
-      srr.data(),
-      sri.data());
+    evolve(-1, time_step_scaled, slr.data(), sli.data());
+    evolve(-1, time_step_scaled, srr.data(), sri.data());
   }
 
-  gpu_apply_current<<<(number_of_orbitals - 1) / 64 + 1, 64>>>(
-    number_of_orbitals,
-    NN.data(),
-    NL.data(),
-    Hr.data(),
-    Hi.data(),
-    xx.data(),
-    slr.data(),
-    sli.data(),
-    scr.data(),
-    sci.data());
-  CUDA_CHECK_KERNEL
+  apply_current(slr.data(), sli.data(), scr.data(), sci.data());
 
   std::vector<double> vac(number_of_energy_points);
-
-  find_dos_or_others(
-    number_of_orbitals,
-    number_of_moments,
-    number_of_energy_points,
-    maximum_energy,
-    E.data(),
-    NN.data(),
-    NL.data(),
-    U.data(),
-    Hr.data(),
-    Hi.data(),
-    scr.data(),
-    sci.data(),
-    srr.data(),
-    sri.data(),
-    vac.data());
+  find_dos_or_others(scr.data(), sci.data(), srr.data(), sri.data(), vac.data());
 
   FILE* os_sigma = my_fopen("lsqt_sigma.out", "a");
   const double S_per_m_conversion = 7.748091729e5 * PI;
@@ -932,8 +812,8 @@ void LSQT::parse(const char** param, const int num_param)
   printf("Compute LSQT.\n");
   compute = true;
 
-  if (num_param < 7) {
-    PRINT_INPUT_ERROR("compute_lsqt should have at least 6 parameters.\n");
+  if (num_param != 7 && num_param != 8) {
+    PRINT_INPUT_ERROR("compute_lsqt should have 6 or 7 parameters.\n");
   }
 
   // transport direction
@@ -995,6 +875,18 @@ void LSQT::parse(const char** param, const int num_param)
   }
   printf("    maximum energy is %g eV.\n", maximum_energy);
 
+  // number of random vectors propagated together
+  number_of_vectors = 1;
+  if (num_param == 8) {
+    if (!is_valid_int(param[7], &number_of_vectors)) {
+      PRINT_INPUT_ERROR("number of random vectors should be an integer.\n");
+    }
+    if (number_of_vectors < 1) {
+      PRINT_INPUT_ERROR("number of random vectors should >= 1.\n");
+    }
+  }
+  printf("    number of random vectors is %d.\n", number_of_vectors);
+
   E.resize(number_of_energy_points);
   double delta_energy = (end_energy - start_energy) / (number_of_energy_points - 1);
   for (int n = 0; n < number_of_energy_points; ++n) {
@@ -49,6 +49,12 @@ public:
   void find_sigma(Atom& atom, Box& box, const int step);
 
 private:
+  void apply_current(double* sir, double* sii, double* sor, double* soi);
+  void find_moments_chebyshev(double* slr, double* sli, double* srr, double* sri);
+  void find_dos_or_others(
+    double* slr, double* sli, double* srr, double* sri, double* dos_or_others);
+  void evolve(int direction, double time_step_scaled, double* sr, double* si);
+
 #ifndef USE_GRAPHENE_TB
   TB tb;
 #endif
@@ -58,6 +64,7 @@ private:
   int transport_direction;
   int number_of_moments;
   int number_of_energy_points;
+  int number_of_vectors = 1; // number of random states propagated together
   int number_of_steps;
   double maximum_energy;
   double time_step;
@@ -67,8 +74,9 @@ private:
   GPU_Vector<int> cell_contents;
   GPU_Vector<int> NN_atom;
   GPU_Vector<int> NL_atom;
-  GPU_Vector<int> NN;
-  GPU_Vector<int> NL;
+  GPU_Vector<int> NN;      // number of nonzero hoppings of each orbital
+  GPU_Vector<int> row_ptr; // CSR row pointers of the Hamiltonian
+  GPU_Vector<int> NL;      // CSR column indices of the Hamiltonian
 
   GPU_Vector<double> xx;
   GPU_Vector<double> Hr;
@@ -81,6 +89,20 @@ private:
   GPU_Vector<double> sri;
   GPU_Vector<double> scr;
   GPU_Vector<double> sci;
+  GPU_Vector<double> sdr;
+  GPU_Vector<double> sdi;
+  GPU_Vector<double> sxr;
+  GPU_Vector<double> sxi;
+
+  // work arrays of the Chebyshev recursion
+  GPU_Vector<double> s0r;
+  GPU_Vector<double> s0i;
+  GPU_Vector<double> s1r;
+  GPU_Vector<double> s1i;
+  GPU_Vector<double> s2r;
+  GPU_Vector<double> s2i;
+  GPU_Vector<double> moments;
+  GPU_Vector<double> moments_tmp;
 
   std::vector<double> E;
   std::vector<double> sigma;
@@ -0,0 +1,94 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+The host reference of the block Chebyshev moments in LSQT.
+------------------------------------------------------------------------------*/
+
+#include "lsqt_utilities.cuh"
+#include <vector>
+
+void find_moments_chebyshev_host(
+  const int N,
+  const int R,
+  const int Nm,
+  const double Em,
+  const int* row_ptr,
+  const int* col,
+  const double* U,
+  const double* Hr,
+  const double* Hi,
+  const double* slr,
+  const double* sli,
+  const double* srr,
+  const double* sri,
+  double* moments)
+{
+  const int size = N * R;
+  const double Em_inv = 1.0 / Em;
+  std::vector<double> s0r(srr, srr + size);
+  std::vector<double> s0i(sri, sri + size);
+  std::vector<double> s1r(size);
+  std::vector<double> s1i(size);
+  std::vector<double> s2r(size);
+  std::vector<double> s2i(size);
+
+  for (int m = 0; m < Nm; ++m) {
+    if (m == 1) {
+      // T_1(H) = H
+#pragma omp parallel for
+      for (int index = 0; index < size; ++index) {
+        lsqt_apply_hamiltonian(
+          index / R,
+          index % R,
+          R,
+          Em_inv,
+          row_ptr,
+          col,
+          U,
+          Hr,
+          Hi,
+          s0r.data(),
+          s0i.data(),
+          s1r[index],
+          s1i[index]);
+      }
+    } else if (m >= 2) {
+      // T_m(H) = 2 H T_{m-1}(H) - T_{m-2}(H)
+#pragma omp parallel for
+      for (int index = 0; index < size; ++index) {
+        double hr, hi;
+        lsqt_apply_hamiltonian(
+          index / R, index % R, R, Em_inv, row_ptr, col, U, Hr, Hi, s1r.data(), s1i.data(), hr, hi);
+        s2r[index] = 2.0 * hr - s0r[index];
+        s2i[index] = 2.0 * hi - s0i[index];
+      }
+      s0r.swap(s1r);
+      s0i.swap(s1i);
+      s1r.swap(s2r);
+      s1i.swap(s2i);
+    }
+
+    const std::vector<double>& sr = (m == 0) ? s0r : s1r;
+    const std::vector<double>& si = (m == 0) ? s0i : s1i;
+    for (int r = 0; r < R; ++r) {
+      double moment = 0.0;
+      for (int n = 0; n < N; ++n) {
+        moment += sr[n * R + r] * slr[n * R + r] + si[n * R + r] * sli[n * R + r];
+      }
+      moments[m * R + r] = moment;
+    }
+  }
+}
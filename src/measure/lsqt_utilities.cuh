@@ -0,0 +1,105 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Building blocks of LSQT for a block of R states stored as s[n * R + r]
+(n < N is the orbital index and r < R the state index), with the Hamiltonian
+in the CSR format (row_ptr, col, Hr, Hi) and the on-site energies U:
+    lsqt_apply_hamiltonian: (H s)[n * R + r] / Em
+    lsqt_apply_current:     (V s)[n * R + r] (no scaling and no on-site part)
+Each nonzero of H is read once for all the R states (an SpMM instead of R
+SpMVs). The same functions are used by the CUDA kernels in lsqt.cu and by the
+host reference find_moments_chebyshev_host, which returns the moments of each
+state separately such that the block path can be checked state by state.
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include "utilities/host_backend.cuh"
+
+inline __host__ __device__ void lsqt_apply_hamiltonian(
+  const int n,
+  const int r,
+  const int R,
+  const double Em_inv,
+  const int* row_ptr,
+  const int* col,
+  const double* U,
+  const double* Hr,
+  const double* Hi,
+  const double* sr,
+  const double* si,
+  double& hr,
+  double& hi)
+{
+  double temp_real = U[n] * sr[n * R + r]; // on-site
+  double temp_imag = U[n] * si[n * R + r]; // on-site
+  for (int k = row_ptr[n]; k < row_ptr[n + 1]; ++k) {
+    int index_2 = col[k] * R + r;
+    double a = Hr[k];
+    double b = Hi[k];
+    double c = sr[index_2];
+    double d = si[index_2];
+    temp_real += a * c - b * d; // hopping
+    temp_imag += a * d + b * c; // hopping
+  }
+  hr = temp_real * Em_inv; // scale
+  hi = temp_imag * Em_inv; // scale
+}
+
+inline __host__ __device__ void lsqt_apply_current(
+  const int n,
+  const int r,
+  const int R,
+  const int* row_ptr,
+  const int* col,
+  const double* Hr,
+  const double* Hi,
+  const double* xx,
+  const double* sr,
+  const double* si,
+  double& vr,
+  double& vi)
+{
+  double temp_real = 0.0;
+  double temp_imag = 0.0;
+  for (int k = row_ptr[n]; k < row_ptr[n + 1]; ++k) {
+    int index_2 = col[k] * R + r;
+    double a = Hr[k];
+    double b = Hi[k];
+    double c = sr[index_2];
+    double d = si[index_2];
+    temp_real += (a * c - b * d) * xx[k];
+    temp_imag += (a * d + b * c) * xx[k];
+  }
+  vr = +temp_imag;
+  vi = -temp_real;
+}
+
+// moments[m * R + r] = <sl_r|T_m(H / Em)|sr_r> for each of the R states
+void find_moments_chebyshev_host(
+  const int N,
+  const int R,
+  const int Nm,
+  const double Em,
+  const int* row_ptr,
+  const int* col,
+  const double* U,
+  const double* Hr,
+  const double* Hi,
+  const double* slr,
+  const double* sli,
+  const double* srr,
+  const double* sri,
+  double* moments);
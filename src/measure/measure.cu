@@ -47,12 +47,13 @@ void Measure::initialize(
   hnemd.preprocess();
   hnemdec.preprocess(atom.cpu_mass, atom.cpu_type, atom.cpu_type_size);
   modal_analysis.preprocess(atom.cpu_type_size, atom.mass);
-  dump_position.preprocess();
-  dump_velocity.preprocess();
+  dump_position.preprocess(dump_async);
+  dump_velocity.preprocess(dump_async);
   dump_restart.preprocess();
   dump_thermo.preprocess();
-  dump_force.preprocess(number_of_atoms, group);
-  dump_exyz.preprocess(number_of_atoms);
+  dump_force.preprocess(number_of_atoms, group, dump_async);
+  dump_exyz.preprocess(number_of_atoms, dump_async);
+  dump_compressed.preprocess(atom, dump_async);
   dump_beads.preprocess(number_of_atoms, atom.number_of_beads);
   dump_observer.preprocess(number_of_atoms, number_of_potentials, force);
   dump_piston.preprocess(atom, box);
@@ -83,6 +84,7 @@ void Measure::finalize(
   dump_thermo.postprocess();
   dump_force.postprocess();
   dump_exyz.postprocess();
+  dump_compressed.postprocess();
   dump_beads.postprocess();
   dump_observer.postprocess();
   dump_piston.postprocess();
@@ -110,6 +112,7 @@ void Measure::finalize(
   // TODO: move to the relevant class
   modal_analysis.compute = 0;
   modal_analysis.method = NO_METHOD;
+  dump_async = true;
 }
 
 void Measure::process(
@@ -124,102 +127,201 @@ void Measure::process(
   std::vector<Group>& group,
   GPU_Vector<double>& thermo,
   Atom& atom,
-  Force& force)
+  Force& force,
+  Stage_Timer& stage_timer)
 {
   const int number_of_atoms = atom.cpu_type.size();
   int number_of_atoms_fixed = (fixed_group < 0) ? 0 : group[0].cpu_size[fixed_group];
   number_of_atoms_fixed += (move_group < 0) ? 0 : group[0].cpu_size[move_group];
-  dump_thermo.process(
-    integrate.type >= 31,
-    integrate.ensemble->temperature,
-    step,
-    number_of_atoms,
-    number_of_atoms_fixed,
-    box,
-    thermo);
-  dump_position.process(
-    step,
-    box,
-    group,
-    atom.cpu_atom_symbol,
-    atom.cpu_type,
-    atom.position_per_atom,
-    atom.cpu_position_per_atom);
-  dump_velocity.process(step, group, atom.velocity_per_atom, atom.cpu_velocity_per_atom);
-  dump_restart.process(
-    step,
-    box,
-    group,
-    atom.cpu_atom_symbol,
-    atom.cpu_type,
-    atom.cpu_mass,
-    atom.position_per_atom,
-    atom.velocity_per_atom,
-    atom.cpu_position_per_atom,
-    atom.cpu_velocity_per_atom);
-  dump_force.process(step, group, atom.force_per_atom);
-  dump_exyz.process(step, global_time, box, atom, thermo);
-  dump_beads.process(step, global_time, box, atom);
-  dump_observer.process(
-    step, global_time, number_of_atoms_fixed, group, box, atom, force, integrate, thermo);
-  dump_dipole.process(step, global_time, number_of_atoms_fixed, group, box, atom, force);
-  dump_polarizability.process(step, global_time, number_of_atoms_fixed, group, box, atom, force);
-  active.process(step, global_time, number_of_atoms_fixed, group, box, atom, force, thermo);
+  {
+    Scoped_Stage stage(stage_timer, "dump_thermo");
+    dump_thermo.process(
+      integrate.type >= 31,
+      integrate.ensemble->temperature,
+      step,
+      number_of_atoms,
+      number_of_atoms_fixed,
+      box,
+      thermo);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_position");
+    dump_position.process(
+      step,
+      box,
+      group,
+      atom.cpu_atom_symbol,
+      atom.cpu_type,
+      atom.position_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_velocity");
+    dump_velocity.process(step, group, atom.velocity_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_restart");
+    dump_restart.process(
+      step,
+      global_time,
+      box,
+      group,
+      atom.cpu_atom_symbol,
+      atom.cpu_type,
+      atom.cpu_mass,
+      atom.position_per_atom,
+      atom.velocity_per_atom,
+      atom.cpu_position_per_atom,
+      atom.cpu_velocity_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_force");
+    dump_force.process(step, group, atom.force_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_exyz");
+    dump_exyz.process(step, global_time, box, atom, thermo);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_compressed");
+    dump_compressed.process(step, global_time, box, atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_beads");
+    dump_beads.process(step, global_time, box, atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_observer");
+    dump_observer.process(
+      step, global_time, number_of_atoms_fixed, group, box, atom, force, integrate, thermo);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_dipole");
+    dump_dipole.process(step, global_time, number_of_atoms_fixed, group, box, atom, force);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_polarizability");
+    dump_polarizability.process(step, global_time, number_of_atoms_fixed, group, box, atom, force);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "active");
+    active.process(step, global_time, number_of_atoms_fixed, group, box, atom, force, thermo);
+  }
 
-  compute.process(
-    step,
-    integrate.ensemble->energy_transferred,
-    group,
-    atom.mass,
-    atom.potential_per_atom,
-    atom.force_per_atom,
-    atom.velocity_per_atom,
-    atom.virial_per_atom);
-  dos.process(step, group, atom.velocity_per_atom);
-  sdc.process(step, group, atom.velocity_per_atom);
-  msd.process(step, group, atom.unwrapped_position);
-  rdf.process(integrate.type >= 31, number_of_steps, step, box, atom);
-  hac.process(
-    number_of_steps, step, atom.velocity_per_atom, atom.virial_per_atom, atom.heat_per_atom);
-  viscosity.process(number_of_steps, step, atom.mass, atom.velocity_per_atom, atom.virial_per_atom);
-  shc.process(step, group, atom.velocity_per_atom, atom.virial_per_atom);
-  hnemd.process(
-    step,
-    temperature,
-    box.get_volume(),
-    atom.velocity_per_atom,
-    atom.virial_per_atom,
-    atom.heat_per_atom);
-  hnemdec.process(
-    step,
-    temperature,
-    box.get_volume(),
-    atom.velocity_per_atom,
-    atom.virial_per_atom,
-    atom.type,
-    atom.mass,
-    atom.potential_per_atom,
-    atom.heat_per_atom);
-  modal_analysis.process(
-    step, temperature, box.get_volume(), hnemd.fe, atom.velocity_per_atom, atom.virial_per_atom);
+  {
+    Scoped_Stage stage(stage_timer, "compute");
+    compute.process(
+      step,
+      integrate.ensemble->energy_transferred,
+      group,
+      atom.mass,
+      atom.potential_per_atom,
+      atom.force_per_atom,
+      atom.velocity_per_atom,
+      atom.virial_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dos");
+    dos.process(step, group, atom.velocity_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "sdc");
+    sdc.process(step, group, atom.velocity_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "msd");
+    msd.process(step, group, atom.unwrapped_position);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "rdf");
+    rdf.process(integrate.type >= 31, number_of_steps, step, box, atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "hac");
+    hac.process(
+      number_of_steps, step, atom.velocity_per_atom, atom.virial_per_atom, atom.heat_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "viscosity");
+    viscosity.process(
+      number_of_steps, step, atom.mass, atom.velocity_per_atom, atom.virial_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "shc");
+    shc.process(step, group, atom.velocity_per_atom, atom.virial_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "hnemd");
+    hnemd.process(
+      step,
+      temperature,
+      box.get_volume(),
+      atom.velocity_per_atom,
+      atom.virial_per_atom,
+      atom.heat_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "hnemdec");
+    hnemdec.process(
+      step,
+      temperature,
+      box.get_volume(),
+      atom.velocity_per_atom,
+      atom.virial_per_atom,
+      atom.type,
+      atom.mass,
+      atom.potential_per_atom,
+      atom.heat_per_atom);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "modal_analysis");
+    modal_analysis.process(
+      step, temperature, box.get_volume(), hnemd.fe, atom.velocity_per_atom, atom.virial_per_atom);
+  }
 
-  lsqt.process(atom, box, step);
-  dump_piston.process(atom, box, step);
+  {
+    Scoped_Stage stage(stage_timer, "lsqt");
+    lsqt.process(atom, box, step);
+  }
+  {
+    Scoped_Stage stage(stage_timer, "dump_piston");
+    dump_piston.process(atom, box, step);
+  }
 
 #ifdef USE_NETCDF
-  dump_netcdf.process(
-    step,
-    global_time,
-    box,
-    atom.cpu_type,
-    atom.position_per_atom,
-    atom.cpu_position_per_atom,
-    atom.velocity_per_atom,
-    atom.cpu_velocity_per_atom);
+  {
+    Scoped_Stage stage(stage_timer, "dump_netcdf");
+    dump_netcdf.process(
+      step,
+      global_time,
+      box,
+      atom.cpu_type,
+      atom.position_per_atom,
+      atom.cpu_position_per_atom,
+      atom.velocity_per_atom,
+      atom.cpu_velocity_per_atom);
+  }
 #endif
 }
 
 // TODO: move to the relevant class
+void Measure::parse_dump_async(const char** param, int num_param)
+{
+  if (num_param != 2) {
+    PRINT_INPUT_ERROR("dump_async should have 1 parameter.\n");
+  }
+  int is_async = 1;
+  if (!is_valid_int(param[1], &is_async)) {
+    PRINT_INPUT_ERROR("dump_async should be an integer.\n");
+  }
+  if (is_async != 0 && is_async != 1) {
+    PRINT_INPUT_ERROR("dump_async should be 0 or 1.\n");
+  }
+  dump_async = (is_async == 1);
+  printf(
+    "Write dump_position, dump_velocity, dump_force, dump_exyz and dump_compressed %s.\n",
+    dump_async ? "in writer threads" : "in the step loop");
+}
+
 void Measure::parse_compute_gkma(const char** param, int num_param, const int number_of_types)
 {
   modal_analysis.compute = 1;
@@ -18,6 +18,7 @@
 #include "compute.cuh"
 #include "dos.cuh"
 #include "dump_beads.cuh"
+#include "dump_compressed.cuh"
 #include "dump_dipole.cuh"
 #include "dump_exyz.cuh"
 #include "dump_force.cuh"
@@ -42,6 +43,7 @@
 #include "sdc.cuh"
 #include "shc.cuh"
 #include "utilities/gpu_vector.cuh"
+#include "utilities/stage_timer.cuh"
 #include "viscosity.cuh"
 #ifdef USE_NETCDF
 #include "dump_netcdf.cuh"
@@ -87,7 +89,8 @@ public:
     std::vector<Group>& group,
     GPU_Vector<double>& thermo,
     Atom& atom,
-    Force& force);
+    Force& force,
+    Stage_Timer& stage_timer);
 
   LSQT lsqt;
   DOS dos;
@@ -107,6 +110,7 @@ public:
   Dump_Restart dump_restart;
   Dump_Force dump_force;
   Dump_EXYZ dump_exyz;
+  Dump_Compressed dump_compressed;
   Dump_Beads dump_beads;
   Dump_Observer dump_observer;
   Dump_Piston dump_piston;
@@ -120,8 +124,11 @@ public:
   PLUMED plmd;
 #endif
 
+  bool dump_async = true; // use writer threads in dump_position/velocity/force/exyz/compressed
+
   // functions to get inputs from run.in
   void parse_dump_position(const char**, int);
+  void parse_dump_async(const char**, int);
   void parse_compute_gkma(const char**, int, const int number_of_types);
   void parse_compute_hnema(const char**, int, const int number_of_types);
 };
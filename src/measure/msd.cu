@@ -139,14 +139,14 @@ void MSD::preprocess(const int num_atoms, const double time_step, const std::vec
   num_atoms_ = (grouping_method_ < 0) ? num_atoms : groups[grouping_method_].cpu_size[group_id_];
   dt_in_natural_units_ = time_step * sample_interval_;
   dt_in_ps_ = dt_in_natural_units_ * TIME_UNIT_CONVERSION / 1000.0;
-  x_.resize(num_atoms_ * num_correlation_steps_);
-  y_.resize(num_atoms_ * num_correlation_steps_);
-  z_.resize(num_atoms_ * num_correlation_steps_);
-  msdx_.resize(num_correlation_steps_, 0.0, Memory_Type::managed);
-  msdy_.resize(num_correlation_steps_, 0.0, Memory_Type::managed);
-  msdz_.resize(num_correlation_steps_, 0.0, Memory_Type::managed);
-
-  num_time_origins_ = 0;
+  multi_tau_.initialize(num_correlation_steps_);
+  const int num_frames = num_correlation_steps_ * multi_tau_.num_levels();
+  x_.resize(num_atoms_ * num_frames);
+  y_.resize(num_atoms_ * num_frames);
+  z_.resize(num_atoms_ * num_frames);
+  msdx_.resize(num_frames, 0.0, Memory_Type::managed);
+  msdy_.resize(num_frames, 0.0, Memory_Type::managed);
+  msdz_.resize(num_frames, 0.0, Memory_Type::managed);
 }
 
 void MSD::process(const int step, const std::vector<Group>& groups, const GPU_Vector<double>& xyz)
@@ -157,52 +157,54 @@ void MSD::process(const int step, const std::vector<Group>& groups, const GPU_Ve
     return;
 
   const int sample_step = step / sample_interval_;
-  const int correlation_step = sample_step % num_correlation_steps_;
-  const int step_offset = correlation_step * num_atoms_;
   const int number_of_atoms_total = xyz.size() / 3;
 
-  // copy the position data at the current step to appropriate place
-  if (grouping_method_ < 0) {
-    gpu_copy_position<<<(num_atoms_ - 1) / 128 + 1, 128>>>(
-      num_atoms_,
-      xyz.data(),
-      xyz.data() + number_of_atoms_total,
-      xyz.data() + 2 * number_of_atoms_total,
-      x_.data() + step_offset,
-      y_.data() + step_offset,
-      z_.data() + step_offset);
-  } else {
-    const int group_offset = groups[grouping_method_].cpu_size_sum[group_id_];
-    gpu_copy_position<<<(num_atoms_ - 1) / 128 + 1, 128>>>(
-      num_atoms_,
-      group_offset,
-      groups[grouping_method_].contents.data(),
-      xyz.data(),
-      xyz.data() + number_of_atoms_total,
-      xyz.data() + 2 * number_of_atoms_total,
-      x_.data() + step_offset,
-      y_.data() + step_offset,
-      z_.data() + step_offset);
-  }
-  CUDA_CHECK_KERNEL
-
-  // start to calculate the MSD when we have enough frames
-  if (sample_step >= num_correlation_steps_ - 1) {
-    ++num_time_origins_;
+  multi_tau_.get_updates(sample_step, updates_);
+  for (const auto& update : updates_) {
+    const int level_offset = update.level * num_correlation_steps_;
+    const int step_offset = (level_offset + update.slot) * num_atoms_;
 
-    gpu_find_msd<<<num_correlation_steps_, 128>>>(
-      num_atoms_,
-      correlation_step,
-      x_.data() + step_offset,
-      y_.data() + step_offset,
-      z_.data() + step_offset,
-      x_.data(),
-      y_.data(),
-      z_.data(),
-      msdx_.data(),
-      msdy_.data(),
-      msdz_.data());
+    // copy the position data at the current step to appropriate place
+    if (grouping_method_ < 0) {
+      gpu_copy_position<<<(num_atoms_ - 1) / 128 + 1, 128>>>(
+        num_atoms_,
+        xyz.data(),
+        xyz.data() + number_of_atoms_total,
+        xyz.data() + 2 * number_of_atoms_total,
+        x_.data() + step_offset,
+        y_.data() + step_offset,
+        z_.data() + step_offset);
+    } else {
+      const int group_offset = groups[grouping_method_].cpu_size_sum[group_id_];
+      gpu_copy_position<<<(num_atoms_ - 1) / 128 + 1, 128>>>(
+        num_atoms_,
+        group_offset,
+        groups[grouping_method_].contents.data(),
+        xyz.data(),
+        xyz.data() + number_of_atoms_total,
+        xyz.data() + 2 * number_of_atoms_total,
+        x_.data() + step_offset,
+        y_.data() + step_offset,
+        z_.data() + step_offset);
+    }
     CUDA_CHECK_KERNEL
+
+    // correlate with the frames of this level when there are enough of them
+    if (update.is_full) {
+      gpu_find_msd<<<num_correlation_steps_, 128>>>(
+        num_atoms_,
+        update.slot,
+        x_.data() + step_offset,
+        y_.data() + step_offset,
+        z_.data() + step_offset,
+        x_.data() + level_offset * num_atoms_,
+        y_.data() + level_offset * num_atoms_,
+        z_.data() + level_offset * num_atoms_,
+        msdx_.data() + level_offset,
+        msdy_.data() + level_offset,
+        msdz_.data() + level_offset);
+      CUDA_CHECK_KERNEL
+    }
   }
 }
 
@@ -213,35 +215,46 @@ void MSD::postprocess()
 
   CHECK(cudaDeviceSynchronize()); // needed for pre-Pascal GPU
 
-  // normalize by the number of atoms and number of time origins
-  const double msd_scaler = 1.0 / ((double)num_atoms_ * (double)num_time_origins_);
-  for (int nc = 0; nc < num_correlation_steps_; nc++) {
-    msdx_[nc] *= msd_scaler;
-    msdy_[nc] *= msd_scaler;
-    msdz_[nc] *= msd_scaler;
+  // normalize by the number of atoms and number of time origins of each level
+  std::vector<double> lag, msd_x, msd_y, msd_z;
+  for (int level = 0; level < multi_tau_.num_levels(); ++level) {
+    const int num_time_origins = multi_tau_.num_time_origins(level);
+    if (num_time_origins == 0) {
+      printf("Warning: not enough samples for MSD level %d; it is not output.\n", level);
+      break;
+    }
+    const double msd_scaler = 1.0 / ((double)num_atoms_ * (double)num_time_origins);
+    for (int j = multi_tau_.first_lag_index(level); j < num_correlation_steps_; ++j) {
+      const int nc = level * num_correlation_steps_ + j;
+      lag.push_back(multi_tau_.get_lag(level, j));
+      msd_x.push_back(msdx_[nc] * msd_scaler);
+      msd_y.push_back(msdy_[nc] * msd_scaler);
+      msd_z.push_back(msdz_[nc] * msd_scaler);
+    }
   }
 
-  std::vector<double> sdc_x(num_correlation_steps_, 0.0);
-  std::vector<double> sdc_y(num_correlation_steps_, 0.0);
-  std::vector<double> sdc_z(num_correlation_steps_, 0.0);
-  const double dt2inv = 0.5 / dt_in_natural_units_;
-  for (int nc = 1; nc < num_correlation_steps_; nc++) {
-    sdc_x[nc] = (msdx_[nc] - msdx_[nc - 1]) * dt2inv;
-    sdc_y[nc] = (msdy_[nc] - msdy_[nc - 1]) * dt2inv;
-    sdc_z[nc] = (msdz_[nc] - msdz_[nc - 1]) * dt2inv;
+  const int num_lags = lag.size();
+  std::vector<double> sdc_x(num_lags, 0.0);
+  std::vector<double> sdc_y(num_lags, 0.0);
+  std::vector<double> sdc_z(num_lags, 0.0);
+  for (int nc = 1; nc < num_lags; nc++) {
+    const double dt2inv = 0.5 / ((lag[nc] - lag[nc - 1]) * dt_in_natural_units_);
+    sdc_x[nc] = (msd_x[nc] - msd_x[nc - 1]) * dt2inv;
+    sdc_y[nc] = (msd_y[nc] - msd_y[nc - 1]) * dt2inv;
+    sdc_z[nc] = (msd_z[nc] - msd_z[nc - 1]) * dt2inv;
   }
 
   const double sdc_unit_conversion = 1.0e3 / TIME_UNIT_CONVERSION;
 
   FILE* fid = fopen("msd.out", "a");
-  for (int nc = 0; nc < num_correlation_steps_; nc++) {
+  for (int nc = 0; nc < num_lags; nc++) {
     fprintf(
       fid,
       "%g %g %g %g %g %g %g\n",
-      nc * dt_in_ps_,
-      msdx_[nc],
-      msdy_[nc],
-      msdz_[nc],
+      lag[nc] * dt_in_ps_,
+      msd_x[nc],
+      msd_y[nc],
+      msd_z[nc],
       sdc_x[nc] * sdc_unit_conversion,
       sdc_y[nc] * sdc_unit_conversion,
       sdc_z[nc] * sdc_unit_conversion);
@@ -251,6 +264,7 @@ void MSD::postprocess()
 
   compute_ = false;
   grouping_method_ = -1;
+  multi_tau_ = Multi_Tau();
 }
 
 void MSD::parse(const char** param, const int num_param, const std::vector<Group>& groups)
@@ -261,7 +275,7 @@ void MSD::parse(const char** param, const int num_param, const std::vector<Group
   if (num_param < 3) {
     PRINT_INPUT_ERROR("compute_msd should have at least 2 parameters.\n");
   }
-  if (num_param > 6) {
+  if (num_param > 8) {
     PRINT_INPUT_ERROR("compute_msd has too many parameters.\n");
   }
 
@@ -287,6 +301,8 @@ void MSD::parse(const char** param, const int num_param, const std::vector<Group
   for (int k = 3; k < num_param; k++) {
     if (strcmp(param[k], "group") == 0) {
       parse_group(param, num_param, false, groups, k, grouping_method_, group_id_);
+    } else if (strcmp(param[k], "multi_tau") == 0) {
+      multi_tau_.parse(param, num_param, k, num_correlation_steps_);
     } else {
       PRINT_INPUT_ERROR("Unrecognized argument in compute_msd.\n");
     }
@@ -14,6 +14,7 @@
 */
 
 #pragma once
+#include "multi_tau.cuh"
 #include "utilities/gpu_vector.cuh"
 #include <vector>
 class Group;
@@ -35,9 +36,10 @@ public:
 
 private:
   int num_atoms_;
-  int num_time_origins_;
   double dt_in_natural_units_;
   double dt_in_ps_;
-  GPU_Vector<double> x_, y_, z_;
-  GPU_Vector<double> msdx_, msdy_, msdz_;
+  GPU_Vector<double> x_, y_, z_;          // Nc frames for each multi-tau level
+  GPU_Vector<double> msdx_, msdy_, msdz_; // Nc lags for each multi-tau level
+  Multi_Tau multi_tau_;
+  std::vector<Multi_Tau::Update> updates_;
 };
@@ -0,0 +1,85 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Scheduling of the multi-tau (order-n) correlators used by compute_msd and
+compute_sdc.
+------------------------------------------------------------------------------*/
+
+#include "multi_tau.cuh"
+#include "utilities/error.cuh"
+#include "utilities/read_file.cuh"
+#include <climits>
+#include <cstring>
+
+void Multi_Tau::parse(
+  const char** param, const int num_param, int& k, const int num_correlation_steps)
+{
+  if (k + 2 > num_param) {
+    PRINT_INPUT_ERROR("multi_tau should be followed by the number of levels.\n");
+  }
+  if (!is_valid_int(param[k + 1], &num_levels_)) {
+    PRINT_INPUT_ERROR("number of multi-tau levels should be an integer.\n");
+  }
+  if (num_levels_ < 1) {
+    PRINT_INPUT_ERROR("number of multi-tau levels should be positive.\n");
+  }
+  if (num_levels_ > 1 && num_correlation_steps < 2) {
+    PRINT_INPUT_ERROR("number of correlation steps should >= 2 for multi-tau.\n");
+  }
+  double longest_lag = num_correlation_steps - 1;
+  for (int level = 1; level < num_levels_; ++level) {
+    longest_lag *= num_correlation_steps;
+  }
+  if (longest_lag > INT_MAX) {
+    PRINT_INPUT_ERROR("the longest multi-tau lag is too large.\n");
+  }
+  printf("    use %d multi-tau levels.\n", num_levels_);
+  printf("    longest lag is %.0f samples.\n", longest_lag);
+  k += 1;
+}
+
+void Multi_Tau::initialize(const int num_correlation_steps)
+{
+  num_correlation_steps_ = num_correlation_steps;
+  stride_.resize(num_levels_);
+  stride_[0] = 1;
+  for (int level = 1; level < num_levels_; ++level) {
+    stride_[level] = stride_[level - 1] * num_correlation_steps_;
+  }
+  num_frames_.assign(num_levels_, 0);
+  num_time_origins_.assign(num_levels_, 0);
+}
+
+void Multi_Tau::get_updates(const int sample_step, std::vector<Update>& updates)
+{
+  updates.clear();
+  for (int level = 0; level < num_levels_; ++level) {
+    if (sample_step % stride_[level] != 0) {
+      break; // the strides are multiples of each other
+    }
+    Update update;
+    update.level = level;
+    update.slot = num_frames_[level] % num_correlation_steps_;
+    ++num_frames_[level];
+    update.is_full = num_frames_[level] >= num_correlation_steps_;
+    if (update.is_full) {
+      ++num_time_origins_[level];
+    }
+    updates.push_back(update);
+  }
+}
+
+long long Multi_Tau::get_lag(const int level, const int j) const { return j * stride_[level]; }
@@ -0,0 +1,68 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Scheduling of the multi-tau (order-n) correlators used by compute_msd and
+compute_sdc. Level l keeps every (Nc^l)-th sample in a ring buffer of Nc frames
+and correlates each new frame with the Nc frames of its level, which gives the
+lags j * Nc^l, with j = 0, ..., Nc - 1 for level 0 and j = 1, ..., Nc - 1 for the
+other levels. The memory is Nc frames per level and the longest lag is
+(Nc - 1) * Nc^(L-1) samples. With a single level, this is the linear method.
+The frames are sampled, not averaged, within the blocks of a level, such that
+each lag is an exact average over a subset of the time origins.
+
+Reference:
+    D. Frenkel and B. Smit, Understanding Molecular Simulation,
+    2nd ed., Academic Press (2002), Section 4.4.2.
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include <vector>
+
+class Multi_Tau
+{
+public:
+  struct Update {
+    int level;    // level receiving the sample
+    int slot;     // index of the frame in the ring buffer of the level
+    bool is_full; // whether the ring buffer is full, in which case the frame is correlated
+  };
+
+  // parse "multi_tau <num_levels>" starting at param[k]; k is moved to the last parameter
+  void parse(const char** param, const int num_param, int& k, const int num_correlation_steps);
+
+  void initialize(const int num_correlation_steps);
+
+  // levels receiving the sample with index sample_step (0, 1, 2, ...)
+  void get_updates(const int sample_step, std::vector<Update>& updates);
+
+  int num_levels() const { return num_levels_; }
+
+  // number of time origins of the correlation function of a level
+  int num_time_origins(const int level) const { return num_time_origins_[level]; }
+
+  // the lag (in units of the sample interval) of the j-th frame of a level
+  long long get_lag(const int level, const int j) const;
+
+  // the first lag index used by a level (lags below it are covered by the lower levels)
+  int first_lag_index(const int level) const { return (level == 0) ? 0 : 1; }
+
+private:
+  int num_levels_ = 1;
+  int num_correlation_steps_ = 1;
+  std::vector<long long> stride_;     // Nc^l
+  std::vector<int> num_frames_;       // number of frames received by each level
+  std::vector<int> num_time_origins_; // number of correlated frames of each level
+};
@@ -136,14 +136,14 @@ void SDC::preprocess(const int num_atoms, const double time_step, const std::vec
   num_atoms_ = (grouping_method_ < 0) ? num_atoms : groups[grouping_method_].cpu_size[group_id_];
   dt_in_natural_units_ = time_step * sample_interval_;
   dt_in_ps_ = dt_in_natural_units_ * TIME_UNIT_CONVERSION / 1000.0;
-  vx_.resize(num_atoms_ * num_correlation_steps_);
-  vy_.resize(num_atoms_ * num_correlation_steps_);
-  vz_.resize(num_atoms_ * num_correlation_steps_);
-  vacx_.resize(num_correlation_steps_, 0.0, Memory_Type::managed);
-  vacy_.resize(num_correlation_steps_, 0.0, Memory_Type::managed);
-  vacz_.resize(num_correlation_steps_, 0.0, Memory_Type::managed);
-
-  num_time_origins_ = 0;
+  multi_tau_.initialize(num_correlation_steps_);
+  const int num_frames = num_correlation_steps_ * multi_tau_.num_levels();
+  vx_.resize(num_atoms_ * num_frames);
+  vy_.resize(num_atoms_ * num_frames);
+  vz_.resize(num_atoms_ * num_frames);
+  vacx_.resize(num_frames, 0.0, Memory_Type::managed);
+  vacy_.resize(num_frames, 0.0, Memory_Type::managed);
+  vacz_.resize(num_frames, 0.0, Memory_Type::managed);
 }
 
 void SDC::process(
@@ -155,52 +155,54 @@ void SDC::process(
     return;
 
   const int sample_step = step / sample_interval_;
-  const int correlation_step = sample_step % num_correlation_steps_;
-  const int step_offset = correlation_step * num_atoms_;
   const int number_of_atoms_total = velocity_per_atom.size() / 3;
 
-  // copy the velocity data at the current step to appropriate place
-  if (grouping_method_ < 0) {
-    gpu_copy_velocity<<<(num_atoms_ - 1) / 128 + 1, 128>>>(
-      num_atoms_,
-      velocity_per_atom.data(),
-      velocity_per_atom.data() + number_of_atoms_total,
-      velocity_per_atom.data() + 2 * number_of_atoms_total,
-      vx_.data() + step_offset,
-      vy_.data() + step_offset,
-      vz_.data() + step_offset);
-  } else {
-    const int group_offset = groups[grouping_method_].cpu_size_sum[group_id_];
-    gpu_copy_velocity<<<(num_atoms_ - 1) / 128 + 1, 128>>>(
-      num_atoms_,
-      group_offset,
-      groups[grouping_method_].contents.data(),
-      velocity_per_atom.data(),
-      velocity_per_atom.data() + number_of_atoms_total,
-      velocity_per_atom.data() + 2 * number_of_atoms_total,
-      vx_.data() + step_offset,
-      vy_.data() + step_offset,
-      vz_.data() + step_offset);
-  }
-  CUDA_CHECK_KERNEL
-
-  // start to calculate the VAC when we have enough frames
-  if (sample_step >= num_correlation_steps_ - 1) {
-    ++num_time_origins_;
+  multi_tau_.get_updates(sample_step, updates_);
+  for (const auto& update : updates_) {
+    const int level_offset = update.level * num_correlation_steps_;
+    const int step_offset = (level_offset + update.slot) * num_atoms_;
 
-    gpu_find_vac<<<num_correlation_steps_, 128>>>(
-      num_atoms_,
-      correlation_step,
-      vx_.data() + step_offset,
-      vy_.data() + step_offset,
-      vz_.data() + step_offset,
-      vx_.data(),
-      vy_.data(),
-      vz_.data(),
-      vacx_.data(),
-      vacy_.data(),
-      vacz_.data());
+    // copy the velocity data at the current step to appropriate place
+    if (grouping_method_ < 0) {
+      gpu_copy_velocity<<<(num_atoms_ - 1) / 128 + 1, 128>>>(
+        num_atoms_,
+        velocity_per_atom.data(),
+        velocity_per_atom.data() + number_of_atoms_total,
+        velocity_per_atom.data() + 2 * number_of_atoms_total,
+        vx_.data() + step_offset,
+        vy_.data() + step_offset,
+        vz_.data() + step_offset);
+    } else {
+      const int group_offset = groups[grouping_method_].cpu_size_sum[group_id_];
+      gpu_copy_velocity<<<(num_atoms_ - 1) / 128 + 1, 128>>>(
+        num_atoms_,
+        group_offset,
+        groups[grouping_method_].contents.data(),
+        velocity_per_atom.data(),
+        velocity_per_atom.data() + number_of_atoms_total,
+        velocity_per_atom.data() + 2 * number_of_atoms_total,
+        vx_.data() + step_offset,
+        vy_.data() + step_offset,
+        vz_.data() + step_offset);
+    }
     CUDA_CHECK_KERNEL
+
+    // correlate with the frames of this level when there are enough of them
+    if (update.is_full) {
+      gpu_find_vac<<<num_correlation_steps_, 128>>>(
+        num_atoms_,
+        update.slot,
+        vx_.data() + step_offset,
+        vy_.data() + step_offset,
+        vz_.data() + step_offset,
+        vx_.data() + level_offset * num_atoms_,
+        vy_.data() + level_offset * num_atoms_,
+        vz_.data() + level_offset * num_atoms_,
+        vacx_.data() + level_offset,
+        vacy_.data() + level_offset,
+        vacz_.data() + level_offset);
+      CUDA_CHECK_KERNEL
+    }
   }
 }
 
@@ -211,36 +213,48 @@ void SDC::postprocess()
 
   CHECK(cudaDeviceSynchronize()); // needed for pre-Pascal GPU
 
-  // normalize by the number of atoms and number of time origins
-  const double vac_scaler = 1.0 / ((double)num_atoms_ * (double)num_time_origins_);
-  for (int nc = 0; nc < num_correlation_steps_; nc++) {
-    vacx_[nc] *= vac_scaler;
-    vacy_[nc] *= vac_scaler;
-    vacz_[nc] *= vac_scaler;
+  // normalize by the number of atoms and number of time origins of each level
+  std::vector<double> lag, vac_x, vac_y, vac_z;
+  for (int level = 0; level < multi_tau_.num_levels(); ++level) {
+    const int num_time_origins = multi_tau_.num_time_origins(level);
+    if (num_time_origins == 0) {
+      printf("Warning: not enough samples for VAC level %d; it is not output.\n", level);
+      break;
+    }
+    const double vac_scaler = 1.0 / ((double)num_atoms_ * (double)num_time_origins);
+    for (int j = multi_tau_.first_lag_index(level); j < num_correlation_steps_; ++j) {
+      const int nc = level * num_correlation_steps_ + j;
+      lag.push_back(multi_tau_.get_lag(level, j));
+      vac_x.push_back(vacx_[nc] * vac_scaler);
+      vac_y.push_back(vacy_[nc] * vac_scaler);
+      vac_z.push_back(vacz_[nc] * vac_scaler);
+    }
   }
 
-  std::vector<double> sdc_x(num_correlation_steps_, 0.0);
-  std::vector<double> sdc_y(num_correlation_steps_, 0.0);
-  std::vector<double> sdc_z(num_correlation_steps_, 0.0);
-  const double dt2 = dt_in_natural_units_ * 0.5;
-  for (int nc = 1; nc < num_correlation_steps_; nc++) {
-    sdc_x[nc] = sdc_x[nc - 1] + (vacx_[nc - 1] + vacx_[nc]) * dt2;
-    sdc_y[nc] = sdc_y[nc - 1] + (vacy_[nc - 1] + vacy_[nc]) * dt2;
-    sdc_z[nc] = sdc_z[nc - 1] + (vacz_[nc - 1] + vacz_[nc]) * dt2;
+  // trapezoidal integration, also for the non-uniform lags of the multi-tau levels
+  const int num_lags = lag.size();
+  std::vector<double> sdc_x(num_lags, 0.0);
+  std::vector<double> sdc_y(num_lags, 0.0);
+  std::vector<double> sdc_z(num_lags, 0.0);
+  for (int nc = 1; nc < num_lags; nc++) {
+    const double dt2 = (lag[nc] - lag[nc - 1]) * dt_in_natural_units_ * 0.5;
+    sdc_x[nc] = sdc_x[nc - 1] + (vac_x[nc - 1] + vac_x[nc]) * dt2;
+    sdc_y[nc] = sdc_y[nc - 1] + (vac_y[nc - 1] + vac_y[nc]) * dt2;
+    sdc_z[nc] = sdc_z[nc - 1] + (vac_z[nc - 1] + vac_z[nc]) * dt2;
   }
 
   const double sdc_unit_conversion = 1.0e3 / TIME_UNIT_CONVERSION;
   const double vac_unit_conversion = sdc_unit_conversion * sdc_unit_conversion;
 
   FILE* fid = fopen("sdc.out", "a");
-  for (int nc = 0; nc < num_correlation_steps_; nc++) {
+  for (int nc = 0; nc < num_lags; nc++) {
     fprintf(
       fid,
       "%g %g %g %g %g %g %g\n",
-      nc * dt_in_ps_,
-      vacx_[nc] * vac_unit_conversion,
-      vacy_[nc] * vac_unit_conversion,
-      vacz_[nc] * vac_unit_conversion,
+      lag[nc] * dt_in_ps_,
+      vac_x[nc] * vac_unit_conversion,
+      vac_y[nc] * vac_unit_conversion,
+      vac_z[nc] * vac_unit_conversion,
       sdc_x[nc] * sdc_unit_conversion,
       sdc_y[nc] * sdc_unit_conversion,
       sdc_z[nc] * sdc_unit_conversion);
@@ -250,6 +264,7 @@ void SDC::postprocess()
 
   compute_ = false;
   grouping_method_ = -1;
+  multi_tau_ = Multi_Tau();
 }
 
 void SDC::parse(const char** param, const int num_param, const std::vector<Group>& groups)
@@ -260,7 +275,7 @@ void SDC::parse(const char** param, const int num_param, const std::vector<Group
   if (num_param < 3) {
     PRINT_INPUT_ERROR("compute_sdc should have at least 2 parameters.\n");
   }
-  if (num_param > 6) {
+  if (num_param > 8) {
     PRINT_INPUT_ERROR("compute_sdc has too many parameters.\n");
   }
 
@@ -286,6 +301,8 @@ void SDC::parse(const char** param, const int num_param, const std::vector<Group
   for (int k = 3; k < num_param; k++) {
     if (strcmp(param[k], "group") == 0) {
       parse_group(param, num_param, false, groups, k, grouping_method_, group_id_);
+    } else if (strcmp(param[k], "multi_tau") == 0) {
+      multi_tau_.parse(param, num_param, k, num_correlation_steps_);
     } else {
       PRINT_INPUT_ERROR("Unrecognized argument in compute_sdc.\n");
     }
@@ -25,6 +25,7 @@ with many-body potentials, Phys. Rev. B 99, 064308 (2019).
 #include "shc.cuh"
 #include "utilities/common.cuh"
 #include "utilities/error.cuh"
+#include "utilities/fft.cuh"
 #include "utilities/read_file.cuh"
 #include <cstring>
 
@@ -331,48 +332,26 @@ void SHC::average_k()
 
 void SHC::find_shc(const double dt_in_ps, const double d_omega)
 {
-  if (group_id == -1) {
-    for (int n = 1; n < group_num; ++n) {
-      const int offset_k = (Nc * 2 - 1) * n;
-      for (int nc = 0; nc < Nc * 2 - 1; ++nc) {
-        const double hann_window = (cos(PI * (nc + 1 - Nc) / Nc) + 1.0) * 0.5;
-        ki[nc + offset_k] *= hann_window;
-        ko[nc + offset_k] *= hann_window;
-      }
-    }
-
-    for (int n = 1; n < group_num; ++n) {
-      const int offset_s = num_omega * n;
-      const int offset_k = (Nc * 2 - 1) * n;
-      for (int nw = 0; nw < num_omega; ++nw) {
-        const double omega = (nw + 1) * d_omega;
-        for (int nc = 0; nc < Nc * 2 - 1; nc++) {
-          const double t_in_ps = (nc + 1 - Nc) * dt_in_ps;
-          const double cos_factor = cos(omega * t_in_ps);
-          shc_i[nw + offset_s] += ki[nc + offset_k] * cos_factor;
-          shc_o[nw + offset_s] += ko[nc + offset_k] * cos_factor;
-        }
-        shc_i[nw + offset_s] *= 2.0 * dt_in_ps;
-        shc_o[nw + offset_s] *= 2.0 * dt_in_ps;
-      }
-    }
-  } else {
-    for (int nc = 0; nc < Nc * 2 - 1; ++nc) {
+  // SHC(omega) = sum_nc K(nc) * cos(omega * (nc + 1 - Nc) * dt), omega = d_omega, 2 * d_omega, ...
+  const int num_k = Nc * 2 - 1;
+  const Cosine_Sum cosine_sum(num_k, num_omega, d_omega * dt_in_ps, d_omega * dt_in_ps, 1 - Nc);
+
+  const int group_begin = (group_id == -1) ? 1 : 0;
+  const int group_end = (group_id == -1) ? group_num : 1;
+  for (int n = group_begin; n < group_end; ++n) {
+    const int offset_s = num_omega * n;
+    const int offset_k = num_k * n;
+    for (int nc = 0; nc < num_k; ++nc) {
       const double hann_window = (cos(PI * (nc + 1 - Nc) / Nc) + 1.0) * 0.5;
-      ki[nc] *= hann_window;
-      ko[nc] *= hann_window;
+      ki[nc + offset_k] *= hann_window;
+      ko[nc + offset_k] *= hann_window;
     }
 
+    cosine_sum.transform(ki.data() + offset_k, shc_i.data() + offset_s);
+    cosine_sum.transform(ko.data() + offset_k, shc_o.data() + offset_s);
     for (int nw = 0; nw < num_omega; ++nw) {
-      const double omega = (nw + 1) * d_omega;
-      for (int nc = 0; nc < Nc * 2 - 1; nc++) {
-        const double t_in_ps = (nc + 1 - Nc) * dt_in_ps;
-        const double cos_factor = cos(omega * t_in_ps);
-        shc_i[nw] += ki[nc] * cos_factor;
-        shc_o[nw] += ko[nc] * cos_factor;
-      }
-      shc_i[nw] *= 2.0 * dt_in_ps;
-      shc_o[nw] *= 2.0 * dt_in_ps;
+      shc_i[nw + offset_s] *= 2.0 * dt_in_ps;
+      shc_o[nw + offset_s] *= 2.0 * dt_in_ps;
     }
   }
 }
@@ -18,8 +18,11 @@ Calculate the stress autocorrelation function and viscosity.
 ------------------------------------------------------------------------------*/
 
 #include "utilities/common.cuh"
+#include "utilities/correlation.cuh"
+#include "utilities/error.cuh"
 #include "utilities/read_file.cuh"
 #include "viscosity.cuh"
+#include <algorithm>
 #include <vector>
 
 #define NUM_OF_COMPONENTS 9
@@ -127,44 +130,27 @@ static __global__ void gpu_correct_stress(const int Nd, double* g_stress_all)
   }
 }
 
-static __global__ void
-gpu_find_correlation(const int Nc, const int Nd, const double* g_stress, double* g_correlation)
+// the stress autocorrelation by FFT on the host, streaming blocks of the stress from the device
+static void
+find_correlation(const int Nc, const int Nd, const double* g_stress, double* correlation)
 {
-  __shared__ double s_correlation[NUM_OF_COMPONENTS][128];
-
-  int tid = threadIdx.x;
-  int bid = blockIdx.x;
-  int number_of_rounds = (Nd - 1) / 128 + 1;
-  int number_of_data = Nd - bid;
-
-  for (int k = 0; k < NUM_OF_COMPONENTS; ++k) {
-    s_correlation[k][tid] = 0.0;
-  }
-
-  for (int round = 0; round < number_of_rounds; ++round) {
-    int index = tid + round * 128;
-    if (index + bid < Nd) {
-      for (int k = 0; k < NUM_OF_COMPONENTS; ++k) {
-        s_correlation[k][tid] += g_stress[index + Nd * k] * g_stress[index + bid + Nd * k];
-      }
-    }
-  }
-  __syncthreads();
+  Correlation stress_correlation(NUM_OF_COMPONENTS, Nc);
+  const int block_size = stress_correlation.block_size();
+  std::vector<double> stress(NUM_OF_COMPONENTS * block_size);
 
-  for (int offset = blockDim.x >> 1; offset > 0; offset >>= 1) {
-    if (tid < offset) {
-      for (int k = 0; k < NUM_OF_COMPONENTS; ++k) {
-        s_correlation[k][tid] += s_correlation[k][tid + offset];
-      }
-    }
-    __syncthreads();
-  }
-
-  if (tid == 0) {
+  for (int nd = 0; nd < Nd; nd += block_size) {
+    const int num_samples = std::min(block_size, Nd - nd);
     for (int k = 0; k < NUM_OF_COMPONENTS; ++k) {
-      g_correlation[bid + Nc * k] = s_correlation[k][0] / number_of_data;
+      CHECK(cudaMemcpy(
+        stress.data() + num_samples * k,
+        g_stress + Nd * k + nd,
+        sizeof(double) * num_samples,
+        cudaMemcpyDeviceToHost));
     }
+    stress_correlation.add(stress.data(), stress.data(), num_samples);
   }
+
+  stress_correlation.get_correlation(correlation);
 }
 
 static void
@@ -192,15 +178,11 @@ void Viscosity::postprocess(
   const double dt_in_ps = dt * TIME_UNIT_CONVERSION / 1000.0; // ps
 
   std::vector<double> viscosity(Nc * NUM_OF_COMPONENTS, 0.0);
-  GPU_Vector<double> correlation_gpu(Nc * NUM_OF_COMPONENTS);
   std::vector<double> correlation_cpu(Nc * NUM_OF_COMPONENTS);
 
   gpu_correct_stress<<<NUM_OF_COMPONENTS, 1024>>>(Nd, stress_all.data());
   CUDA_CHECK_KERNEL
-  gpu_find_correlation<<<Nc, 128>>>(Nc, Nd, stress_all.data(), correlation_gpu.data());
-  CUDA_CHECK_KERNEL
-
-  correlation_gpu.copy_to_host(correlation_cpu.data());
+  find_correlation(Nc, Nd, stress_all.data(), correlation_cpu.data());
 
   double factor = dt * 0.5 / (K_B * temperature * volume);
   factor *= PRESSURE_UNIT_CONVERSION * TIME_UNIT_CONVERSION * 1.0e-6; // Pa s
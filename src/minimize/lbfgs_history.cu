@@ -0,0 +1,106 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+The two-loop recursion of L-BFGS written in terms of the dot products of the
+basis vectors {s_i, y_i, f}, such that the search direction is a linear
+combination of the basis vectors and the recursion runs on the host.
+Reference: W. Chen, Z. Wang, and J. Zhou, Large-scale L-BFGS using MapReduce,
+           Advances in Neural Information Processing Systems 27 (2014)
+------------------------------------------------------------------------------*/
+
+#include "lbfgs_history.cuh"
+#include <algorithm>
+
+void LBFGS_History::resize(const int history_size)
+{
+  history_size_ = history_size;
+  dot_.assign(get_number_of_basis() * get_number_of_basis(), 0.0);
+  order_.reserve(history_size);
+  order_.clear();
+}
+
+void LBFGS_History::reset() { order_.clear(); }
+
+int LBFGS_History::get_new_slot()
+{
+  if (static_cast<int>(order_.size()) == history_size_) {
+    const int slot = order_[0];
+    order_.erase(order_.begin());
+    return slot;
+  }
+  for (int slot = 0; slot < history_size_; ++slot) {
+    if (std::find(order_.begin(), order_.end(), slot) == order_.end()) {
+      return slot;
+    }
+  }
+  return 0; // not reached
+}
+
+bool LBFGS_History::push(const int slot)
+{
+  if (get_dot(slot, history_size_ + slot) <= 0.0) {
+    return false;
+  }
+  order_.push_back(slot);
+  return true;
+}
+
+void LBFGS_History::set_dot(const int i, const int j, const double value)
+{
+  dot_[i * get_number_of_basis() + j] = value;
+  dot_[j * get_number_of_basis() + i] = value;
+}
+
+double LBFGS_History::find_projection(const std::vector<double>& delta, const int j) const
+{
+  double projection = 0.0;
+  for (int i = 0; i < get_number_of_basis(); ++i) {
+    if (delta[i] != 0.0) {
+      projection += delta[i] * get_dot(i, j);
+    }
+  }
+  return projection;
+}
+
+void LBFGS_History::find_coefficients(std::vector<double>& delta) const
+{
+  const int m = history_size_;
+  const int k = order_.size();
+  delta.assign(get_number_of_basis(), 0.0);
+  delta[get_force_slot()] = 1.0; // q = f = -g
+  if (k == 0) {
+    return;
+  }
+
+  std::vector<double> alpha(k);
+  for (int i = k - 1; i >= 0; --i) {
+    const int s = order_[i];
+    alpha[i] = find_projection(delta, s) / get_dot(s, m + s);
+    delta[m + s] -= alpha[i];
+  }
+
+  const int newest = order_[k - 1];
+  const double gamma = get_dot(newest, m + newest) / get_dot(m + newest, m + newest);
+  for (auto& d : delta) {
+    d *= gamma;
+  }
+
+  for (int i = 0; i < k; ++i) {
+    const int s = order_[i];
+    const double beta = find_projection(delta, m + s) / get_dot(s, m + s);
+    delta[s] += alpha[i] - beta;
+  }
+}
@@ -0,0 +1,52 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include <vector>
+
+// Host-side bookkeeping of the L-BFGS history.
+// The basis vectors are the m position changes s (slots 0 to m-1), the m gradient changes y
+// (slots m to 2m-1) and the current force f (slot 2m). Only their dot products are kept here;
+// the vectors themselves live on the device.
+class LBFGS_History
+{
+public:
+  void resize(const int history_size);
+  void reset();
+
+  // Frees the slot for the next (s, y) pair, dropping the oldest pair if the history is full.
+  int get_new_slot();
+  // Makes the pair in the slot the newest one if s * y is positive; returns whether it is kept.
+  bool push(const int slot);
+
+  int get_history_size() const { return history_size_; }
+  int get_number_of_pairs() const { return order_.size(); }
+  int get_slot(const int k) const { return order_[k]; }
+  int get_number_of_basis() const { return 2 * history_size_ + 1; }
+  int get_force_slot() const { return 2 * history_size_; }
+
+  void set_dot(const int i, const int j, const double value);
+  double get_dot(const int i, const int j) const { return dot_[i * get_number_of_basis() + j]; }
+
+  // d = H * f = sum_i delta_i b_i, from the two-loop recursion in terms of the dot products
+  void find_coefficients(std::vector<double>& delta) const;
+  // sum_i delta_i (b_i * b_j)
+  double find_projection(const std::vector<double>& delta, const int j) const;
+
+private:
+  int history_size_ = 0;
+  std::vector<int> order_; // slots from the oldest pair to the newest one
+  std::vector<double> dot_;
+};
@@ -20,6 +20,7 @@ The driver class for minimizers.
 #include "force/force.cuh"
 #include "minimize.cuh"
 #include "minimizer_fire.cuh"
+#include "minimizer_lbfgs.cuh"
 #include "minimizer_sd.cuh"
 #include "utilities/error.cuh"
 #include "utilities/read_file.cuh"
@@ -41,6 +42,7 @@ void Minimize::parse_minimize(
 
   int minimizer_type = 0;
   int number_of_steps = 0;
+  int history_size = 10;
   double force_tolerance = 0.0;
   std::unique_ptr<Minimizer> minimizer;
   const int number_of_atoms = type.size();
@@ -79,6 +81,32 @@ void Minimize::parse_minimize(
     if (number_of_steps <= 0) {
       PRINT_INPUT_ERROR("Number of steps should > 0.");
     }
+  } else if (strcmp(param[1], "lbfgs") == 0) {
+    minimizer_type = 2;
+
+    if (num_param != 4 && num_param != 5) {
+      PRINT_INPUT_ERROR("minimize lbfgs should have 2 or 3 parameters.");
+    }
+
+    if (!is_valid_real(param[2], &force_tolerance)) {
+      PRINT_INPUT_ERROR("Force tolerance should be a number.");
+    }
+
+    if (!is_valid_int(param[3], &number_of_steps)) {
+      PRINT_INPUT_ERROR("Number of steps should be an integer.");
+    }
+    if (number_of_steps <= 0) {
+      PRINT_INPUT_ERROR("Number of steps should > 0.");
+    }
+
+    if (num_param == 5) {
+      if (!is_valid_int(param[4], &history_size)) {
+        PRINT_INPUT_ERROR("History size should be an integer.");
+      }
+      if (history_size <= 0) {
+        PRINT_INPUT_ERROR("History size should > 0.");
+      }
+    }
   } else {
     PRINT_INPUT_ERROR("Invalid minimizer.");
   }
@@ -113,6 +141,27 @@ void Minimize::parse_minimize(
 
       minimizer.reset(new Minimizer_FIRE(number_of_atoms, number_of_steps, force_tolerance));
 
+      minimizer->compute(
+        force,
+        box,
+        position_per_atom,
+        type,
+        group,
+        potential_per_atom,
+        force_per_atom,
+        virial_per_atom);
+
+      break;
+    case 2:
+      printf("\nStart to do an energy minimization.\n");
+      printf("    using the L-BFGS method with a history size of %d.\n", history_size);
+      printf("    with fixed box.\n");
+      printf("    with a force tolerance of %g eV/A.\n", force_tolerance);
+      printf("    for maximally %d steps.\n", number_of_steps);
+
+      minimizer.reset(
+        new Minimizer_LBFGS(number_of_atoms, number_of_steps, force_tolerance, history_size));
+
       minimizer->compute(
         force,
         box,
@@ -128,4 +177,6 @@ void Minimize::parse_minimize(
       PRINT_INPUT_ERROR("Invalid minimizer.");
       break;
   }
+
+  printf("    used %d force evaluations.\n", minimizer->get_number_of_force_evaluations());
 }
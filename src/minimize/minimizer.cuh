@@ -41,6 +41,9 @@ public:
 
   virtual ~Minimizer() = default;
 
+  // accumulated over all the calls of compute()
+  int get_number_of_force_evaluations() const { return number_of_force_evaluations_; }
+
   virtual void compute(
     Force& force,
     Box& box,
@@ -58,6 +61,7 @@ protected:
 
   int number_of_steps_ = 1000;
   int number_of_atoms_ = 0;
+  int number_of_force_evaluations_ = 0;
   double force_tolerance_ = 1.0e-6;
 
   GPU_Vector<double> position_per_atom_temp_;
@@ -73,20 +73,19 @@ __global__ void gpu_sum(const int size, double* a, double* result)
     *result = data[0];
 }
 
-double sum(GPU_Vector<double>& a)
+double sum(GPU_Vector<double>& a, GPU_Vector<double>& result)
 {
   double ret;
-  GPU_Vector<double> result(1);
   gpu_sum<<<1, 1024>>>(a.size(), a.data(), result.data());
   result.copy_to_host(&ret);
   return ret;
 }
 
-double dot(GPU_Vector<double>& a, GPU_Vector<double>& b)
+double dot(
+  GPU_Vector<double>& a, GPU_Vector<double>& b, GPU_Vector<double>& temp, GPU_Vector<double>& result)
 {
-  GPU_Vector<double> temp(a.size());
   pairwise_product(a, b, temp);
-  return sum(temp);
+  return sum(temp, result);
 }
 
 void scalar_multiply(const double& a, GPU_Vector<double>& b, GPU_Vector<double>& c)
@@ -113,18 +112,19 @@ void Minimizer_FIRE::compute(
   GPU_Vector<double>& virial_per_atom)
 {
   double next_dt;
-  const int size = number_of_atoms_ * 3;
   int base = (number_of_steps_ >= 10) ? (number_of_steps_ / 10) : 1;
-  // create a velocity vector in GPU
-  GPU_Vector<double> v(size, 0);
-  GPU_Vector<double> temp1(size);
-  GPU_Vector<double> temp2(size);
+  // start from rest with the initial parameters
+  v.fill(0);
+  dt = dt_0;
+  alpha = alpha_start;
+  N_neg = 0;
 
   printf("\nEnergy minimization started.\n");
 
   for (int step = 0; step < number_of_steps_; ++step) {
     force.compute(
       box, position_per_atom, type, group, potential_per_atom, force_per_atom, virial_per_atom);
+    ++number_of_force_evaluations_;
     calculate_force_square_max(force_per_atom);
     const double force_max = sqrt(cpu_force_square_max_[0]);
     calculate_total_potential(potential_per_atom);
@@ -139,7 +139,7 @@ void Minimizer_FIRE::compute(
         break;
     }
 
-    P = dot(v, force_per_atom);
+    P = dot(v, force_per_atom, product, result);
 
     if (P > 0) {
       if (N_neg > N_min) {
@@ -163,8 +163,8 @@ void Minimizer_FIRE::compute(
 
     // md step
     // implicit Euler integration
-    double F_modulus = sqrt(dot(force_per_atom, force_per_atom));
-    double v_modulus = sqrt(dot(v, v));
+    double F_modulus = sqrt(dot(force_per_atom, force_per_atom, product, result));
+    double v_modulus = sqrt(dot(v, v, product, result));
     // dv = F/m*dt
     scalar_multiply(dt / m, force_per_atom, temp2);
     vector_sum(v, temp2, v);
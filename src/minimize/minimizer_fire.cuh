@@ -34,11 +34,22 @@ private:
   double alpha = alpha_start;
   int N_neg = 0;
   double P;
+  // kept for all the calls of compute()
+  GPU_Vector<double> v;
+  GPU_Vector<double> temp1;
+  GPU_Vector<double> temp2;
+  GPU_Vector<double> product;
+  GPU_Vector<double> result;
 
 public:
   Minimizer_FIRE(const int number_of_atoms, const int number_of_steps, const double force_tolerance)
     : Minimizer(number_of_atoms, number_of_steps, force_tolerance)
   {
+    v.resize(number_of_atoms * 3);
+    temp1.resize(number_of_atoms * 3);
+    temp2.resize(number_of_atoms * 3);
+    product.resize(number_of_atoms * 3);
+    result.resize(1);
   }
 
   void compute(
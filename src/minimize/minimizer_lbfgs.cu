@@ -0,0 +1,297 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+The L-BFGS (limited-memory Broyden-Fletcher-Goldfarb-Shanno) minimizer with a
+backtracking line search.
+Reference: J. Nocedal, Mathematics of Computation 35, 773 (1980)
+------------------------------------------------------------------------------*/
+
+#include "force/force.cuh"
+#include "minimizer_lbfgs.cuh"
+#include <algorithm>
+
+namespace
+{
+
+// b_i * b_j for each pair (i, j) of basis vectors, one block per pair
+__global__ void gpu_find_dot(
+  const int size,
+  const int history_size,
+  const int* pair,
+  const double* s,
+  const double* y,
+  const double* f,
+  double* dot)
+{
+  const int tid = threadIdx.x;
+  const int bid = blockIdx.x;
+  const double* b[2];
+  for (int k = 0; k < 2; ++k) {
+    const int i = pair[bid * 2 + k];
+    if (i < history_size) {
+      b[k] = s + i * size;
+    } else if (i < 2 * history_size) {
+      b[k] = y + (i - history_size) * size;
+    } else {
+      b[k] = f;
+    }
+  }
+
+  __shared__ double s_dot[256];
+  double sum = 0.0;
+  for (int n = tid; n < size; n += blockDim.x) {
+    sum += b[0][n] * b[1][n];
+  }
+  s_dot[tid] = sum;
+  __syncthreads();
+
+  for (int offset = blockDim.x >> 1; offset > 0; offset >>= 1) {
+    if (tid < offset) {
+      s_dot[tid] += s_dot[tid + offset];
+    }
+    __syncthreads();
+  }
+
+  if (tid == 0) {
+    dot[bid] = s_dot[0];
+  }
+}
+
+// d = sum_i delta_i b_i
+__global__ void gpu_find_direction(
+  const int size,
+  const int history_size,
+  const double* delta,
+  const double* s,
+  const double* y,
+  const double* f,
+  double* direction)
+{
+  const int n = blockIdx.x * blockDim.x + threadIdx.x;
+  if (n < size) {
+    double d = delta[2 * history_size] * f[n];
+    for (int i = 0; i < history_size; ++i) {
+      if (delta[i] != 0.0) {
+        d += delta[i] * s[i * size + n];
+      }
+      if (delta[history_size + i] != 0.0) {
+        d += delta[history_size + i] * y[i * size + n];
+      }
+    }
+    direction[n] = d;
+  }
+}
+
+__global__ void gpu_update_positions(
+  const int size,
+  const double step,
+  const double* direction,
+  const double* position_per_atom,
+  double* position_per_atom_temp)
+{
+  const int n = blockIdx.x * blockDim.x + threadIdx.x;
+  if (n < size) {
+    position_per_atom_temp[n] = position_per_atom[n] + step * direction[n];
+  }
+}
+
+// s = x_new - x_old and y = g_new - g_old = f_old - f_new
+__global__ void gpu_update_history(
+  const int size,
+  const double* position_per_atom,
+  const double* position_per_atom_temp,
+  const double* force_per_atom,
+  const double* force_per_atom_temp,
+  double* s,
+  double* y)
+{
+  const int n = blockIdx.x * blockDim.x + threadIdx.x;
+  if (n < size) {
+    s[n] = position_per_atom_temp[n] - position_per_atom[n];
+    y[n] = force_per_atom[n] - force_per_atom_temp[n];
+  }
+}
+
+} // namespace
+
+Minimizer_LBFGS::Minimizer_LBFGS(
+  const int number_of_atoms,
+  const int number_of_steps,
+  const double force_tolerance,
+  const int history_size)
+  : Minimizer(number_of_atoms, number_of_steps, force_tolerance)
+{
+  history_.resize(history_size);
+  const int num_basis = history_.get_number_of_basis();
+  const int max_num_pairs = 3 * num_basis;
+  cpu_delta_.resize(num_basis);
+  cpu_pair_.resize(max_num_pairs * 2);
+  cpu_dot_.resize(max_num_pairs);
+  s_.resize(history_size * number_of_atoms * 3);
+  y_.resize(history_size * number_of_atoms * 3);
+  direction_.resize(number_of_atoms * 3);
+  delta_.resize(num_basis);
+  pair_.resize(max_num_pairs * 2);
+  dot_.resize(max_num_pairs);
+}
+
+void Minimizer_LBFGS::find_dots(const GPU_Vector<double>& force_per_atom, const int num_pairs)
+{
+  pair_.copy_from_host(cpu_pair_.data(), num_pairs * 2);
+  gpu_find_dot<<<num_pairs, 256>>>(
+    number_of_atoms_ * 3,
+    history_.get_history_size(),
+    pair_.data(),
+    s_.data(),
+    y_.data(),
+    force_per_atom.data(),
+    dot_.data());
+  dot_.copy_to_host(cpu_dot_.data(), num_pairs);
+  for (int k = 0; k < num_pairs; ++k) {
+    history_.set_dot(cpu_pair_[k * 2], cpu_pair_[k * 2 + 1], cpu_dot_[k]);
+  }
+}
+
+void Minimizer_LBFGS::compute(
+  Force& force,
+  Box& box,
+  GPU_Vector<double>& position_per_atom,
+  GPU_Vector<int>& type,
+  std::vector<Group>& group,
+  GPU_Vector<double>& potential_per_atom,
+  GPU_Vector<double>& force_per_atom,
+  GPU_Vector<double>& virial_per_atom)
+{
+  const int size = number_of_atoms_ * 3;
+  const int m = history_.get_history_size();
+  const int f_slot = history_.get_force_slot();
+  const int base = (number_of_steps_ >= 10) ? (number_of_steps_ / 10) : 1;
+  history_.reset();
+
+  force.compute(
+    box, position_per_atom, type, group, potential_per_atom, force_per_atom, virial_per_atom);
+  ++number_of_force_evaluations_;
+  cpu_pair_[0] = cpu_pair_[1] = f_slot;
+  find_dots(force_per_atom, 1);
+
+  printf("\nEnergy minimization started.\n");
+
+  for (int step = 0; step < number_of_steps_; ++step) {
+    calculate_force_square_max(force_per_atom);
+    const double force_max = sqrt(cpu_force_square_max_[0]);
+
+    if (step % base == 0 || force_max < force_tolerance_) {
+      calculate_total_potential(potential_per_atom);
+      printf(
+        "    step %d: total_potential = %.10f eV, f_max = %.10f eV/A.\n",
+        step,
+        cpu_total_potential_[0],
+        force_max);
+      if (force_max < force_tolerance_)
+        break;
+    }
+
+    // search direction d = H * f and the directional derivative -f * d
+    history_.find_coefficients(cpu_delta_);
+    double f_dot_d = history_.find_projection(cpu_delta_, f_slot);
+    if (f_dot_d <= 0.0) {
+      history_.reset(); // not a descent direction; restart from steepest descent
+      history_.find_coefficients(cpu_delta_);
+      f_dot_d = history_.get_dot(f_slot, f_slot);
+    }
+    delta_.copy_from_host(cpu_delta_.data());
+    gpu_find_direction<<<(size - 1) / 128 + 1, 128>>>(
+      size, m, delta_.data(), s_.data(), y_.data(), force_per_atom.data(), direction_.data());
+
+    calculate_force_square_max(direction_);
+    double step_length = std::min(1.0, max_move_ / sqrt(cpu_force_square_max_[0]));
+
+    // backtracking line search with the Armijo condition
+    bool is_accepted = false;
+    for (int k = 0; k < max_backtracks_; ++k) {
+      gpu_update_positions<<<(size - 1) / 128 + 1, 128>>>(
+        size,
+        step_length,
+        direction_.data(),
+        position_per_atom.data(),
+        position_per_atom_temp_.data());
+
+      force.compute(
+        box,
+        position_per_atom_temp_,
+        type,
+        group,
+        potential_per_atom_temp_,
+        force_per_atom_temp_,
+        virial_per_atom);
+      ++number_of_force_evaluations_;
+
+      calculate_total_potential(potential_per_atom);
+      if (
+        cpu_total_potential_[1] <=
+        cpu_total_potential_[0] - armijo_c1_ * step_length * f_dot_d) {
+        is_accepted = true;
+        break;
+      }
+      step_length *= 0.5;
+    }
+
+    if (!is_accepted) {
+      if (history_.get_number_of_pairs() == 0) {
+        printf("    step %d: line search failed along the steepest descent.\n", step);
+        break;
+      }
+      history_.reset();
+      continue;
+    }
+
+    const int slot = history_.get_new_slot();
+    gpu_update_history<<<(size - 1) / 128 + 1, 128>>>(
+      size,
+      position_per_atom.data(),
+      position_per_atom_temp_.data(),
+      force_per_atom.data(),
+      force_per_atom_temp_.data(),
+      s_.data() + slot * size,
+      y_.data() + slot * size);
+    position_per_atom_temp_.copy_to_device(position_per_atom.data());
+    force_per_atom_temp_.copy_to_device(force_per_atom.data());
+    potential_per_atom_temp_.copy_to_device(potential_per_atom.data());
+
+    // dot products of the new s, y and f with the kept pairs and with each other
+    int num_pairs = 0;
+    const int new_basis[3] = {slot, m + slot, f_slot};
+    for (int a = 0; a < 3; ++a) {
+      for (int k = 0; k < history_.get_number_of_pairs(); ++k) {
+        const int i = history_.get_slot(k);
+        for (int b : {i, m + i}) {
+          cpu_pair_[num_pairs * 2] = new_basis[a];
+          cpu_pair_[num_pairs * 2 + 1] = b;
+          ++num_pairs;
+        }
+      }
+      for (int b = a; b < 3; ++b) {
+        cpu_pair_[num_pairs * 2] = new_basis[a];
+        cpu_pair_[num_pairs * 2 + 1] = new_basis[b];
+        ++num_pairs;
+      }
+    }
+    find_dots(force_per_atom, num_pairs);
+    history_.push(slot);
+  }
+
+  printf("Energy minimization finished.\n");
+}
@@ -0,0 +1,56 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+#include "lbfgs_history.cuh"
+#include "minimizer.cuh"
+
+class Minimizer_LBFGS : public Minimizer
+{
+public:
+  Minimizer_LBFGS(
+    const int number_of_atoms,
+    const int number_of_steps,
+    const double force_tolerance,
+    const int history_size);
+
+  void compute(
+    Force& force,
+    Box& box,
+    GPU_Vector<double>& position_per_atom,
+    GPU_Vector<int>& type,
+    std::vector<Group>& group,
+    GPU_Vector<double>& potential_per_atom,
+    GPU_Vector<double>& force_per_atom,
+    GPU_Vector<double>& virial_per_atom);
+
+private:
+  void find_dots(const GPU_Vector<double>& force_per_atom, const int num_pairs);
+
+  const double max_move_ = 0.2;     // largest change of a position component in one step (A)
+  const double armijo_c1_ = 1.0e-4; // sufficient decrease of the energy
+  const int max_backtracks_ = 10;
+
+  LBFGS_History history_;
+  std::vector<double> cpu_delta_;
+  std::vector<int> cpu_pair_;
+  std::vector<double> cpu_dot_;
+  GPU_Vector<double> s_; // position changes of the history, slot by slot
+  GPU_Vector<double> y_; // gradient changes of the history, slot by slot
+  GPU_Vector<double> direction_;
+  GPU_Vector<double> delta_;
+  GPU_Vector<int> pair_;
+  GPU_Vector<double> dot_;
+};
@@ -55,7 +55,7 @@ void Minimizer_SD::compute(
   force.compute(
     box, position_per_atom, type, group, potential_per_atom, force_per_atom, virial_per_atom);
 
-  int number_of_force_evaluations = 1;
+  ++number_of_force_evaluations_;
   double position_step = 0.1;
 
   printf("\nEnergy minimization started.\n");
@@ -86,7 +86,7 @@ void Minimizer_SD::compute(
       force_per_atom_temp_,
       virial_per_atom);
 
-    ++number_of_force_evaluations;
+    ++number_of_force_evaluations_;
 
     calculate_total_potential(potential_per_atom);
 
@@ -14,6 +14,8 @@
 */
 
 #pragma once
+#include "utilities/host_backend.cuh"
+#include <cmath>
 
 class Box
 {
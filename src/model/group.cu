@@ -18,53 +18,113 @@ The class defining the grouping methods
 ------------------------------------------------------------------------------*/
 
 #include "group.cuh"
+#include <algorithm>
+#include <cstdint>
+#include <omp.h>
 #include <vector>
 
-void Group::find_size(const int N, const int k)
+// The atoms are grouped by a counting sort: a histogram of the labels in each
+// chunk of atoms, an exclusive scan, and a scatter of each chunk in parallel.
+// The atoms in each group stay in ascending order.
+static int get_num_chunks(const int N, const int number)
 {
-  cpu_size.resize(number);
-  cpu_size_sum.resize(number);
-  cpu_contents.resize(N);
+  // the per-chunk histograms should not take more memory than the labels
+  int num_chunks = std::min(omp_get_max_threads(), N / std::max(number, 1));
+  return std::max(num_chunks, 1);
+}
 
+static void find_chunk_size(
+  const int N,
+  const int number,
+  const int num_chunks,
+  const std::vector<int>& label,
+  std::vector<int>& chunk_size)
+{
+  chunk_size.assign(num_chunks * number, 0);
+#pragma omp parallel for
+  for (int c = 0; c < num_chunks; ++c) {
+    const int n_begin = int(int64_t(N) * c / num_chunks);
+    const int n_end = int(int64_t(N) * (c + 1) / num_chunks);
+    int* size_c = chunk_size.data() + c * number;
+    for (int n = n_begin; n < n_end; ++n) {
+      size_c[label[n]]++;
+    }
+  }
+}
+
+void Group::find_size(const int N, const int k)
+{
   if (number == 1) {
     printf("There is only one group of atoms in grouping method %d.\n", k);
   } else {
     printf("There are %d groups of atoms in grouping method %d.\n", number, k);
   }
 
-  for (int m = 0; m < number; m++) {
-    cpu_size[m] = 0;
-    cpu_size_sum[m] = 0;
-  }
-
-  for (int n = 0; n < N; n++) {
-    cpu_size[cpu_label[n]]++;
-  }
+  update_size(N);
 
   for (int m = 0; m < number; m++) {
     printf("    %d atoms in group %d.\n", cpu_size[m], m);
   }
+}
+
+void Group::update_size(const int N)
+{
+  const int num_chunks = get_num_chunks(N, number);
+  std::vector<int> chunk_size;
+  find_chunk_size(N, number, num_chunks, cpu_label, chunk_size);
 
-  for (int m = 1; m < number; m++) {
-    for (int n = 0; n < m; n++) {
-      cpu_size_sum[m] += cpu_size[n];
+  cpu_size.assign(number, 0);
+  for (int c = 0; c < num_chunks; ++c) {
+    for (int m = 0; m < number; m++) {
+      cpu_size[m] += chunk_size[c * number + m];
     }
   }
+
+  cpu_size_sum.resize(number);
+  int sum = 0;
+  for (int m = 0; m < number; m++) {
+    cpu_size_sum[m] = sum;
+    sum += cpu_size[m];
+  }
 }
 
 // re-arrange the atoms from the first to the last group
 void Group::find_contents(const int N)
 {
-  std::vector<int> offset(number);
+  const int num_chunks = get_num_chunks(N, number);
+  std::vector<int> chunk_offset;
+  find_chunk_size(N, number, num_chunks, cpu_label, chunk_offset);
+
+  // where the atoms of each group in each chunk start
   for (int m = 0; m < number; m++) {
-    offset[m] = 0;
+    int offset = cpu_size_sum[m];
+    for (int c = 0; c < num_chunks; ++c) {
+      int size = chunk_offset[c * number + m];
+      chunk_offset[c * number + m] = offset;
+      offset += size;
+    }
   }
 
-  for (int n = 0; n < N; n++) {
-    for (int m = 0; m < number; m++) {
-      if (cpu_label[n] == m) {
-        cpu_contents[cpu_size_sum[m] + offset[m]++] = n;
-      }
+  cpu_contents.resize(N);
+#pragma omp parallel for
+  for (int c = 0; c < num_chunks; ++c) {
+    const int n_begin = int(int64_t(N) * c / num_chunks);
+    const int n_end = int(int64_t(N) * (c + 1) / num_chunks);
+    int* offset_c = chunk_offset.data() + c * number;
+    for (int n = n_begin; n < n_end; ++n) {
+      cpu_contents[offset_c[cpu_label[n]]++] = n;
     }
   }
 }
+
+// used after the labels have been changed on the GPU during a run
+void Group::update_from_label(const int N)
+{
+  cpu_label.resize(N);
+  label.copy_to_host(cpu_label.data());
+  update_size(N);
+  find_contents(N);
+  size.copy_from_host(cpu_size.data());
+  size_sum.copy_from_host(cpu_size_sum.data());
+  contents.copy_from_host(cpu_contents.data());
+}
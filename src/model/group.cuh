@@ -32,6 +32,8 @@ public:
   std::vector<int> cpu_size_sum;
   std::vector<int> cpu_contents;
 
-  void find_size(const int N, const int k);
-  void find_contents(const int N);
+  void find_size(const int N, const int k);   // update_size() and print the group sizes
+  void update_size(const int N);              // find cpu_size and cpu_size_sum from cpu_label
+  void find_contents(const int N);            // find cpu_contents from cpu_label
+  void update_from_label(const int N);        // all the above and the GPU data, from label
 };
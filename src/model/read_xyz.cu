@@ -23,13 +23,21 @@ The class defining the simulation model.
 #include "read_xyz.cuh"
 #include "utilities/common.cuh"
 #include "utilities/error.cuh"
+#include "utilities/mapped_file.cuh"
 #include <algorithm>
 #include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <sstream>
 #include <string>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 const std::map<std::string, double> MASS_TABLE{
   {"H", 1.0080000000},
@@ -179,12 +187,13 @@ static void read_xyz_line_1(std::ifstream& input, int& N)
 
 static void read_xyz_line_2(
   std::ifstream& input,
-  Box& box,
+  int* pbc,
+  double* lattice,
   int& has_velocity_in_xyz,
   bool& has_mass,
   int& num_columns,
   int* property_offset,
-  std::vector<Group>& group)
+  int& num_groups)
 {
   std::vector<std::string> tokens = get_tokens_without_unwanted_spaces(input);
   for (auto& token : tokens) {
@@ -192,36 +201,33 @@ static void read_xyz_line_2(
       token.begin(), token.end(), token.begin(), [](unsigned char c) { return std::tolower(c); });
   }
 
-  box.pbc_x = box.pbc_y = box.pbc_z = 1; // default is periodic
+  pbc[0] = pbc[1] = pbc[2] = 1; // default is periodic
   for (int n = 0; n < tokens.size(); ++n) {
     const std::string tmp_string = "pbc=";
     if (tokens[n].substr(0, tmp_string.length()) == tmp_string) {
       if (tokens[n].back() == 't') {
-        box.pbc_x = 1;
+        pbc[0] = 1;
       } else if (tokens[n].back() == 'f') {
-        box.pbc_x = 0;
+        pbc[0] = 0;
       } else {
         PRINT_INPUT_ERROR("periodic boundary in x direction should be T or F.");
       }
       if (tokens[n + 1] == "t") {
-        box.pbc_y = 1;
+        pbc[1] = 1;
       } else if (tokens[n + 1] == "f") {
-        box.pbc_y = 0;
+        pbc[1] = 0;
       } else {
         PRINT_INPUT_ERROR("periodic boundary in y direction should be T or F.");
       }
       if (tokens[n + 2].front() == 't') {
-        box.pbc_z = 1;
+        pbc[2] = 1;
       } else if (tokens[n + 2].front() == 'f') {
-        box.pbc_z = 0;
+        pbc[2] = 0;
       } else {
         PRINT_INPUT_ERROR("periodic boundary in z direction should be T or F.");
       }
     }
   }
-  printf("Use %s boundary conditions along x.\n", (box.pbc_x == 1) ? "periodic" : "free");
-  printf("Use %s boundary conditions along y.\n", (box.pbc_y == 1) ? "periodic" : "free");
-  printf("Use %s boundary conditions along z.\n", (box.pbc_z == 1) ? "periodic" : "free");
 
   // box matrix
   bool has_lattice_in_exyz = false;
@@ -231,7 +237,7 @@ static void read_xyz_line_2(
       has_lattice_in_exyz = true;
       const int transpose_index[9] = {0, 3, 6, 1, 4, 7, 2, 5, 8};
       for (int m = 0; m < 9; ++m) {
-        box.cpu_h[transpose_index[m]] = get_double_from_token(
+        lattice[transpose_index[m]] = get_double_from_token(
           tokens[n + m].substr(
             (m == 0) ? (lattice_string.length() + 1) : 0,
             (m == 8) ? (tokens[n + m].length() - 1) : tokens[n + m].length()),
@@ -242,56 +248,6 @@ static void read_xyz_line_2(
   }
   if (!has_lattice_in_exyz) {
     PRINT_INPUT_ERROR("'lattice' is missing in the second line of the model file.");
-  } else {
-
-    if (
-      !need_triclinic() && box.cpu_h[1] == 0 && box.cpu_h[2] == 0 && box.cpu_h[3] == 0 &&
-      box.cpu_h[5] == 0 && box.cpu_h[6] == 0 && box.cpu_h[7] == 0) {
-      box.triclinic = 0;
-    } else {
-      box.triclinic = 1;
-    }
-
-    (box.triclinic == 0) ? printf("Use orthogonal box.\n") : printf("Use triclinic box.\n");
-
-    if (box.triclinic == 1) {
-      printf("Box matrix h = [a, b, c] is\n");
-      for (int d1 = 0; d1 < 3; ++d1) {
-        for (int d2 = 0; d2 < 3; ++d2) {
-          printf("%20.10e", box.cpu_h[d1 * 3 + d2]);
-        }
-        printf("\n");
-      }
-
-      box.get_inverse();
-
-      printf("Inverse box matrix g = inv(h) is\n");
-      for (int d1 = 0; d1 < 3; ++d1) {
-        for (int d2 = 0; d2 < 3; ++d2) {
-          printf("%20.10e", box.cpu_h[9 + d1 * 3 + d2]);
-        }
-        printf("\n");
-      }
-    } else {
-      box.cpu_h[1] = box.cpu_h[4];
-      box.cpu_h[2] = box.cpu_h[8];
-      box.cpu_h[3] = box.cpu_h[0] * 0.5;
-      box.cpu_h[4] = box.cpu_h[1] * 0.5;
-      box.cpu_h[5] = box.cpu_h[2] * 0.5;
-      if (box.cpu_h[0] <= 0) {
-        PRINT_INPUT_ERROR("Box length in x direction <= 0.");
-      }
-      if (box.cpu_h[1] <= 0) {
-        PRINT_INPUT_ERROR("Box length in y direction <= 0.");
-      }
-      if (box.cpu_h[2] <= 0) {
-        PRINT_INPUT_ERROR("Box length in z direction <= 0.");
-      }
-      printf("Box lengths are\n");
-      printf("    Lx = %20.10e A\n", box.cpu_h[0]);
-      printf("    Ly = %20.10e A\n", box.cpu_h[1]);
-      printf("    Lz = %20.10e A\n", box.cpu_h[2]);
-    }
   }
 
   // properties
@@ -315,22 +271,13 @@ static void read_xyz_line_2(
         }
       }
 
-      if (property_position[3] < 0) {
-        has_velocity_in_xyz = 0;
-        printf("Do not specify initial velocities here.\n");
-      } else {
-        has_velocity_in_xyz = 1;
-        printf("Specify initial velocities here.\n");
-      }
+      has_velocity_in_xyz = (property_position[3] < 0) ? 0 : 1;
 
       if (property_position[4] < 0) {
-        group.resize(0);
-        printf("Have no grouping method.\n");
+        num_groups = 0;
       } else {
-        int num_of_grouping_methods =
+        num_groups =
           get_int_from_token(sub_tokens[property_position[4] * 3 + 2], __FILE__, __LINE__);
-        group.resize(num_of_grouping_methods);
-        printf("Have %d grouping method(s).\n", num_of_grouping_methods);
       }
 
       for (int k = 0; k < sub_tokens.size() / 3; ++k) {
@@ -358,6 +305,83 @@ static void read_xyz_line_2(
   }
 }
 
+static void
+initialize_box(const int* pbc, const double* lattice, const bool is_triclinic, Box& box)
+{
+  box.pbc_x = pbc[0];
+  box.pbc_y = pbc[1];
+  box.pbc_z = pbc[2];
+  printf("Use %s boundary conditions along x.\n", (box.pbc_x == 1) ? "periodic" : "free");
+  printf("Use %s boundary conditions along y.\n", (box.pbc_y == 1) ? "periodic" : "free");
+  printf("Use %s boundary conditions along z.\n", (box.pbc_z == 1) ? "periodic" : "free");
+
+  for (int d = 0; d < 9; ++d) {
+    box.cpu_h[d] = lattice[d];
+  }
+  if (
+    !is_triclinic && !need_triclinic() && box.cpu_h[1] == 0 && box.cpu_h[2] == 0 &&
+    box.cpu_h[3] == 0 && box.cpu_h[5] == 0 && box.cpu_h[6] == 0 && box.cpu_h[7] == 0) {
+    box.triclinic = 0;
+  } else {
+    box.triclinic = 1;
+  }
+
+  (box.triclinic == 0) ? printf("Use orthogonal box.\n") : printf("Use triclinic box.\n");
+
+  if (box.triclinic == 1) {
+    printf("Box matrix h = [a, b, c] is\n");
+    for (int d1 = 0; d1 < 3; ++d1) {
+      for (int d2 = 0; d2 < 3; ++d2) {
+        printf("%20.10e", box.cpu_h[d1 * 3 + d2]);
+      }
+      printf("\n");
+    }
+
+    box.get_inverse();
+
+    printf("Inverse box matrix g = inv(h) is\n");
+    for (int d1 = 0; d1 < 3; ++d1) {
+      for (int d2 = 0; d2 < 3; ++d2) {
+        printf("%20.10e", box.cpu_h[9 + d1 * 3 + d2]);
+      }
+      printf("\n");
+    }
+  } else {
+    box.cpu_h[1] = box.cpu_h[4];
+    box.cpu_h[2] = box.cpu_h[8];
+    box.cpu_h[3] = box.cpu_h[0] * 0.5;
+    box.cpu_h[4] = box.cpu_h[1] * 0.5;
+    box.cpu_h[5] = box.cpu_h[2] * 0.5;
+    if (box.cpu_h[0] <= 0) {
+      PRINT_INPUT_ERROR("Box length in x direction <= 0.");
+    }
+    if (box.cpu_h[1] <= 0) {
+      PRINT_INPUT_ERROR("Box length in y direction <= 0.");
+    }
+    if (box.cpu_h[2] <= 0) {
+      PRINT_INPUT_ERROR("Box length in z direction <= 0.");
+    }
+    printf("Box lengths are\n");
+    printf("    Lx = %20.10e A\n", box.cpu_h[0]);
+    printf("    Ly = %20.10e A\n", box.cpu_h[1]);
+    printf("    Lz = %20.10e A\n", box.cpu_h[2]);
+  }
+}
+
+static void report_properties(const int has_velocity_in_xyz, const int num_groups)
+{
+  if (has_velocity_in_xyz == 0) {
+    printf("Do not specify initial velocities here.\n");
+  } else {
+    printf("Specify initial velocities here.\n");
+  }
+  if (num_groups == 0) {
+    printf("Have no grouping method.\n");
+  } else {
+    printf("Have %d grouping method(s).\n", num_groups);
+  }
+}
+
 void read_xyz_in_line_3(
   std::ifstream& input,
   const int N,
@@ -441,6 +465,746 @@ void read_xyz_in_line_3(
   }
 }
 
+// Perfect hash of chemical symbols: an upper-case letter optionally followed by a lower-case
+// letter is mapped into [0, NUM_SYMBOL_HASH) and anything else to -1.
+const int NUM_SYMBOL_HASH = 26 * 27;
+
+static int get_symbol_hash(const char* symbol, const int length)
+{
+  if (length < 1 || length > 2 || symbol[0] < 'A' || symbol[0] > 'Z') {
+    return -1;
+  }
+  int second = 0;
+  if (length == 2) {
+    if (symbol[1] < 'a' || symbol[1] > 'z') {
+      return -1;
+    }
+    second = symbol[1] - 'a' + 1;
+  }
+  return (symbol[0] - 'A') * 27 + second;
+}
+
+static bool is_whitespace(const char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Same semantics as std::stod: a valid prefix is enough, but out-of-range values are errors.
+static bool parse_double_slow(const char* begin, const char* end, double& value)
+{
+  std::string token(begin, end);
+  char* stop = nullptr;
+  errno = 0;
+  value = strtod(token.c_str(), &stop);
+  return stop != token.c_str() && errno != ERANGE;
+}
+
+// Up to 19 significant digits and a decimal exponent within [-22, 22] are converted exactly by
+// one multiplication or division (Clinger's fast path); other inputs go to strtod.
+static bool parse_double(const char* begin, const char* end, double& value)
+{
+  const double power_of_10[23] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                  1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                  1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const char* p = begin;
+  bool is_negative = false;
+  if (p < end && (*p == '+' || *p == '-')) {
+    is_negative = (*p == '-');
+    ++p;
+  }
+  unsigned long long mantissa = 0;
+  int num_digits = 0;
+  int exponent = 0;
+  bool has_digit = false;
+  bool after_point = false;
+  for (; p < end; ++p) {
+    if (*p == '.' && !after_point) {
+      after_point = true;
+      continue;
+    }
+    if (*p < '0' || *p > '9') {
+      break;
+    }
+    has_digit = true;
+    if (num_digits > 0 || *p != '0') {
+      if (++num_digits > 19) {
+        return parse_double_slow(begin, end, value);
+      }
+    }
+    mantissa = mantissa * 10 + (*p - '0');
+    if (after_point) {
+      --exponent;
+    }
+  }
+  if (!has_digit) {
+    return parse_double_slow(begin, end, value);
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    bool is_negative_exponent = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+      is_negative_exponent = (*p == '-');
+      ++p;
+    }
+    int exponent_part = 0;
+    bool has_exponent_digit = false;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+      has_exponent_digit = true;
+      if (exponent_part < 10000) {
+        exponent_part = exponent_part * 10 + (*p - '0');
+      }
+    }
+    if (!has_exponent_digit) {
+      return parse_double_slow(begin, end, value);
+    }
+    exponent += is_negative_exponent ? -exponent_part : exponent_part;
+  }
+  if (p != end || mantissa > (1ULL << 53) || exponent < -22 || exponent > 22) {
+    return parse_double_slow(begin, end, value);
+  }
+  value = double(mantissa);
+  value = (exponent < 0) ? value / power_of_10[-exponent] : value * power_of_10[exponent];
+  if (is_negative) {
+    value = -value;
+  }
+  return true;
+}
+
+// Same semantics as std::stoi.
+static bool parse_int(const char* begin, const char* end, int& value)
+{
+  std::string token(begin, end);
+  char* stop = nullptr;
+  errno = 0;
+  const long value_long = strtol(token.c_str(), &stop, 10);
+  value = int(value_long);
+  return stop != token.c_str() && errno != ERANGE && value_long >= INT_MIN &&
+         value_long <= INT_MAX;
+}
+
+enum Xyz_Line_Error {
+  XYZ_LINE_OK = 0,
+  XYZ_LINE_COLUMNS,
+  XYZ_LINE_SPECIES,
+  XYZ_LINE_NUMBER,
+  XYZ_LINE_MASS,
+  XYZ_LINE_GROUP
+};
+
+struct Xyz_Atom_Columns {
+  int num_columns = 0;
+  int property_offset[5] = {0, 0, 0, 0, 0}; // species,pos,mass,vel,group
+  double velocity_factor = 1.0;             // unit conversion of the velocities
+  short* species_hash = nullptr;            // perfect hash of the chemical symbols
+  double* mass = nullptr;                   // nullptr if there is no mass column
+  double* position = nullptr;               // x of all atoms, then y, then z
+  double* velocity = nullptr;               // nullptr if there is no velocity column
+  std::vector<int*> group_label;            // one array for each grouping method
+};
+
+static Xyz_Line_Error parse_xyz_atom_line(
+  const char* begin,
+  const char* end,
+  const int N,
+  const int n,
+  Xyz_Atom_Columns& columns,
+  std::vector<int>& group_number)
+{
+  const char* token_begin[128];
+  const char* token_end[128];
+  int num_tokens = 0;
+  const char* p = begin;
+  while (true) {
+    while (p < end && is_whitespace(*p)) {
+      ++p;
+    }
+    if (p == end) {
+      break;
+    }
+    if (num_tokens == columns.num_columns || num_tokens == 128) {
+      return XYZ_LINE_COLUMNS;
+    }
+    token_begin[num_tokens] = p;
+    while (p < end && !is_whitespace(*p)) {
+      ++p;
+    }
+    token_end[num_tokens++] = p;
+  }
+  if (num_tokens != columns.num_columns) {
+    return XYZ_LINE_COLUMNS;
+  }
+
+  const int* offset = columns.property_offset;
+  const int hash =
+    get_symbol_hash(token_begin[offset[0]], token_end[offset[0]] - token_begin[offset[0]]);
+  if (hash < 0) {
+    return XYZ_LINE_SPECIES;
+  }
+  columns.species_hash[n] = hash;
+
+  for (int d = 0; d < 3; ++d) {
+    if (!parse_double(
+          token_begin[offset[1] + d], token_end[offset[1] + d], columns.position[n + N * d])) {
+      return XYZ_LINE_NUMBER;
+    }
+  }
+
+  if (columns.mass != nullptr) {
+    if (!parse_double(token_begin[offset[2]], token_end[offset[2]], columns.mass[n])) {
+      return XYZ_LINE_NUMBER;
+    }
+    if (columns.mass[n] <= 0) {
+      return XYZ_LINE_MASS;
+    }
+  }
+
+  if (columns.velocity != nullptr) {
+    for (int d = 0; d < 3; ++d) {
+      double velocity = 0.0;
+      if (!parse_double(token_begin[offset[3] + d], token_end[offset[3] + d], velocity)) {
+        return XYZ_LINE_NUMBER;
+      }
+      columns.velocity[n + N * d] = velocity * columns.velocity_factor;
+    }
+  }
+
+  for (int m = 0; m < columns.group_label.size(); ++m) {
+    int label = 0;
+    if (!parse_int(token_begin[offset[4] + m], token_end[offset[4] + m], label)) {
+      return XYZ_LINE_NUMBER;
+    }
+    if (label < 0 || label >= N) {
+      return XYZ_LINE_GROUP;
+    }
+    columns.group_label[m][n] = label;
+    if (label + 1 > group_number[m]) {
+      group_number[m] = label + 1;
+    }
+  }
+  return XYZ_LINE_OK;
+}
+
+// Parse the N atom lines starting at the given offset of an extended XYZ file. The file is
+// memory-mapped and cut into chunks at line boundaries: the lines in each chunk are counted in
+// parallel to find the index of the first atom of each chunk, and then parsed in parallel.
+static void read_xyz_atoms_in_parallel(
+  const char* filename,
+  const size_t offset,
+  const int N,
+  Xyz_Atom_Columns& columns,
+  std::vector<int>& group_number)
+{
+  Mapped_File file(filename);
+  const char* begin = file.data() + std::min(offset, file.size());
+  const char* end = file.data() + file.size();
+  const size_t bytes_per_chunk = 1 << 20;
+  int num_chunks = std::max(size_t(1), (end - begin) / bytes_per_chunk);
+#ifdef _OPENMP
+  num_chunks = std::min(num_chunks, omp_get_max_threads() * 16);
+#else
+  num_chunks = 1;
+#endif
+
+  std::vector<const char*> chunk_begin(num_chunks + 1, end);
+  chunk_begin[0] = begin;
+  for (int k = 1; k < num_chunks; ++k) {
+    const char* p = std::max(begin + (end - begin) / num_chunks * k, chunk_begin[k - 1]);
+    const char* newline = static_cast<const char*>(memchr(p, '\n', end - p));
+    chunk_begin[k] = (newline == nullptr) ? end : newline + 1;
+  }
+
+  std::vector<long long> first_line(num_chunks + 1, 0);
+#pragma omp parallel for
+  for (int k = 0; k < num_chunks; ++k) {
+    long long count = 0;
+    const char* p = chunk_begin[k];
+    while (p < chunk_begin[k + 1]) {
+      const char* newline = static_cast<const char*>(memchr(p, '\n', chunk_begin[k + 1] - p));
+      ++count; // a last line without '\n' also counts
+      p = (newline == nullptr) ? chunk_begin[k + 1] : newline + 1;
+    }
+    first_line[k + 1] = count;
+  }
+  for (int k = 0; k < num_chunks; ++k) {
+    first_line[k + 1] += first_line[k];
+  }
+
+  const int num_groups = columns.group_label.size();
+  std::vector<int> chunk_error(num_chunks, XYZ_LINE_OK);
+  std::vector<long long> chunk_error_atom(num_chunks, N);
+  std::vector<int> chunk_group_number(num_chunks * num_groups, 0);
+#pragma omp parallel for schedule(dynamic)
+  for (int k = 0; k < num_chunks; ++k) {
+    std::vector<int> local_group_number(num_groups, 0);
+    long long n = first_line[k];
+    const char* p = chunk_begin[k];
+    while (p < chunk_begin[k + 1] && n < N) {
+      const char* newline = static_cast<const char*>(memchr(p, '\n', chunk_begin[k + 1] - p));
+      const char* line_end = (newline == nullptr) ? chunk_begin[k + 1] : newline;
+      Xyz_Line_Error error = parse_xyz_atom_line(p, line_end, N, n, columns, local_group_number);
+      if (error != XYZ_LINE_OK) {
+        chunk_error[k] = error;
+        chunk_error_atom[k] = n;
+        break;
+      }
+      ++n;
+      p = (newline == nullptr) ? chunk_begin[k + 1] : newline + 1;
+    }
+    for (int m = 0; m < num_groups; ++m) {
+      chunk_group_number[k * num_groups + m] = local_group_number[m];
+    }
+  }
+
+  int error = (first_line[num_chunks] < N) ? XYZ_LINE_COLUMNS : XYZ_LINE_OK;
+  long long error_atom = first_line[num_chunks];
+  for (int k = 0; k < num_chunks; ++k) {
+    if (chunk_error[k] != XYZ_LINE_OK && chunk_error_atom[k] < error_atom) {
+      error = chunk_error[k];
+      error_atom = chunk_error_atom[k];
+    }
+  }
+  if (error != XYZ_LINE_OK) {
+    printf("Error in the line of atom %lld in %s.\n", error_atom, filename);
+  }
+  if (error == XYZ_LINE_COLUMNS) {
+    PRINT_INPUT_ERROR("number of columns does not match properties.\n");
+  } else if (error == XYZ_LINE_SPECIES) {
+    PRINT_INPUT_ERROR("There is atom in model.xyz that is not allowed in the used potential.\n");
+  } else if (error == XYZ_LINE_NUMBER) {
+    PRINT_INPUT_ERROR("Failed to convert a number.");
+  } else if (error == XYZ_LINE_MASS) {
+    PRINT_INPUT_ERROR("Atom mass should > 0.");
+  } else if (error == XYZ_LINE_GROUP) {
+    PRINT_INPUT_ERROR("Group label should >= 0 and < N.");
+  }
+
+  group_number.assign(num_groups, 0);
+  for (int k = 0; k < num_chunks; ++k) {
+    for (int m = 0; m < num_groups; ++m) {
+      group_number[m] = std::max(group_number[m], chunk_group_number[k * num_groups + m]);
+    }
+  }
+}
+
+// map the perfect hash of each atom to its type in the potential
+static void find_type_from_hash(
+  const int N,
+  const short* species_hash,
+  const bool has_mass,
+  const std::vector<std::string>& atom_symbols,
+  std::vector<std::string>& cpu_atom_symbol,
+  std::vector<int>& cpu_type,
+  std::vector<double>& cpu_mass)
+{
+  const int number_of_types = atom_symbols.size();
+  std::vector<int> hash_to_type(NUM_SYMBOL_HASH, -1);
+  std::vector<double> type_mass(number_of_types, -1.0);
+  for (int t = 0; t < number_of_types; ++t) {
+    hash_to_type[get_symbol_hash(atom_symbols[t].c_str(), atom_symbols[t].size())] = t;
+    auto iter = MASS_TABLE.find(atom_symbols[t]);
+    if (iter != MASS_TABLE.end()) {
+      type_mass[t] = iter->second;
+    }
+  }
+
+  int error = 0;
+#pragma omp parallel for reduction(max : error)
+  for (int n = 0; n < N; ++n) {
+    const int t = (species_hash[n] < 0) ? -1 : hash_to_type[species_hash[n]];
+    if (t < 0) {
+      error = std::max(error, 1);
+      continue;
+    }
+    cpu_type[n] = t;
+    cpu_atom_symbol[n] = atom_symbols[t];
+    if (!has_mass) {
+      if (type_mass[t] < 0.0) {
+        error = std::max(error, 2);
+      }
+      cpu_mass[n] = type_mass[t];
+    }
+  }
+  if (error == 1) {
+    PRINT_INPUT_ERROR("There is atom in the model file that is not allowed in the potential.\n");
+  } else if (error == 2) {
+    PRINT_INPUT_ERROR("There is atom without a mass column whose mass is unknown.\n");
+  }
+}
+
+static bool is_symbol_hashable(const std::vector<std::string>& atom_symbols)
+{
+  for (const auto& symbol : atom_symbols) {
+    if (get_symbol_hash(symbol.c_str(), symbol.size()) < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void read_xyz_in_parallel(
+  const char* filename,
+  const size_t offset,
+  const int N,
+  const int has_velocity_in_xyz,
+  const bool has_mass,
+  const int num_columns,
+  const int* property_offset,
+  int& number_of_types,
+  std::vector<std::string>& atom_symbols,
+  std::vector<std::string>& cpu_atom_symbol,
+  std::vector<int>& cpu_type,
+  std::vector<double>& cpu_mass,
+  std::vector<double>& cpu_position_per_atom,
+  std::vector<double>& cpu_velocity_per_atom,
+  std::vector<Group>& group)
+{
+  cpu_atom_symbol.resize(N);
+  cpu_type.resize(N);
+  cpu_mass.resize(N);
+  cpu_position_per_atom.resize(N * 3);
+  cpu_velocity_per_atom.resize(N * 3);
+  number_of_types = atom_symbols.size();
+  std::vector<short> species_hash(N);
+
+  Xyz_Atom_Columns columns;
+  columns.num_columns = num_columns;
+  for (int k = 0; k < 5; ++k) {
+    columns.property_offset[k] = property_offset[k];
+  }
+  columns.velocity_factor = TIME_UNIT_CONVERSION;
+  columns.species_hash = species_hash.data();
+  columns.mass = has_mass ? cpu_mass.data() : nullptr;
+  columns.position = cpu_position_per_atom.data();
+  columns.velocity = has_velocity_in_xyz ? cpu_velocity_per_atom.data() : nullptr;
+  for (int m = 0; m < group.size(); ++m) {
+    group[m].cpu_label.resize(N);
+    columns.group_label.push_back(group[m].cpu_label.data());
+  }
+
+  std::vector<int> group_number;
+  read_xyz_atoms_in_parallel(filename, offset, N, columns, group_number);
+  for (int m = 0; m < group.size(); ++m) {
+    group[m].number = group_number[m];
+  }
+
+  find_type_from_hash(
+    N, species_hash.data(), has_mass, atom_symbols, cpu_atom_symbol, cpu_type, cpu_mass);
+}
+
+// Binary model file (model.bin), written by xyz2bin and by dump_restart (restart.bin):
+//     Model_Binary_Header
+//     char symbol[N][2] (the second character is '\0' for one-letter symbols)
+//     double position[3][N] (x of all atoms, then y, then z)
+//     double mass[N] (if has_mass)
+//     double velocity[3][N] (if has_velocity, in units of A/fs)
+//     int group_label[num_groups][N]
+// The checksum is computed by update_checksum() over all the data after the header.
+const char MODEL_BINARY_MAGIC[8] = "GPUMDXB";
+const int MODEL_BINARY_VERSION = 2;
+
+struct Model_Binary_Header {
+  char magic[8];                      // MODEL_BINARY_MAGIC
+  int version = MODEL_BINARY_VERSION; // format version
+  int number_of_atoms = 0;            // N
+  int pbc[3] = {1, 1, 1};             // periodic (1) or free (0) boundaries
+  int has_velocity = 0;               // 1 if there are velocities
+  int has_mass = 0;                   // 1 if there are masses
+  int num_groups = 0;                 // number of grouping methods
+  int triclinic = 0;                  // 1 to use a triclinic box even if h is diagonal
+  int padding = 0;                    // keep the doubles aligned
+  double lattice[9] = {};             // h = [a, b, c] in row-major order
+  long long step = 0;                 // step at which a restart file is written
+  double time = 0.0;                  // time (in units of fs) at which a restart file is written
+  unsigned long long checksum = 0;    // checksum of the data after the header
+
+  Model_Binary_Header() { memcpy(magic, MODEL_BINARY_MAGIC, sizeof(magic)); }
+};
+
+const unsigned long long CHECKSUM_OFFSET = 14695981039346656037ULL;
+
+// FNV-1a hash over 64-bit words (and the remaining bytes)
+static void update_checksum(const void* data, const size_t num_bytes, unsigned long long& hash)
+{
+  const unsigned long long prime = 1099511628211ULL;
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  size_t i = 0;
+  for (; i + 8 <= num_bytes; i += 8) {
+    unsigned long long word;
+    memcpy(&word, bytes + i, 8);
+    hash = (hash ^ word) * prime;
+  }
+  for (; i < num_bytes; ++i) {
+    hash = (hash ^ bytes[i]) * prime;
+  }
+}
+
+template <typename T>
+static void read_binary_block(
+  FILE* fid, T* data, const size_t count, const char* filename, unsigned long long& checksum)
+{
+  if (fread(data, sizeof(T), count, fid) != count) {
+    printf("Failed to read %s.\n", filename);
+    PRINT_INPUT_ERROR("The binary model file is truncated.");
+  }
+  update_checksum(data, sizeof(T) * count, checksum);
+}
+
+template <typename T>
+static void write_binary_block(FILE* fid, const T* data, const size_t count, const char* filename)
+{
+  if (fwrite(data, sizeof(T), count, fid) != count) {
+    printf("Failed to write %s.\n", filename);
+    PRINT_INPUT_ERROR("Writing the binary model file failed.");
+  }
+}
+
+// write to a temporary file which then replaces the target, such that an interrupted write
+// never leaves a broken file behind
+static void write_model_binary_file(
+  const char* filename,
+  Model_Binary_Header& header,
+  const std::vector<char>& symbol,
+  const std::vector<double>& position,
+  const std::vector<double>& mass,
+  const std::vector<double>& velocity,
+  const std::vector<int>& group_label)
+{
+  header.checksum = CHECKSUM_OFFSET;
+  update_checksum(symbol.data(), symbol.size(), header.checksum);
+  update_checksum(position.data(), sizeof(double) * position.size(), header.checksum);
+  update_checksum(mass.data(), sizeof(double) * mass.size(), header.checksum);
+  update_checksum(velocity.data(), sizeof(double) * velocity.size(), header.checksum);
+  update_checksum(group_label.data(), sizeof(int) * group_label.size(), header.checksum);
+
+  std::string filename_tmp = std::string(filename) + ".tmp";
+  FILE* fid = my_fopen(filename_tmp.c_str(), "wb");
+  write_binary_block(fid, &header, 1, filename);
+  write_binary_block(fid, symbol.data(), symbol.size(), filename);
+  write_binary_block(fid, position.data(), position.size(), filename);
+  write_binary_block(fid, mass.data(), mass.size(), filename);
+  write_binary_block(fid, velocity.data(), velocity.size(), filename);
+  write_binary_block(fid, group_label.data(), group_label.size(), filename);
+  if (fclose(fid) != 0) {
+    printf("Failed to write %s.\n", filename);
+    PRINT_INPUT_ERROR("Writing the binary model file failed.");
+  }
+#ifdef _WIN32
+  remove(filename);
+#endif
+  if (rename(filename_tmp.c_str(), filename) != 0) {
+    printf("Failed to rename %s to %s.\n", filename_tmp.c_str(), filename);
+    PRINT_INPUT_ERROR("Writing the binary model file failed.");
+  }
+}
+
+static void read_model_binary(
+  const char* filename,
+  int& has_velocity_in_xyz,
+  int& number_of_types,
+  std::vector<std::string>& atom_symbols,
+  Box& box,
+  std::vector<Group>& group,
+  Atom& atom)
+{
+  FILE* fid = my_fopen(filename, "rb");
+  Model_Binary_Header header;
+  unsigned long long checksum = 0;
+  read_binary_block(fid, &header, 1, filename, checksum);
+  if (memcmp(header.magic, MODEL_BINARY_MAGIC, sizeof(header.magic)) != 0) {
+    PRINT_INPUT_ERROR("model.bin is not a binary model file.");
+  }
+  if (header.version != MODEL_BINARY_VERSION) {
+    PRINT_INPUT_ERROR("model.bin is written by another version of GPUMD; please convert it again.");
+  }
+  if (header.number_of_atoms < 2) {
+    PRINT_INPUT_ERROR("Number of atoms should >= 2.");
+  }
+  if (!is_symbol_hashable(atom_symbols)) {
+    PRINT_INPUT_ERROR("model.bin only supports potentials with chemical symbols as atom types.");
+  }
+
+  const int N = header.number_of_atoms;
+  atom.number_of_atoms = N;
+  printf("Number of atoms is %d.\n", N);
+  if (header.step > 0) {
+    printf("The model was saved at step %lld (time = %g ps).\n", header.step, header.time / 1000);
+  }
+  initialize_box(header.pbc, header.lattice, header.triclinic == 1, box);
+  has_velocity_in_xyz = header.has_velocity;
+  group.resize(header.num_groups);
+  report_properties(has_velocity_in_xyz, header.num_groups);
+
+  checksum = CHECKSUM_OFFSET;
+  std::vector<char> symbol(N * 2);
+  read_binary_block(fid, symbol.data(), symbol.size(), filename, checksum);
+  std::vector<short> species_hash(N);
+#pragma omp parallel for
+  for (int n = 0; n < N; ++n) {
+    species_hash[n] = get_symbol_hash(&symbol[n * 2], (symbol[n * 2 + 1] == '\0') ? 1 : 2);
+  }
+  std::vector<char>().swap(symbol);
+
+  atom.cpu_atom_symbol.resize(N);
+  atom.cpu_type.resize(N);
+  atom.cpu_mass.resize(N);
+  atom.cpu_position_per_atom.resize(N * 3);
+  atom.cpu_velocity_per_atom.resize(N * 3);
+  number_of_types = atom_symbols.size();
+
+  read_binary_block(fid, atom.cpu_position_per_atom.data(), N * 3, filename, checksum);
+  if (header.has_mass) {
+    read_binary_block(fid, atom.cpu_mass.data(), N, filename, checksum);
+    if (*std::min_element(atom.cpu_mass.begin(), atom.cpu_mass.end()) <= 0) {
+      PRINT_INPUT_ERROR("Atom mass should > 0.");
+    }
+  }
+  if (header.has_velocity) {
+    read_binary_block(fid, atom.cpu_velocity_per_atom.data(), N * 3, filename, checksum);
+    const double A_per_fs_to_natural = TIME_UNIT_CONVERSION;
+#pragma omp parallel for
+    for (int n = 0; n < N * 3; ++n) {
+      atom.cpu_velocity_per_atom[n] *= A_per_fs_to_natural;
+    }
+  }
+  for (int m = 0; m < group.size(); ++m) {
+    group[m].cpu_label.resize(N);
+    read_binary_block(fid, group[m].cpu_label.data(), N, filename, checksum);
+    auto label_range = std::minmax_element(group[m].cpu_label.begin(), group[m].cpu_label.end());
+    if (*label_range.first < 0 || *label_range.second >= N) {
+      PRINT_INPUT_ERROR("Group label should >= 0 and < N.");
+    }
+    group[m].number = *label_range.second + 1;
+  }
+  fclose(fid);
+  if (checksum != header.checksum) {
+    PRINT_INPUT_ERROR("Checksum of model.bin does not match; the file is corrupt.");
+  }
+
+  find_type_from_hash(
+    N,
+    species_hash.data(),
+    header.has_mass,
+    atom_symbols,
+    atom.cpu_atom_symbol,
+    atom.cpu_type,
+    atom.cpu_mass);
+}
+
+void convert_xyz_to_binary(const char* filename_xyz, const char* filename_binary)
+{
+  std::ifstream input(filename_xyz);
+  if (!input.is_open()) {
+    printf("Failed to open %s.\n", filename_xyz);
+    exit(1);
+  }
+
+  Model_Binary_Header header;
+  read_xyz_line_1(input, header.number_of_atoms);
+  int property_offset[5] = {0, 0, 0, 0, 0}; // species,pos,mass,vel,group
+  int num_columns = 0;
+  bool has_mass = true;
+  read_xyz_line_2(
+    input,
+    header.pbc,
+    header.lattice,
+    header.has_velocity,
+    has_mass,
+    num_columns,
+    property_offset,
+    header.num_groups);
+  header.has_mass = has_mass ? 1 : 0;
+  const size_t offset = input.tellg();
+  input.close();
+
+  const int N = header.number_of_atoms;
+  std::vector<short> species_hash(N);
+  std::vector<double> position(N * 3);
+  std::vector<double> mass(has_mass ? N : 0);
+  std::vector<double> velocity(header.has_velocity ? N * 3 : 0);
+  std::vector<int> group_label(size_t(N) * header.num_groups);
+
+  Xyz_Atom_Columns columns;
+  columns.num_columns = num_columns;
+  for (int k = 0; k < 5; ++k) {
+    columns.property_offset[k] = property_offset[k];
+  }
+  columns.species_hash = species_hash.data();
+  columns.mass = has_mass ? mass.data() : nullptr;
+  columns.position = position.data();
+  columns.velocity = header.has_velocity ? velocity.data() : nullptr;
+  for (int m = 0; m < header.num_groups; ++m) {
+    columns.group_label.push_back(group_label.data() + size_t(N) * m);
+  }
+  std::vector<int> group_number;
+  read_xyz_atoms_in_parallel(filename_xyz, offset, N, columns, group_number);
+
+  std::vector<char> symbol(N * 2);
+#pragma omp parallel for
+  for (int n = 0; n < N; ++n) {
+    symbol[n * 2 + 0] = 'A' + species_hash[n] / 27;
+    symbol[n * 2 + 1] = (species_hash[n] % 27 == 0) ? '\0' : 'a' + species_hash[n] % 27 - 1;
+  }
+
+  write_model_binary_file(filename_binary, header, symbol, position, mass, velocity, group_label);
+  printf("Converted %s into %s.\n", filename_xyz, filename_binary);
+}
+
+void write_model_binary(
+  const char* filename,
+  const long long step,
+  const double time,
+  const Box& box,
+  const std::vector<Group>& group,
+  const std::vector<std::string>& cpu_atom_symbol,
+  const std::vector<double>& cpu_mass,
+  const std::vector<double>& cpu_position_per_atom,
+  const std::vector<double>& cpu_velocity_per_atom)
+{
+  const int N = cpu_mass.size();
+  Model_Binary_Header header;
+  header.number_of_atoms = N;
+  header.pbc[0] = box.pbc_x;
+  header.pbc[1] = box.pbc_y;
+  header.pbc[2] = box.pbc_z;
+  header.has_velocity = 1;
+  header.has_mass = 1;
+  header.num_groups = group.size();
+  header.triclinic = box.triclinic;
+  for (int d = 0; d < 9; ++d) {
+    if (box.triclinic == 1) {
+      header.lattice[d] = box.cpu_h[d];
+    } else {
+      header.lattice[d] = (d % 4 == 0) ? box.cpu_h[d / 4] : 0.0;
+    }
+  }
+  header.step = step;
+  header.time = time * TIME_UNIT_CONVERSION;
+
+  std::vector<char> symbol(N * 2);
+  for (int n = 0; n < N; ++n) {
+    const std::string& s = cpu_atom_symbol[n];
+    if (get_symbol_hash(s.c_str(), s.size()) < 0) {
+      PRINT_INPUT_ERROR("Binary model files only support chemical symbols as atom types.");
+    }
+    symbol[n * 2 + 0] = s[0];
+    symbol[n * 2 + 1] = (s.size() == 2) ? s[1] : '\0';
+  }
+
+  const double natural_to_A_per_fs = 1.0 / TIME_UNIT_CONVERSION;
+  std::vector<double> velocity(N * 3);
+  for (int n = 0; n < N * 3; ++n) {
+    velocity[n] = cpu_velocity_per_atom[n] * natural_to_A_per_fs;
+  }
+
+  std::vector<int> group_label(size_t(N) * group.size());
+  for (int m = 0; m < group.size(); ++m) {
+    std::copy(group[m].cpu_label.begin(), group[m].cpu_label.end(), group_label.begin() + N * m);
+  }
+
+  write_model_binary_file(
+    filename, header, symbol, cpu_position_per_atom, cpu_mass, velocity, group_label);
+}
+
 void find_type_size(
   const int N,
   const int number_of_types,
@@ -527,37 +1291,78 @@ void initialize_position(
   std::string filename("model.xyz");
   std::ifstream input(filename);
 
-  if (!input.is_open()) {
-    PRINT_INPUT_ERROR("Failed to open model.xyz.");
-  }
-
   std::vector<std::string> atom_symbols;
   auto filename_potential = get_filename_potential();
   atom_symbols = get_atom_symbols(filename_potential);
 
-  read_xyz_line_1(input, atom.number_of_atoms);
-  int property_offset[5] = {0, 0, 0, 0, 0}; // species,pos,mass,vel,group
-  int num_columns = 0;
-  bool has_mass = true;
-  read_xyz_line_2(input, box, has_velocity_in_xyz, has_mass, num_columns, property_offset, group);
-
-  read_xyz_in_line_3(
-    input,
-    atom.number_of_atoms,
-    has_velocity_in_xyz,
-    has_mass,
-    num_columns,
-    property_offset,
-    number_of_types,
-    atom_symbols,
-    atom.cpu_atom_symbol,
-    atom.cpu_type,
-    atom.cpu_mass,
-    atom.cpu_position_per_atom,
-    atom.cpu_velocity_per_atom,
-    group);
+  if (!input.is_open()) {
+    std::ifstream input_binary("model.bin");
+    if (!input_binary.is_open()) {
+      PRINT_INPUT_ERROR("Failed to open model.xyz or model.bin.");
+    }
+    input_binary.close();
+    printf("Read the model from model.bin.\n");
+    read_model_binary(
+      "model.bin", has_velocity_in_xyz, number_of_types, atom_symbols, box, group, atom);
+  } else {
+    read_xyz_line_1(input, atom.number_of_atoms);
+    int property_offset[5] = {0, 0, 0, 0, 0}; // species,pos,mass,vel,group
+    int num_columns = 0;
+    bool has_mass = true;
+    int pbc[3] = {1, 1, 1};
+    double lattice[9];
+    int num_groups = 0;
+    read_xyz_line_2(
+      input,
+      pbc,
+      lattice,
+      has_velocity_in_xyz,
+      has_mass,
+      num_columns,
+      property_offset,
+      num_groups);
+    initialize_box(pbc, lattice, false, box);
+    report_properties(has_velocity_in_xyz, num_groups);
+    group.resize(num_groups);
 
-  input.close();
+    if (is_symbol_hashable(atom_symbols)) {
+      const size_t offset = input.tellg();
+      input.close();
+      read_xyz_in_parallel(
+        filename.c_str(),
+        offset,
+        atom.number_of_atoms,
+        has_velocity_in_xyz,
+        has_mass,
+        num_columns,
+        property_offset,
+        number_of_types,
+        atom_symbols,
+        atom.cpu_atom_symbol,
+        atom.cpu_type,
+        atom.cpu_mass,
+        atom.cpu_position_per_atom,
+        atom.cpu_velocity_per_atom,
+        group);
+    } else {
+      read_xyz_in_line_3(
+        input,
+        atom.number_of_atoms,
+        has_velocity_in_xyz,
+        has_mass,
+        num_columns,
+        property_offset,
+        number_of_types,
+        atom_symbols,
+        atom.cpu_atom_symbol,
+        atom.cpu_type,
+        atom.cpu_mass,
+        atom.cpu_position_per_atom,
+        atom.cpu_velocity_per_atom,
+        group);
+      input.close();
+    }
+  }
 
   for (int m = 0; m < group.size(); ++m) {
     group[m].find_size(atom.number_of_atoms, m);
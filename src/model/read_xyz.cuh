@@ -20,9 +20,25 @@ class Neighbor;
 class Group;
 class Atom;
 #include "utilities/gpu_vector.cuh"
+#include <string>
 #include <vector>
 
 void initialize_position(
   int& has_velocity_in_xyz, int& number_of_types, Box& box, std::vector<Group>& group, Atom& atom);
 
+// read the extended XYZ file in parallel and write it in the binary format of model.bin
+void convert_xyz_to_binary(const char* filename_xyz, const char* filename_binary);
+
+// write the model in the format of model.bin (velocities in natural units), used for restart files
+void write_model_binary(
+  const char* filename,
+  const long long step,
+  const double time,
+  const Box& box,
+  const std::vector<Group>& group,
+  const std::vector<std::string>& cpu_atom_symbol,
+  const std::vector<double>& cpu_mass,
+  const std::vector<double>& cpu_position_per_atom,
+  const std::vector<double>& cpu_velocity_per_atom);
+
 void allocate_memory_gpu(std::vector<Group>& group, Atom& atom, GPU_Vector<double>& thermo);
@@ -16,6 +16,11 @@
 /*----------------------------------------------------------------------------80
 Use finite difference to calculate the hessian (force constants).
     H_ij^ab = [F_i^a(-) - F_i^a(+)] / [u_j^b(+) - u_j^b(-)]
+Each atom j within the cutoff of a basis atom is displaced once per direction
+and sign, which gives H_ij for all the basis atoms i at once.
+Only the non-zero 3x3 blocks H_ij are stored, together with the vector r_ij
+determining their phase factors, and the dynamical matrices are assembled for
+batches of k-points in parallel on the host.
 Then calculate the dynamical matrices with different k points.
 ------------------------------------------------------------------------------*/
 
@@ -25,7 +30,10 @@ Then calculate the dynamical matrices with different k points.
 #include "utilities/common.cuh"
 #include "utilities/cusolver_wrapper.cuh"
 #include "utilities/error.cuh"
+#include "utilities/lapack_wrapper.cuh"
 #include "utilities/read_file.cuh"
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 void Hessian::compute(
@@ -53,10 +61,10 @@ void Hessian::compute(
 
   if (num_kpoints == 1) // currently for Alex's GKMA calculations
   {
-    find_D(box, cpu_position_per_atom);
+    find_D();
     find_eigenvectors();
   } else {
-    find_dispersion(box, cpu_position_per_atom);
+    find_dispersion();
   }
 }
 
@@ -100,31 +108,25 @@ void Hessian::initialize(size_t N)
 {
   read_basis(N);
   read_kpoints();
-  size_t num_H = num_basis * N * 9;
-  size_t num_D = num_basis * num_basis * 9 * num_kpoints;
-  H.resize(num_H, 0.0);
-  DR.resize(num_D, 0.0);
-  if (num_kpoints > 1) // for dispersion calculation
-  {
-    DI.resize(num_D, 0.0);
-  }
 }
 
-bool Hessian::is_too_far(
+// memory for the dynamical matrices of a batch of k-points
+const size_t MAX_BYTES_PER_BATCH = size_t(1) << 28;
+
+static void find_r12(
   const Box& box,
   const std::vector<double>& cpu_position_per_atom,
   const size_t n1,
-  const size_t n2)
+  const size_t n2,
+  double* r12)
 {
   const int number_of_atoms = cpu_position_per_atom.size() / 3;
-  double x12 = cpu_position_per_atom[n2] - cpu_position_per_atom[n1];
-  double y12 =
+  r12[0] = cpu_position_per_atom[n2] - cpu_position_per_atom[n1];
+  r12[1] =
     cpu_position_per_atom[n2 + number_of_atoms] - cpu_position_per_atom[n1 + number_of_atoms];
-  double z12 = cpu_position_per_atom[n2 + number_of_atoms * 2] -
-               cpu_position_per_atom[n1 + number_of_atoms * 2];
-  apply_mic(box, x12, y12, z12);
-  double d12_square = x12 * x12 + y12 * y12 + z12 * z12;
-  return (d12_square > (cutoff * cutoff));
+  r12[2] = cpu_position_per_atom[n2 + number_of_atoms * 2] -
+           cpu_position_per_atom[n1 + number_of_atoms * 2];
+  apply_mic(box, r12[0], r12[1], r12[2]);
 }
 
 void Hessian::find_H(
@@ -139,93 +141,197 @@ void Hessian::find_H(
   GPU_Vector<double>& virial_per_atom)
 {
   const int number_of_atoms = type.size();
+  const size_t no_block = num_basis * number_of_atoms;
 
+  // block[nb * N + n2] is the index of H12 of the basis atom nb and the atom n2 within the cutoff
+  std::vector<size_t> block(num_basis * number_of_atoms, no_block);
+  std::vector<char> is_needed(number_of_atoms, 0);
+  H_offset.resize(num_basis + 1);
+  H_label.clear();
+  H_r12.clear();
   for (size_t nb = 0; nb < num_basis; ++nb) {
     size_t n1 = basis[nb];
+    H_offset[nb] = H_label.size();
     for (size_t n2 = 0; n2 < number_of_atoms; ++n2) {
-      if (is_too_far(box, cpu_position_per_atom, n1, n2)) {
+      double r12[3];
+      find_r12(box, cpu_position_per_atom, n1, n2, r12);
+      if (r12[0] * r12[0] + r12[1] * r12[1] + r12[2] * r12[2] > cutoff * cutoff) {
         continue;
       }
-      size_t offset = (nb * number_of_atoms + n2) * 9;
-      find_H12(
-        displacement,
-        n1,
-        n2,
-        box,
-        position_per_atom,
-        type,
-        group,
-        potential_per_atom,
-        force_per_atom,
-        virial_per_atom,
-        force,
-        H.data() + offset);
+      block[nb * number_of_atoms + n2] = H_label.size();
+      H_label.emplace_back(label[n2]);
+      H_r12.insert(H_r12.end(), r12, r12 + 3);
+      // with the sum rule, the diagonal blocks need no displacement
+      if (!(sum_rule && n1 == n2)) {
+        is_needed[n2] = 1;
+      }
     }
   }
+  H_offset[num_basis] = H_label.size();
+  H.assign(H_label.size() * 9, 0.0);
+
+  std::vector<size_t> displaced_atoms;
+  for (size_t n2 = 0; n2 < number_of_atoms; ++n2) {
+    if (is_needed[n2]) {
+      displaced_atoms.emplace_back(n2);
+    }
+  }
+  printf(
+    "Number of displaced atoms = %zu, number of force evaluations = %zu.\n",
+    displaced_atoms.size(),
+    displaced_atoms.size() * 6);
+
+  std::vector<int> cpu_rows(basis.begin(), basis.end());
+  GPU_Vector<int> rows(num_basis);
+  rows.copy_from_host(cpu_rows.data());
+  std::vector<double> H_column(num_basis * 9);
+  for (size_t n2 : displaced_atoms) {
+    find_H_column(
+      displacement,
+      n2,
+      rows,
+      box,
+      position_per_atom,
+      type,
+      group,
+      potential_per_atom,
+      force_per_atom,
+      virial_per_atom,
+      force,
+      H_column.data());
+    for (size_t nb = 0; nb < num_basis; ++nb) {
+      size_t b = block[nb * number_of_atoms + n2];
+      if (b != no_block) {
+        for (size_t ab = 0; ab < 9; ++ab) {
+          H[b * 9 + ab] = H_column[nb * 9 + ab];
+        }
+      }
+    }
+  }
+
+  // translational invariance: H_ii^ab = - sum_{j != i} H_ij^ab
+  if (sum_rule) {
+    for (size_t nb = 0; nb < num_basis; ++nb) {
+      size_t b11 = block[nb * number_of_atoms + basis[nb]];
+      double* H11 = H.data() + b11 * 9;
+      for (size_t ab = 0; ab < 9; ++ab) {
+        H11[ab] = 0.0;
+      }
+      for (size_t b = H_offset[nb]; b < H_offset[nb + 1]; ++b) {
+        if (b != b11) {
+          for (size_t ab = 0; ab < 9; ++ab) {
+            H11[ab] -= H[b * 9 + ab];
+          }
+        }
+      }
+    }
+  }
+
+  // only keep the non-zero blocks
+  size_t num_blocks = 0;
+  for (size_t nb = 0; nb < num_basis; ++nb) {
+    size_t first_block = H_offset[nb];
+    H_offset[nb] = num_blocks;
+    for (size_t b = first_block; b < H_offset[nb + 1]; ++b) {
+      bool is_zero = true;
+      for (size_t ab = 0; ab < 9; ++ab) {
+        is_zero = is_zero && (H[b * 9 + ab] == 0.0);
+      }
+      if (is_zero) {
+        continue;
+      }
+      H_label[num_blocks] = H_label[b];
+      for (size_t d = 0; d < 3; ++d) {
+        H_r12[num_blocks * 3 + d] = H_r12[b * 3 + d];
+      }
+      for (size_t ab = 0; ab < 9; ++ab) {
+        H[num_blocks * 9 + ab] = H[b * 9 + ab];
+      }
+      ++num_blocks;
+    }
+  }
+  H_offset[num_basis] = num_blocks;
+  H_label.resize(num_blocks);
+  H_r12.resize(num_blocks * 3);
+  H.resize(num_blocks * 9);
+  printf("Number of non-zero force constant blocks = %zu.\n", num_blocks);
 }
 
-static void find_exp_ikr(
-  const size_t n1,
-  const size_t n2,
-  const double* k,
-  const Box& box,
-  const std::vector<double>& cpu_position_per_atom,
-  double& cos_kr,
-  double& sin_kr)
+void Hessian::find_D_batch(
+  const size_t first_kpoint, const size_t batch_size, double* D_real, double* D_imag)
 {
-  const int number_of_atoms = cpu_position_per_atom.size() / 3;
-  double x12 = cpu_position_per_atom[n2] - cpu_position_per_atom[n1];
-  double y12 =
-    cpu_position_per_atom[n2 + number_of_atoms] - cpu_position_per_atom[n1 + number_of_atoms];
-  double z12 = cpu_position_per_atom[n2 + number_of_atoms * 2] -
-               cpu_position_per_atom[n1 + number_of_atoms * 2];
-  apply_mic(box, x12, y12, z12);
-  double kr = k[0] * x12 + k[1] * y12 + k[2] * z12;
-  cos_kr = cos(kr);
-  sin_kr = sin(kr);
+  const size_t dim = num_basis * 3;
+#pragma omp parallel for schedule(dynamic)
+  for (int nk = 0; nk < int(batch_size); ++nk) {
+    const double* k = kpoints.data() + (first_kpoint + nk) * 3;
+    double* DR_k = D_real + nk * dim * dim;
+    double* DI_k = D_imag + nk * dim * dim;
+    std::fill(DR_k, DR_k + dim * dim, 0.0);
+    std::fill(DI_k, DI_k + dim * dim, 0.0);
+    for (size_t nb = 0; nb < num_basis; ++nb) {
+      size_t label_1 = label[basis[nb]];
+      double mass_1 = mass[label_1];
+      for (size_t b = H_offset[nb]; b < H_offset[nb + 1]; ++b) {
+        const double* r12 = H_r12.data() + b * 3;
+        double kr = k[0] * r12[0] + k[1] * r12[1] + k[2] * r12[2];
+        size_t label_2 = H_label[b];
+        double mass_factor = 1.0 / sqrt(mass_1 * mass[label_2]);
+        double cos_kr = cos(kr) * mass_factor;
+        double sin_kr = sin(kr) * mass_factor;
+        const double* H12 = H.data() + b * 9;
+        for (size_t a = 0; a < 3; ++a) {
+          for (size_t c = 0; c < 3; ++c) {
+            size_t row = label_1 * 3 + a;
+            size_t col = label_2 * 3 + c;
+            // cuSOLVER requires column-major
+            size_t index = col * dim + row;
+            DR_k[index] += H12[a * 3 + c] * cos_kr;
+            DI_k[index] += H12[a * 3 + c] * sin_kr;
+          }
+        }
+      }
+    }
+  }
 }
 
-void Hessian::output_D()
+void Hessian::output_D(
+  FILE* fid, const size_t batch_size, const double* D_real, const double* D_imag)
 {
-  FILE* fid = fopen("D.out", "w");
-  for (size_t nk = 0; nk < num_kpoints; ++nk) {
-    size_t offset = nk * num_basis * num_basis * 9;
-    for (size_t n1 = 0; n1 < num_basis * 3; ++n1) {
-      for (size_t n2 = 0; n2 < num_basis * 3; ++n2) {
+  const size_t dim = num_basis * 3;
+  for (size_t nk = 0; nk < batch_size; ++nk) {
+    size_t offset = nk * dim * dim;
+    for (size_t n1 = 0; n1 < dim; ++n1) {
+      for (size_t n2 = 0; n2 < dim; ++n2) {
         // cuSOLVER requires column-major
-        fprintf(fid, "%g ", DR[offset + n1 + n2 * num_basis * 3]);
+        fprintf(fid, "%g ", D_real[offset + n1 + n2 * dim]);
       }
-      if (num_kpoints > 1) {
-        for (size_t n2 = 0; n2 < num_basis * 3; ++n2) {
-          // cuSOLVER requires column-major
-          fprintf(fid, "%g ", DI[offset + n1 + n2 * num_basis * 3]);
-        }
+      for (size_t n2 = 0; n2 < dim; ++n2) {
+        // cuSOLVER requires column-major
+        fprintf(fid, "%g ", D_imag[offset + n1 + n2 * dim]);
       }
       fprintf(fid, "\n");
     }
   }
-  fclose(fid);
 }
 
-void Hessian::find_omega(FILE* fid, size_t offset)
+void Hessian::find_omega_batch(
+  FILE* fid, const size_t batch_size, double* D_real, double* D_imag)
 {
-  size_t dim = num_basis * 3;
-  std::vector<double> W(dim);
-  eig_hermitian_QR(dim, DR.data() + offset, DI.data() + offset, W.data());
-  double natural_to_THz = 1.0e6 / (TIME_UNIT_CONVERSION * TIME_UNIT_CONVERSION);
-  for (size_t n = 0; n < dim; ++n) {
-    fprintf(fid, "%g ", W[n] * natural_to_THz);
+  const size_t dim = num_basis * 3;
+  std::vector<double> W(dim * batch_size);
+#ifdef USE_LAPACK
+  eig_hermitian_batch_lapack(dim, batch_size, D_real, D_imag, W.data());
+#else
+  if (num_basis > 10) { // > 32x32
+    for (size_t nk = 0; nk < batch_size; ++nk) {
+      eig_hermitian_QR(dim, D_real + nk * dim * dim, D_imag + nk * dim * dim, W.data() + nk * dim);
+    }
+  } else {
+    eig_hermitian_Jacobi_batch(dim, batch_size, D_real, D_imag, W.data());
   }
-  fprintf(fid, "\n");
-}
-
-void Hessian::find_omega_batch(FILE* fid)
-{
-  size_t dim = num_basis * 3;
-  std::vector<double> W(dim * num_kpoints);
-  eig_hermitian_Jacobi_batch(dim, num_kpoints, DR.data(), DI.data(), W.data());
+#endif
   double natural_to_THz = 1.0e6 / (TIME_UNIT_CONVERSION * TIME_UNIT_CONVERSION);
-  for (size_t nk = 0; nk < num_kpoints; ++nk) {
+  for (size_t nk = 0; nk < batch_size; ++nk) {
     size_t offset = nk * dim;
     for (size_t n = 0; n < dim; ++n) {
       fprintf(fid, "%g ", W[offset + n] * natural_to_THz);
@@ -234,76 +340,47 @@ void Hessian::find_omega_batch(FILE* fid)
   }
 }
 
-void Hessian::find_dispersion(const Box& box, const std::vector<double>& cpu_position_per_atom)
+void Hessian::find_dispersion()
 {
-  const int number_of_atoms = cpu_position_per_atom.size() / 3;
+  // the dynamical matrices are assembled and diagonalized in batches of k-points
+  const size_t dim = num_basis * 3;
+  const size_t max_batch_size =
+    std::max(size_t(1), MAX_BYTES_PER_BATCH / (dim * dim * 2 * sizeof(double)));
 
   FILE* fid_omega2 = fopen("omega2.out", "w");
-  for (size_t nk = 0; nk < num_kpoints; ++nk) {
-    size_t offset = nk * num_basis * num_basis * 9;
-    for (size_t nb = 0; nb < num_basis; ++nb) {
-      size_t n1 = basis[nb];
-      size_t label_1 = label[n1];
-      double mass_1 = mass[label_1];
-      for (size_t n2 = 0; n2 < number_of_atoms; ++n2) {
-        if (is_too_far(box, cpu_position_per_atom, n1, n2))
-          continue;
-        double cos_kr, sin_kr;
-        find_exp_ikr(n1, n2, kpoints.data() + nk * 3, box, cpu_position_per_atom, cos_kr, sin_kr);
-
-        size_t label_2 = label[n2];
-        double mass_2 = mass[label_2];
-        double mass_factor = 1.0 / sqrt(mass_1 * mass_2);
-        double* H12 = H.data() + (nb * number_of_atoms + n2) * 9;
-        for (size_t a = 0; a < 3; ++a) {
-          for (size_t b = 0; b < 3; ++b) {
-            size_t a3b = a * 3 + b;
-            size_t row = label_1 * 3 + a;
-            size_t col = label_2 * 3 + b;
-            // cuSOLVER requires column-major
-            size_t index = offset + col * num_basis * 3 + row;
-            DR[index] += H12[a3b] * cos_kr * mass_factor;
-            DI[index] += H12[a3b] * sin_kr * mass_factor;
-          }
-        }
-      }
-    }
-    if (num_basis > 10) {
-      find_omega(fid_omega2, offset);
-    } // > 32x32
+  FILE* fid_D = fopen("D.out", "w");
+  std::vector<double> DR_batch;
+  std::vector<double> DI_batch;
+  for (size_t first_kpoint = 0; first_kpoint < num_kpoints; first_kpoint += max_batch_size) {
+    size_t batch_size = std::min(max_batch_size, num_kpoints - first_kpoint);
+    DR_batch.resize(batch_size * dim * dim);
+    DI_batch.resize(batch_size * dim * dim);
+    find_D_batch(first_kpoint, batch_size, DR_batch.data(), DI_batch.data());
+    output_D(fid_D, batch_size, DR_batch.data(), DI_batch.data());
+    find_omega_batch(fid_omega2, batch_size, DR_batch.data(), DI_batch.data());
   }
-  output_D();
-  if (num_basis <= 10) {
-    find_omega_batch(fid_omega2);
-  } // <= 32x32
+  fclose(fid_D);
   fclose(fid_omega2);
 }
 
-void Hessian::find_D(const Box& box, std::vector<double>& cpu_position_per_atom)
+void Hessian::find_D()
 {
-  const int number_of_atoms = cpu_position_per_atom.size() / 3;
-
+  const size_t dim = num_basis * 3;
+  DR.assign(dim * dim, 0.0);
   for (size_t nb = 0; nb < num_basis; ++nb) {
-    size_t n1 = basis[nb];
-    size_t label_1 = label[n1];
+    size_t label_1 = label[basis[nb]];
     double mass_1 = mass[label_1];
-    for (size_t n2 = 0; n2 < number_of_atoms; ++n2) {
-      if (is_too_far(box, cpu_position_per_atom, n1, n2)) {
-        continue;
-      }
-
-      size_t label_2 = label[n2];
-      double mass_2 = mass[label_2];
-      double mass_factor = 1.0 / sqrt(mass_1 * mass_2);
-      double* H12 = H.data() + (nb * number_of_atoms + n2) * 9;
+    for (size_t b = H_offset[nb]; b < H_offset[nb + 1]; ++b) {
+      size_t label_2 = H_label[b];
+      double mass_factor = 1.0 / sqrt(mass_1 * mass[label_2]);
+      const double* H12 = H.data() + b * 9;
       for (size_t a = 0; a < 3; ++a) {
-        for (size_t b = 0; b < 3; ++b) {
-          size_t a3b = a * 3 + b;
+        for (size_t c = 0; c < 3; ++c) {
           size_t row = label_1 * 3 + a;
-          size_t col = label_2 * 3 + b;
+          size_t col = label_2 * 3 + c;
           // cuSOLVER requires column-major
-          size_t index = col * num_basis * 3 + row;
-          DR[index] += H12[a3b] * mass_factor;
+          size_t index = col * dim + row;
+          DR[index] += H12[a * 3 + c] * mass_factor;
         }
       }
     }
@@ -346,8 +423,8 @@ void Hessian::find_eigenvectors()
 
 void Hessian::parse(const char** param, size_t num_param)
 {
-  if (num_param != 3) {
-    PRINT_INPUT_ERROR("compute_phonon should have 2 parameters.\n");
+  if (num_param != 3 && num_param != 4) {
+    PRINT_INPUT_ERROR("compute_phonon should have 2 or 3 parameters.\n");
   }
   // cutoff
   if (!is_valid_real(param[1], &cutoff)) {
@@ -366,4 +443,13 @@ void Hessian::parse(const char** param, size_t num_param)
     PRINT_INPUT_ERROR("displacement for compute_phonon should be positive.\n");
   }
   printf("displacement for compute_phonon = %g A.\n", displacement);
+
+  // sum rule (optional)
+  if (num_param == 4) {
+    if (strcmp(param[3], "sum_rule") != 0) {
+      PRINT_INPUT_ERROR("The optional parameter of compute_phonon can only be sum_rule.\n");
+    }
+    sum_rule = true;
+    printf("Use the translational sum rule for the diagonal force constants.\n");
+  }
 }
@@ -29,6 +29,7 @@ class Hessian
 public:
   double displacement = 0.005;
   double cutoff = 4.0;
+  bool sum_rule = false; // H_ii = - sum_{j != i} H_ij instead of displacing the basis atoms
 
   void compute(
     Force& force,
@@ -51,9 +52,11 @@ protected:
   std::vector<size_t> label;
   std::vector<double> mass;
   std::vector<double> kpoints;
-  std::vector<double> H;
-  std::vector<double> DR;
-  std::vector<double> DI;
+  std::vector<size_t> H_offset; // blocks of basis atom nb are in [H_offset[nb], H_offset[nb + 1])
+  std::vector<size_t> H_label;  // basis label of the second atom of each block
+  std::vector<double> H_r12;    // vector from the basis atom to the second atom of each block
+  std::vector<double> H;        // non-zero 3x3 blocks of force constants
+  std::vector<double> DR;       // real dynamical matrix for a single k-point
 
   void read_basis(size_t N);
   void read_kpoints();
@@ -71,18 +74,11 @@ protected:
     GPU_Vector<double>& force_per_atom,
     GPU_Vector<double>& virial_per_atom);
 
-  bool is_too_far(
-    const Box& box,
-    const std::vector<double>& cpu_position_per_atom,
-    const size_t n1,
-    const size_t n2);
-
-  void find_dispersion(const Box& box, const std::vector<double>& cpu_position_per_atom);
-
-  void find_D(const Box& box, std::vector<double>& cpu_position_per_atom);
-
+  void find_D_batch(
+    const size_t first_kpoint, const size_t batch_size, double* D_real, double* D_imag);
+  void find_dispersion();
+  void find_D();
+  void output_D(FILE* fid, const size_t batch_size, const double* D_real, const double* D_imag);
+  void find_omega_batch(FILE* fid, const size_t batch_size, double* D_real, double* D_imag);
   void find_eigenvectors();
-  void output_D();
-  void find_omega(FILE*, size_t);
-  void find_omega_batch(FILE*);
 };
@@ -0,0 +1,128 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+A background writer with a pair of host buffers for the dump classes.
+------------------------------------------------------------------------------*/
+
+#include "async_writer.cuh"
+#include <chrono>
+#include <stdio.h>
+
+static double get_wall_time()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+Async_Writer::~Async_Writer() { finish(); }
+
+void Async_Writer::start(const char* name, const bool is_async)
+{
+  finish();
+  name_ = name;
+  is_async_ = is_async;
+  is_running_ = true;
+  stop_requested_ = false;
+  free_buffers_.clear();
+  for (int k = 0; k < NUM_BUFFERS; ++k) {
+    free_buffers_.push_back(k);
+  }
+  num_snapshots_ = 0;
+  num_waits_ = 0;
+  stall_time_ = 0.0;
+  if (is_async_) {
+    thread_ = std::thread(&Async_Writer::run_writer, this);
+  }
+}
+
+std::vector<double>& Async_Writer::acquire()
+{
+  acquire_time_ = get_wall_time();
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (free_buffers_.empty()) {
+    ++num_waits_;
+    condition_.wait(lock, [this] { return !free_buffers_.empty(); });
+  }
+  current_buffer_ = free_buffers_.front();
+  free_buffers_.pop_front();
+  return buffer_[current_buffer_];
+}
+
+void Async_Writer::submit(Task task)
+{
+  ++num_snapshots_;
+  if (is_async_) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_tasks_.emplace_back(current_buffer_, std::move(task));
+    }
+    condition_.notify_all();
+  } else {
+    task(buffer_[current_buffer_]);
+    free_buffers_.push_back(current_buffer_);
+  }
+  current_buffer_ = -1;
+  stall_time_ += get_wall_time() - acquire_time_;
+}
+
+void Async_Writer::run_writer()
+{
+  while (true) {
+    std::pair<int, Task> pending_task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return stop_requested_ || !pending_tasks_.empty(); });
+      if (pending_tasks_.empty()) {
+        return; // stop requested and nothing left to write
+      }
+      pending_task = std::move(pending_tasks_.front());
+      pending_tasks_.pop_front();
+    }
+    pending_task.second(buffer_[pending_task.first]);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_buffers_.push_back(pending_task.first);
+    }
+    condition_.notify_all();
+  }
+}
+
+void Async_Writer::finish()
+{
+  if (!is_running_) {
+    return;
+  }
+  if (is_async_) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_requested_ = true;
+    }
+    condition_.notify_all();
+    thread_.join();
+  }
+  is_running_ = false;
+  if (num_snapshots_ > 0) {
+    printf(
+      "%s: %d snapshots written %s, step loop stalled for %g s in total (%g ms per snapshot, "
+      "waited for the writer %d times).\n",
+      name_.c_str(),
+      num_snapshots_,
+      is_async_ ? "asynchronously" : "synchronously",
+      stall_time_,
+      stall_time_ * 1000.0 / num_snapshots_,
+      num_waits_);
+  }
+}
@@ -0,0 +1,73 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+A background writer with a pair of host buffers for the dump classes: the step
+loop fills a free buffer with a snapshot and submits a task which formats and
+writes it, and the task is executed by the writer thread while the following
+steps are being computed. When both buffers are in use, acquire() waits for the
+writer (back-pressure). The time the step loop spends from acquire() to the
+return of submit() is reported as the stall time.
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class Async_Writer
+{
+public:
+  using Task = std::function<void(const std::vector<double>& buffer)>;
+
+  ~Async_Writer();
+
+  // start a run; with is_async = false the tasks are executed in submit()
+  void start(const char* name, const bool is_async);
+
+  // wait for a free buffer and return it
+  std::vector<double>& acquire();
+
+  // hand over the buffer returned by the last acquire()
+  void submit(Task task);
+
+  // wait for all the tasks, stop the writer thread and report the stall time
+  void finish();
+
+private:
+  static const int NUM_BUFFERS = 2;
+  std::string name_;
+  bool is_async_ = true;
+  bool is_running_ = false;
+  bool stop_requested_ = false;
+  std::vector<double> buffer_[NUM_BUFFERS];
+  std::deque<int> free_buffers_;
+  std::deque<std::pair<int, Task>> pending_tasks_;
+  int current_buffer_ = -1;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::thread thread_;
+
+  int num_snapshots_ = 0;     // number of submitted snapshots
+  int num_waits_ = 0;         // number of times acquire() had to wait for the writer
+  double stall_time_ = 0.0;   // total time spent between acquire() and submit()
+  double acquire_time_ = 0.0; // wall time at the last acquire()
+
+  void run_writer();
+};
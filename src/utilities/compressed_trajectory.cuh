@@ -0,0 +1,316 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Codec of the compressed trajectory file (dump.ctraj) written by dump_compressed
+and read by tools/ctraj2exyz. It is header-only and uses plain C++ only, such
+that the reader can be compiled without the rest of GPUMD.
+
+Each frame is a Ctraj_Frame_Header followed by payload_size bytes:
+    key frame:   species table, atom types, positions, velocities (optional)
+    delta frame: positions, velocities (optional)
+The species table is number_of_types symbols, each stored as one byte for the
+length followed by the characters. All the other data are integers packed by
+pack_integers(): positions are quantized to multiples of precision_position
+and coded as differences to the previous atom (key frames) or to the same atom
+in the previous frame (delta frames); velocities are quantized to multiples of
+precision_velocity (in units of A/fs) without differences. The x components of
+all atoms come first, then the y and the z components.
+
+The packing is zigzag coding followed by fixed-width bit-packing per block of
+CTRAJ_BLOCK_SIZE integers. There is no entropy coding: the size of a block only
+depends on its largest magnitude, which the differences keep small. The files
+can be compressed further by a general-purpose compressor.
+
+The index file (dump.ctraj.idx) contains one Ctraj_Index_Entry per frame, such
+that a reader can seek to the key frame preceding a given frame.
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+const char CTRAJ_MAGIC[8] = "GPUMDCT";
+const int CTRAJ_VERSION = 1;
+const int CTRAJ_BLOCK_SIZE = 128; // number of integers sharing one bit width
+
+struct Ctraj_Frame_Header {
+  char magic[8];                   // CTRAJ_MAGIC
+  int version = CTRAJ_VERSION;     // format version
+  int is_key = 1;                  // 1 for a key frame and 0 for a delta frame
+  long long step = 0;              // step number within the run
+  double time = 0.0;               // time in units of fs
+  double lattice[9] = {};          // a, b, c in the order of the Lattice property of exyz
+  int pbc[3] = {1, 1, 1};          // periodic (1) or free (0) boundaries
+  int number_of_atoms = 0;         // number of atoms in this frame
+  int number_of_types = 0;         // number of species in the species table (key frames)
+  int has_velocity = 0;            // 1 if there are velocities
+  double precision_position = 0.0; // quantization step of the positions in units of A
+  double precision_velocity = 0.0; // quantization step of the velocities in units of A/fs
+  long long payload_size = 0;      // number of bytes following this header
+
+  Ctraj_Frame_Header() { memcpy(magic, CTRAJ_MAGIC, sizeof(magic)); }
+  bool is_valid() const
+  {
+    return memcmp(magic, CTRAJ_MAGIC, sizeof(magic)) == 0 && version == CTRAJ_VERSION;
+  }
+};
+
+struct Ctraj_Index_Entry {
+  long long step = 0;   // step number within the run
+  long long offset = 0; // byte offset of the frame header in dump.ctraj
+  int is_key = 0;       // 1 for a key frame and 0 for a delta frame
+  int padding = 0;      // keep the size a multiple of 8 bytes
+};
+
+inline long long quantize(const double value, const double precision)
+{
+  return std::llround(value / precision);
+}
+
+inline unsigned long long zigzag_encode(const long long value)
+{
+  return (static_cast<unsigned long long>(value) << 1) ^
+         static_cast<unsigned long long>(value >> 63);
+}
+
+inline long long zigzag_decode(const unsigned long long value)
+{
+  return static_cast<long long>(value >> 1) ^ -static_cast<long long>(value & 1);
+}
+
+// Blocks of CTRAJ_BLOCK_SIZE integers are stored as one byte for the number of bits of the largest
+// zigzag-coded integer in the block, followed by all the integers with this number of bits.
+inline void
+pack_integers(const long long* values, const size_t count, std::vector<unsigned char>& out)
+{
+  for (size_t begin = 0; begin < count; begin += CTRAJ_BLOCK_SIZE) {
+    const size_t end = (begin + CTRAJ_BLOCK_SIZE < count) ? begin + CTRAJ_BLOCK_SIZE : count;
+    unsigned long long all_bits = 0;
+    for (size_t i = begin; i < end; ++i) {
+      all_bits |= zigzag_encode(values[i]);
+    }
+    int width = 0;
+    while (width < 64 && (all_bits >> width) != 0) {
+      ++width;
+    }
+    out.push_back(static_cast<unsigned char>(width));
+
+    unsigned long long bit_buffer = 0;
+    int num_bits = 0;
+    for (size_t i = begin; i < end; ++i) {
+      unsigned long long value = zigzag_encode(values[i]);
+      for (int remaining = width; remaining > 0;) {
+        const int n = (remaining < 32) ? remaining : 32;
+        bit_buffer |= (value & ((1ULL << n) - 1)) << num_bits;
+        num_bits += n;
+        value >>= n;
+        remaining -= n;
+        while (num_bits >= 8) {
+          out.push_back(static_cast<unsigned char>(bit_buffer & 0xff));
+          bit_buffer >>= 8;
+          num_bits -= 8;
+        }
+      }
+    }
+    if (num_bits > 0) {
+      out.push_back(static_cast<unsigned char>(bit_buffer & 0xff));
+    }
+  }
+}
+
+// inverse of pack_integers(); returns false if the data end too early or are corrupt
+inline bool unpack_integers(
+  const unsigned char*& in, const unsigned char* in_end, const size_t count, long long* values)
+{
+  for (size_t begin = 0; begin < count; begin += CTRAJ_BLOCK_SIZE) {
+    const size_t end = (begin + CTRAJ_BLOCK_SIZE < count) ? begin + CTRAJ_BLOCK_SIZE : count;
+    if (in >= in_end) {
+      return false;
+    }
+    const int width = *in++;
+    if (width > 64) {
+      return false;
+    }
+    const size_t num_bytes = ((end - begin) * width + 7) / 8;
+    if (static_cast<size_t>(in_end - in) < num_bytes) {
+      return false;
+    }
+
+    unsigned long long bit_buffer = 0;
+    int num_bits = 0;
+    for (size_t i = begin; i < end; ++i) {
+      unsigned long long value = 0;
+      for (int shift = 0; shift < width;) {
+        const int n = (width - shift < 32) ? width - shift : 32;
+        while (num_bits < n) {
+          bit_buffer |= static_cast<unsigned long long>(*in++) << num_bits;
+          num_bits += 8;
+        }
+        value |= (bit_buffer & ((1ULL << n) - 1)) << shift;
+        bit_buffer >>= n;
+        num_bits -= n;
+        shift += n;
+      }
+      values[i] = zigzag_decode(value);
+    }
+  }
+  return true;
+}
+
+inline void pack_species(const std::vector<std::string>& symbols, std::vector<unsigned char>& out)
+{
+  for (const auto& symbol : symbols) {
+    const size_t length = (symbol.size() < 255) ? symbol.size() : 255;
+    out.push_back(static_cast<unsigned char>(length));
+    out.insert(out.end(), symbol.begin(), symbol.begin() + length);
+  }
+}
+
+inline bool unpack_species(
+  const unsigned char*& in,
+  const unsigned char* in_end,
+  const int number_of_types,
+  std::vector<std::string>& symbols)
+{
+  symbols.resize(number_of_types);
+  for (int t = 0; t < number_of_types; ++t) {
+    if (in >= in_end || in_end - in < 1 + *in) {
+      return false;
+    }
+    const int length = *in++;
+    symbols[t].assign(reinterpret_cast<const char*>(in), length);
+    in += length;
+  }
+  return true;
+}
+
+// positions (3 * N, x of all atoms first) quantized into q; with a previous frame the differences
+// to it are coded, otherwise the differences to the previous atom
+inline void pack_positions(
+  const int N,
+  const long long* q,
+  const long long* q_previous,
+  std::vector<long long>& work,
+  std::vector<unsigned char>& out)
+{
+  work.resize(N * 3);
+  for (int d = 0; d < 3; ++d) {
+    for (int n = 0; n < N; ++n) {
+      const int i = n + N * d;
+      if (q_previous != nullptr) {
+        work[i] = q[i] - q_previous[i];
+      } else {
+        work[i] = (n == 0) ? q[i] : q[i] - q[i - 1];
+      }
+    }
+  }
+  pack_integers(work.data(), work.size(), out);
+}
+
+// inverse of pack_positions(); q_previous is nullptr for key frames
+inline bool unpack_positions(
+  const unsigned char*& in,
+  const unsigned char* in_end,
+  const int N,
+  const long long* q_previous,
+  long long* q)
+{
+  if (!unpack_integers(in, in_end, N * 3, q)) {
+    return false;
+  }
+  for (int d = 0; d < 3; ++d) {
+    for (int n = 0; n < N; ++n) {
+      const int i = n + N * d;
+      if (q_previous != nullptr) {
+        q[i] += q_previous[i];
+      } else if (n > 0) {
+        q[i] += q[i - 1];
+      }
+    }
+  }
+  return true;
+}
+
+// payload of a frame as described above; type and type_symbol are used for key frames,
+// q_position_previous for delta frames, and q_velocity if the header has velocities
+inline void pack_frame(
+  const Ctraj_Frame_Header& header,
+  const std::vector<std::string>& type_symbol,
+  const long long* type,
+  const long long* q_position,
+  const long long* q_position_previous,
+  const long long* q_velocity,
+  std::vector<long long>& work,
+  std::vector<unsigned char>& out)
+{
+  const int N = header.number_of_atoms;
+  out.clear();
+  if (header.is_key) {
+    pack_species(type_symbol, out);
+    pack_integers(type, N, out);
+    pack_positions(N, q_position, nullptr, work, out);
+  } else {
+    pack_positions(N, q_position, q_position_previous, work, out);
+  }
+  if (header.has_velocity) {
+    pack_integers(q_velocity, N * 3, out);
+  }
+}
+
+// inverse of pack_frame(); the species table and the types are only updated by key frames and
+// delta frames need the positions of the previous frame
+inline bool unpack_frame(
+  const Ctraj_Frame_Header& header,
+  const unsigned char* in,
+  const unsigned char* in_end,
+  std::vector<std::string>& type_symbol,
+  std::vector<long long>& type,
+  const std::vector<long long>& q_position_previous,
+  std::vector<long long>& q_position,
+  std::vector<long long>& q_velocity)
+{
+  const int N = header.number_of_atoms;
+  q_position.resize(N * 3);
+  if (header.is_key) {
+    type.resize(N);
+    if (
+      !unpack_species(in, in_end, header.number_of_types, type_symbol) ||
+      !unpack_integers(in, in_end, N, type.data()) ||
+      !unpack_positions(in, in_end, N, nullptr, q_position.data())) {
+      return false;
+    }
+    for (int n = 0; n < N; ++n) {
+      if (type[n] < 0 || type[n] >= header.number_of_types) {
+        return false;
+      }
+    }
+  } else {
+    if (
+      int(q_position_previous.size()) != N * 3 || int(type.size()) != N ||
+      !unpack_positions(in, in_end, N, q_position_previous.data(), q_position.data())) {
+      return false;
+    }
+  }
+  if (header.has_velocity) {
+    q_velocity.resize(N * 3);
+    if (!unpack_integers(in, in_end, N * 3, q_velocity.data())) {
+      return false;
+    }
+  }
+  return in == in_end;
+}
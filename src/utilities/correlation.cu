@@ -0,0 +1,149 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Host-side correlation functions of long time series for the Green-Kubo
+postprocessing.
+------------------------------------------------------------------------------*/
+
+#include "correlation.cuh"
+#include "utilities/error.cuh"
+#include <algorithm>
+#include <cstring>
+
+static int get_fft_length(const int num_lags, const int block_size)
+{
+  if (block_size > 0) {
+    return FFT::get_length(block_size + num_lags - 1);
+  }
+  // about the minimum of L log(L) / (L - num_lags) per sample, without too small FFTs
+  return FFT::get_length(std::max(8 * num_lags, 1024));
+}
+
+Correlation::Correlation(const int num_channels, const int num_lags, const int block_size)
+  : num_channels_(num_channels),
+    num_lags_(num_lags),
+    fft_(get_fft_length(num_lags, block_size))
+{
+  if (num_channels_ < 1 || num_lags_ < 1) {
+    PRINT_INPUT_ERROR("number of channels and lags for a correlation should be positive.\n");
+  }
+
+  block_size_ = fft_.length() - (num_lags_ - 1);
+  a_.assign(num_channels_ * (num_lags_ - 1 + block_size_), 0.0);
+  b_.assign(num_channels_ * block_size_, 0.0);
+  sum_.assign(num_channels_ * num_lags_, 0.0);
+  work_.resize(fft_.length());
+  product_.resize(fft_.length());
+}
+
+void Correlation::add(const double* a, const double* b, const int num_samples)
+{
+  const int history = num_lags_ - 1;
+  int n = 0;
+  while (n < num_samples) {
+    const int count = std::min(num_samples - n, block_size_ - num_pending_);
+    for (int c = 0; c < num_channels_; ++c) {
+      double* a_block = a_.data() + c * (history + block_size_) + history + num_pending_;
+      double* b_block = b_.data() + c * block_size_ + num_pending_;
+      memcpy(a_block, a + c * num_samples + n, sizeof(double) * count);
+      memcpy(b_block, b + c * num_samples + n, sizeof(double) * count);
+    }
+    num_pending_ += count;
+    n += count;
+    if (num_pending_ == block_size_) {
+      correlate_block();
+    }
+  }
+}
+
+// With the block of b placed after the history of a, the lags k < num_lags of the
+// circular correlation of length L >= history + block_size do not wrap around.
+void Correlation::correlate_block()
+{
+  const int history = num_lags_ - 1;
+  const int length = fft_.length();
+
+  for (int c = 0; c < num_channels_; ++c) {
+    const double* a_channel = a_.data() + c * (history + block_size_);
+    const double* b_channel = b_.data() + c * block_size_;
+
+    // z = a + i b, zero-padded
+    for (int p = 0; p < length; ++p) {
+      const double a_p = (p < history + num_pending_) ? a_channel[p] : 0.0;
+      const double b_p =
+        (p >= history && p < history + num_pending_) ? b_channel[p - history] : 0.0;
+      work_[p] = std::complex<double>(a_p, b_p);
+    }
+    fft_.transform(work_.data(), false);
+
+    // A = (Z[j] + Z*[-j]) / 2, B = (Z[j] - Z*[-j]) / (2 i), and the correlation is A* B
+    for (int j = 0; j < length; ++j) {
+      const std::complex<double> z_plus = work_[j];
+      const std::complex<double> z_minus = std::conj(work_[(length - j) & (length - 1)]);
+      const std::complex<double> a_j = 0.5 * (z_plus + z_minus);
+      const std::complex<double> b_j = std::complex<double>(0.0, -0.5) * (z_plus - z_minus);
+      product_[j] = std::conj(a_j) * b_j;
+    }
+    fft_.transform(product_.data(), true);
+
+    for (int k = 0; k < num_lags_; ++k) {
+      sum_[c * num_lags_ + k] += product_[k].real() / length;
+    }
+  }
+
+  // keep the last samples of a as the history of the next block
+  for (int c = 0; c < num_channels_; ++c) {
+    double* a_channel = a_.data() + c * (history + block_size_);
+    memmove(a_channel, a_channel + num_pending_, sizeof(double) * history);
+  }
+  num_samples_ += num_pending_;
+  num_pending_ = 0;
+}
+
+void Correlation::get_correlation(double* c)
+{
+  if (num_pending_ > 0) {
+    correlate_block();
+  }
+  for (int channel = 0; channel < num_channels_; ++channel) {
+    for (int k = 0; k < num_lags_; ++k) {
+      const long long num_time_origins = num_samples_ - k;
+      const int index = channel * num_lags_ + k;
+      c[index] = (num_time_origins > 0) ? sum_[index] / num_time_origins : 0.0;
+    }
+  }
+}
+
+void Correlation::find_correlation_direct(
+  const int num_channels,
+  const int num_lags,
+  const int num_samples,
+  const double* a,
+  const double* b,
+  double* c)
+{
+  for (int channel = 0; channel < num_channels; ++channel) {
+    const double* a_channel = a + channel * num_samples;
+    const double* b_channel = b + channel * num_samples;
+    for (int k = 0; k < num_lags; ++k) {
+      double sum = 0.0;
+      for (int n = 0; n + k < num_samples; ++n) {
+        sum += a_channel[n] * b_channel[n + k];
+      }
+      c[channel * num_lags + k] = (num_samples > k) ? sum / (num_samples - k) : 0.0;
+    }
+  }
+}
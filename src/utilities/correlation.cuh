@@ -0,0 +1,72 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Host-side correlation functions of long time series for the Green-Kubo
+postprocessing (compute_hac and compute_viscosity):
+    c[k] = sum_{n = 0}^{Nd - 1 - k} a[n] b[n + k] / (Nd - k), k < Nc
+for several channels at once. The series is streamed in blocks of B samples;
+each block of b is correlated with the same block of a plus the Nc - 1 previous
+samples of a (overlap) by one complex FFT of length L >= B + Nc - 1, packing a
+and b as the real and imaginary parts (Wiener-Khinchin theorem). This costs
+O(Nd log L) instead of the O(Nd Nc) of the direct sum, and only needs O(L)
+memory per channel, such that the series does not have to be held at once.
+With B >= Nd, this is the usual zero-padded transform of the whole series.
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include "fft.cuh"
+#include <complex>
+#include <vector>
+
+class Correlation
+{
+public:
+  // block_size <= 0 selects a block size giving FFTs of length about 8 * num_lags
+  Correlation(const int num_channels, const int num_lags, const int block_size = 0);
+
+  // append the next num_samples samples of each channel, with channel c at
+  // a[c * num_samples + n] and b[c * num_samples + n]; any num_samples is allowed
+  void add(const double* a, const double* b, const int num_samples);
+
+  // c[channel * num_lags + k] = <a(n) b(n + k)>, averaged over the time origins
+  void get_correlation(double* c);
+
+  // the same for a whole series of num_samples samples, by the direct sum (the reference)
+  static void find_correlation_direct(
+    const int num_channels,
+    const int num_lags,
+    const int num_samples,
+    const double* a,
+    const double* b,
+    double* c);
+
+  int block_size() const { return block_size_; }
+
+private:
+  int num_channels_;
+  int num_lags_;
+  int block_size_;
+  int num_pending_ = 0;       // samples of the current block received so far
+  long long num_samples_ = 0; // samples of the completed blocks
+  FFT fft_;
+  std::vector<double> a_;   // the last num_lags - 1 samples of a, then the current block
+  std::vector<double> b_;   // the current block of b
+  std::vector<double> sum_; // sum of a[n] b[n + k] over the completed blocks
+  std::vector<std::complex<double>> work_;
+  std::vector<std::complex<double>> product_;
+
+  void correlate_block();
+};
@@ -14,6 +14,7 @@
 */
 
 #pragma once
+#include "host_backend.cuh"
 #include <fstream>
 #include <stdio.h>
 #include <string>
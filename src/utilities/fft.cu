@@ -0,0 +1,182 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Host-side fast Fourier transforms for the postprocessing of correlation
+functions.
+------------------------------------------------------------------------------*/
+
+#include "fft.cuh"
+#include "utilities/error.cuh"
+#include <cmath>
+
+// more digits than PI in common.cuh, as the chirps have large phases
+const long double TWO_PI_LONG = 6.283185307179586476925286766559005768L;
+
+int FFT::get_length(const int n)
+{
+  int length = 1;
+  while (length < n) {
+    length *= 2;
+  }
+  return length;
+}
+
+FFT::FFT(const int length) : length_(length)
+{
+  if (length_ < 1 || (length_ & (length_ - 1)) != 0) {
+    PRINT_INPUT_ERROR("FFT length should be a power of 2.");
+  }
+
+  twiddle_.resize(length_ / 2);
+  for (int j = 0; j < length_ / 2; ++j) {
+    const double phase = -double(TWO_PI_LONG) * j / length_;
+    twiddle_[j] = std::complex<double>(cos(phase), sin(phase));
+  }
+
+  int num_bits = 0;
+  while ((1 << num_bits) < length_) {
+    ++num_bits;
+  }
+  bit_reversal_.resize(length_);
+  for (int n = 0; n < length_; ++n) {
+    int reversed = 0;
+    for (int b = 0; b < num_bits; ++b) {
+      reversed |= ((n >> b) & 1) << (num_bits - 1 - b);
+    }
+    bit_reversal_[n] = reversed;
+  }
+}
+
+void FFT::transform(std::complex<double>* data, const bool inverse) const
+{
+  for (int n = 0; n < length_; ++n) {
+    if (n < bit_reversal_[n]) {
+      std::swap(data[n], data[bit_reversal_[n]]);
+    }
+  }
+
+  for (int half = 1; half < length_; half *= 2) {
+    const int stride = length_ / (half * 2);
+    for (int start = 0; start < length_; start += half * 2) {
+      for (int j = 0; j < half; ++j) {
+        std::complex<double> w = twiddle_[j * stride];
+        if (inverse) {
+          w = std::conj(w);
+        }
+        const std::complex<double> a = data[start + j];
+        const std::complex<double> b = data[start + j + half] * w;
+        data[start + j] = a + b;
+        data[start + j + half] = a - b;
+      }
+    }
+  }
+}
+
+// cost of the direct sum and of the chirp-z transform, in units of a complex multiply-add
+static bool is_fft_faster(const int num_inputs, const int num_outputs, const int length)
+{
+  const double log_length = log2(double(length));
+  const double cost_direct = double(num_inputs) * num_outputs * 4.0; // with a cos() per term
+  const double cost_fft = 2.0 * length * log_length + 3.0 * length;
+  return cost_fft < cost_direct;
+}
+
+Cosine_Sum::Cosine_Sum(
+  const int num_inputs,
+  const int num_outputs,
+  const double theta_0,
+  const double d_theta,
+  const double n0)
+  : num_inputs_(num_inputs),
+    num_outputs_(num_outputs),
+    theta_0_(theta_0),
+    d_theta_(d_theta),
+    n0_(n0),
+    fft_(FFT::get_length(num_inputs + num_outputs - 1))
+{
+  use_fft_ = is_fft_faster(num_inputs_, num_outputs_, fft_.length());
+  if (!use_fft_) {
+    return;
+  }
+
+  // n k = (n^2 + k^2 - (k - n)^2) / 2 turns the sum into a convolution with a chirp;
+  // the phases are reduced modulo 2 pi in long double to keep them accurate for large n
+  auto unit = [](const long double phase) {
+    const long double reduced = fmodl(phase, TWO_PI_LONG);
+    return std::complex<double>(double(cosl(reduced)), double(sinl(reduced)));
+  };
+
+  const int length = fft_.length();
+  input_chirp_.resize(num_inputs_);
+  for (int n = 0; n < num_inputs_; ++n) {
+    const long double nn = n;
+    input_chirp_[n] = unit(-(theta_0_ * nn + 0.5L * d_theta_ * nn * nn));
+  }
+
+  output_chirp_.resize(num_outputs_);
+  for (int k = 0; k < num_outputs_; ++k) {
+    const long double kk = k;
+    const long double theta_k = theta_0_ + d_theta_ * kk;
+    output_chirp_[k] = unit(-(0.5L * d_theta_ * kk * kk + theta_k * n0_));
+  }
+
+  kernel_.assign(length, std::complex<double>(0.0, 0.0));
+  for (int m = 0; m < num_outputs_; ++m) {
+    const long double mm = m;
+    kernel_[m] = unit(0.5L * d_theta_ * mm * mm);
+  }
+  for (int m = 1; m < num_inputs_; ++m) {
+    const long double mm = m;
+    kernel_[length - m] = unit(0.5L * d_theta_ * mm * mm);
+  }
+  fft_.transform(kernel_.data(), false);
+  for (int m = 0; m < length; ++m) {
+    kernel_[m] /= double(length); // normalization of the inverse transform
+  }
+}
+
+void Cosine_Sum::transform_direct(const double* x, double* y) const
+{
+  for (int k = 0; k < num_outputs_; ++k) {
+    const double theta = theta_0_ + d_theta_ * k;
+    double sum = 0.0;
+    for (int n = 0; n < num_inputs_; ++n) {
+      sum += x[n] * cos(theta * (n + n0_));
+    }
+    y[k] = sum;
+  }
+}
+
+void Cosine_Sum::transform(const double* x, double* y) const
+{
+  if (!use_fft_) {
+    transform_direct(x, y);
+    return;
+  }
+
+  std::vector<std::complex<double>> work(fft_.length(), std::complex<double>(0.0, 0.0));
+  for (int n = 0; n < num_inputs_; ++n) {
+    work[n] = x[n] * input_chirp_[n];
+  }
+  fft_.transform(work.data(), false);
+  for (int m = 0; m < fft_.length(); ++m) {
+    work[m] *= kernel_[m];
+  }
+  fft_.transform(work.data(), true);
+  for (int k = 0; k < num_outputs_; ++k) {
+    y[k] = (work[k] * output_chirp_[k]).real();
+  }
+}
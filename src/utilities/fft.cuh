@@ -0,0 +1,79 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Host-side fast Fourier transforms for the postprocessing of correlation
+functions:
+    FFT: complex radix-2 transform of a fixed power-of-two length
+    Cosine_Sum: y[k] = sum_n x[n] cos(theta_k * (n + n0)) on an arbitrary
+        uniform grid theta_k = theta_0 + k * d_theta, evaluated by the chirp-z
+        (Bluestein) algorithm with two FFTs of length L >= N + K - 1 instead of
+        the N * K cosines of the direct sum
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include <complex>
+#include <vector>
+
+class FFT
+{
+public:
+  // the length must be a power of two
+  explicit FFT(const int length);
+
+  int length() const { return length_; }
+
+  // in-place transform: sum_n data[n] exp(-+ 2 pi i n k / L), without normalization
+  void transform(std::complex<double>* data, const bool inverse) const;
+
+  // smallest power of two >= n
+  static int get_length(const int n);
+
+private:
+  int length_;
+  std::vector<std::complex<double>> twiddle_; // exp(-2 pi i j / L), j < L / 2
+  std::vector<int> bit_reversal_;
+};
+
+class Cosine_Sum
+{
+public:
+  Cosine_Sum(
+    const int num_inputs,
+    const int num_outputs,
+    const double theta_0,
+    const double d_theta,
+    const double n0 = 0.0);
+
+  // y[k] = sum_n x[n] cos((theta_0 + k * d_theta) * (n + n0)), k < num_outputs
+  void transform(const double* x, double* y) const;
+
+  // the same, by the direct sum (used for small sizes and as the reference)
+  void transform_direct(const double* x, double* y) const;
+
+  bool uses_fft() const { return use_fft_; }
+
+private:
+  int num_inputs_;
+  int num_outputs_;
+  double theta_0_;
+  double d_theta_;
+  double n0_;
+  bool use_fft_ = false;
+  FFT fft_;
+  std::vector<std::complex<double>> input_chirp_;  // exp(-i (theta_0 n + d_theta n^2 / 2))
+  std::vector<std::complex<double>> output_chirp_; // exp(-i (d_theta k^2 / 2 + theta_k n0))
+  std::vector<std::complex<double>> kernel_;       // FFT of exp(i d_theta m^2 / 2)
+};
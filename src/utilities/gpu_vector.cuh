@@ -17,6 +17,7 @@
 
 #include "error.cuh"
 
+#ifndef USE_HOST_BACKEND
 namespace
 {
 template <typename T>
@@ -27,6 +28,7 @@ void __global__ gpu_fill(const size_t size, const T value, T* data)
     data[i] = value;
 }
 } // anonymous namespace
+#endif
 
 enum class Memory_Type {
   global = 0, // global memory, also called (linear) device memory
@@ -163,6 +165,10 @@ public:
   // give "value" to each element
   void fill(const T value)
   {
+#ifdef USE_HOST_BACKEND
+    for (size_t i = 0; i < size_; ++i)
+      data_[i] = value;
+#else
     if (memory_type_ == Memory_Type::global) {
       const int block_size = 128;
       const int grid_size = (size_ + block_size - 1) / block_size;
@@ -173,6 +179,7 @@ public:
       for (int i = 0; i < size_; ++i)
         data_[i] = value;
     }
+#endif
   }
 
   // the [] operator
@@ -0,0 +1,107 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Host-memory backend, enabled by -DUSE_HOST_BACKEND (see "make host").
+It provides the small part of the CUDA runtime API used by GPU_Vector and the
+host-side code, such that these files can be compiled by a plain C++ compiler:
+"device" memory is an aligned host allocation and there is exactly one device.
+------------------------------------------------------------------------------*/
+
+#pragma once
+#ifdef USE_HOST_BACKEND
+
+#include <cstdlib>
+#include <cstring>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#define __host__
+#define __device__
+#define __global__
+#define __constant__
+#define __forceinline__ inline
+
+const size_t HOST_BACKEND_ALIGNMENT = 64; // cache line size
+
+enum cudaError_t { cudaSuccess = 0, cudaErrorMemoryAllocation = 2 };
+
+enum cudaMemcpyKind {
+  cudaMemcpyHostToHost = 0,
+  cudaMemcpyHostToDevice = 1,
+  cudaMemcpyDeviceToHost = 2,
+  cudaMemcpyDeviceToDevice = 3
+};
+
+inline cudaError_t cudaMalloc(void** ptr, const size_t size)
+{
+#ifdef _WIN32
+  *ptr = _aligned_malloc(size > 0 ? size : 1, HOST_BACKEND_ALIGNMENT);
+  return (*ptr == nullptr) ? cudaErrorMemoryAllocation : cudaSuccess;
+#else
+  *ptr = nullptr;
+  int error = posix_memalign(ptr, HOST_BACKEND_ALIGNMENT, size > 0 ? size : 1);
+  return (error != 0) ? cudaErrorMemoryAllocation : cudaSuccess;
+#endif
+}
+
+inline cudaError_t cudaMallocManaged(void** ptr, const size_t size)
+{
+  return cudaMalloc(ptr, size);
+}
+
+inline cudaError_t cudaFree(void* ptr)
+{
+#ifdef _WIN32
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaMemcpy(void* dst, const void* src, const size_t size, cudaMemcpyKind)
+{
+  if (size > 0) {
+    memcpy(dst, src, size);
+  }
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaMemset(void* ptr, const int value, const size_t size)
+{
+  memset(ptr, value, size);
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaGetDeviceCount(int* count)
+{
+  *count = 1;
+  return cudaSuccess;
+}
+
+inline cudaError_t cudaSetDevice(int) { return cudaSuccess; }
+
+inline cudaError_t cudaGetLastError() { return cudaSuccess; }
+
+inline cudaError_t cudaDeviceSynchronize() { return cudaSuccess; }
+
+inline const char* cudaGetErrorString(cudaError_t error)
+{
+  return (error == cudaSuccess) ? "no error" : "out of host memory";
+}
+
+#endif
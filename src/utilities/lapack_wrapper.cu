@@ -0,0 +1,80 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Some wrappers for the host LAPACK library
+------------------------------------------------------------------------------*/
+
+#ifdef USE_LAPACK
+
+#include "lapack_wrapper.cuh"
+#include <complex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+extern "C" void zheev_(
+  const char* jobz,
+  const char* uplo,
+  const int* n,
+  std::complex<double>* a,
+  const int* lda,
+  double* w,
+  std::complex<double>* work,
+  const int* lwork,
+  double* rwork,
+  int* info);
+
+void eig_hermitian_batch_lapack(size_t N, size_t batch_size, double* AR, double* AI, double* W)
+{
+  const int n = N;
+  const char jobz = 'N';
+  const char uplo = 'L';
+  const size_t N2 = N * N;
+
+  // workspace query, valid for all the matrices of this size
+  int lwork = -1;
+  int info = 0;
+  std::complex<double> work_size;
+  zheev_(&jobz, &uplo, &n, nullptr, &n, nullptr, &work_size, &lwork, nullptr, &info);
+  lwork = int(work_size.real());
+
+  int num_failed = 0;
+#pragma omp parallel reduction(+ : num_failed)
+  {
+    std::vector<std::complex<double>> A(N2);
+    std::vector<std::complex<double>> work(lwork);
+    std::vector<double> rwork(3 * N);
+#pragma omp for schedule(dynamic)
+    for (int b = 0; b < int(batch_size); ++b) {
+      for (size_t m = 0; m < N2; ++m) {
+        A[m] = std::complex<double>(AR[b * N2 + m], AI[b * N2 + m]);
+      }
+      int info_b = 0;
+      zheev_(
+        &jobz, &uplo, &n, A.data(), &n, W + b * N, work.data(), &lwork, rwork.data(), &info_b);
+      if (info_b != 0) {
+        ++num_failed;
+      }
+    }
+  }
+
+  if (num_failed > 0) {
+    printf("zheev failed for %d matrices.\n", num_failed);
+    exit(1);
+  }
+}
+
+#endif
@@ -0,0 +1,26 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Host LAPACK counterparts of some functions in cusolver_wrapper.cuh, available
+when compiled with -DUSE_LAPACK (and linked with -llapack)
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include <stddef.h>
+
+// eigenvalues (ascending) of a batch of N x N Hermitian matrices in column-major order;
+// the matrices are solved in parallel on the host threads
+void eig_hermitian_batch_lapack(size_t N, size_t batch_size, double* AR, double* AI, double* W);
@@ -0,0 +1,80 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "error.cuh"
+#include "mapped_file.cuh"
+#include <stdio.h>
+#include <string>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+Mapped_File::Mapped_File(const char* filename)
+{
+#ifndef _WIN32
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    PRINT_INPUT_ERROR((std::string("Failed to open ") + filename + ".").c_str());
+  }
+  struct stat file_status;
+  if (fstat(fd, &file_status) != 0) {
+    close(fd);
+    PRINT_INPUT_ERROR((std::string("Failed to get the size of ") + filename + ".").c_str());
+  }
+  size_ = file_status.st_size;
+  if (size_ > 0) {
+    void* address = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (address != MAP_FAILED) {
+      madvise(address, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<const char*>(address);
+      is_mapped_ = true;
+    }
+  }
+  close(fd);
+  if (is_mapped_ || size_ == 0) {
+    return;
+  }
+#endif
+
+  // fall back to reading the whole file
+  FILE* fid = my_fopen(filename, "rb");
+#ifdef _WIN32
+  _fseeki64(fid, 0, SEEK_END);
+  size_ = _ftelli64(fid);
+  _fseeki64(fid, 0, SEEK_SET);
+#else
+  fseek(fid, 0, SEEK_END);
+  size_ = ftell(fid);
+  fseek(fid, 0, SEEK_SET);
+#endif
+  buffer_.resize(size_);
+  if (size_ > 0 && fread(buffer_.data(), 1, size_, fid) != size_) {
+    PRINT_INPUT_ERROR((std::string("Failed to read ") + filename + ".").c_str());
+  }
+  fclose(fid);
+  data_ = buffer_.data();
+}
+
+Mapped_File::~Mapped_File()
+{
+#ifndef _WIN32
+  if (is_mapped_) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+#endif
+}
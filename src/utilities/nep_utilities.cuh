@@ -14,29 +14,57 @@
 */
 
 #pragma once
+#include "host_backend.cuh"
+#include <cmath>
 
 const int NUM_OF_ABC = 24; // 3 + 5 + 7 + 9 for L_max = 4
-__constant__ float C3B[NUM_OF_ABC] = {
+__constant__ float C3B_DEVICE[NUM_OF_ABC] = {
   0.238732414637843f, 0.119366207318922f, 0.119366207318922f, 0.099471839432435f,
   0.596831036594608f, 0.596831036594608f, 0.149207759148652f, 0.149207759148652f,
   0.139260575205408f, 0.104445431404056f, 0.104445431404056f, 1.044454314040563f,
   1.044454314040563f, 0.174075719006761f, 0.174075719006761f, 0.011190581936149f,
   0.223811638722978f, 0.223811638722978f, 0.111905819361489f, 0.111905819361489f,
   1.566681471060845f, 1.566681471060845f, 0.195835183882606f, 0.195835183882606f};
-__constant__ float C4B[5] = {
+__constant__ float C4B_DEVICE[5] = {
   -0.007499480826664f,
   -0.134990654879954f,
   0.067495327439977f,
   0.404971964639861f,
   -0.809943929279723f};
-__constant__ float C5B[3] = {0.026596810706114f, 0.053193621412227f, 0.026596810706114f};
+__constant__ float C5B_DEVICE[3] = {0.026596810706114f, 0.053193621412227f, 0.026596810706114f};
+
+// host copies of the above coefficients such that the functions below can also run on the CPU
+const float C3B_HOST[NUM_OF_ABC] = {
+  0.238732414637843f, 0.119366207318922f, 0.119366207318922f, 0.099471839432435f,
+  0.596831036594608f, 0.596831036594608f, 0.149207759148652f, 0.149207759148652f,
+  0.139260575205408f, 0.104445431404056f, 0.104445431404056f, 1.044454314040563f,
+  1.044454314040563f, 0.174075719006761f, 0.174075719006761f, 0.011190581936149f,
+  0.223811638722978f, 0.223811638722978f, 0.111905819361489f, 0.111905819361489f,
+  1.566681471060845f, 1.566681471060845f, 0.195835183882606f, 0.195835183882606f};
+const float C4B_HOST[5] = {
+  -0.007499480826664f,
+  -0.134990654879954f,
+  0.067495327439977f,
+  0.404971964639861f,
+  -0.809943929279723f};
+const float C5B_HOST[3] = {0.026596810706114f, 0.053193621412227f, 0.026596810706114f};
+
+#ifdef __CUDA_ARCH__
+#define C3B C3B_DEVICE
+#define C4B C4B_DEVICE
+#define C5B C5B_DEVICE
+#else
+#define C3B C3B_HOST
+#define C4B C4B_HOST
+#define C5B C5B_HOST
+#endif
 
 const int SIZE_BOX_AND_INVERSE_BOX = 18; // (3 * 3) * 2
 const int MAX_NUM_N = 20;                // n_max+1 = 19+1
 const int MAX_DIM = MAX_NUM_N * 7;
 const int MAX_DIM_ANGULAR = MAX_NUM_N * 6;
 
-static __device__ void apply_ann_one_layer(
+static __host__ __device__ void apply_ann_one_layer(
   const int N_des,
   const int N_neu,
   const float* w0,
@@ -63,7 +91,7 @@ static __device__ void apply_ann_one_layer(
   energy -= b1[0];
 }
 
-static __device__ __forceinline__ void find_fc(float rc, float rcinv, float d12, float& fc)
+static __host__ __device__ __forceinline__ void find_fc(float rc, float rcinv, float d12, float& fc)
 {
   if (d12 < rc) {
     float x = d12 * rcinv;
@@ -73,7 +101,7 @@ static __device__ __forceinline__ void find_fc(float rc, float rcinv, float d12,
   }
 }
 
-static __device__ __host__ __forceinline__ void
+static __host__ __device__ __forceinline__ void
 find_fc_and_fcp(float rc, float rcinv, float d12, float& fc, float& fcp)
 {
   if (d12 < rc) {
@@ -87,7 +115,7 @@ find_fc_and_fcp(float rc, float rcinv, float d12, float& fc, float& fcp)
   }
 }
 
-static __device__ __forceinline__ void
+static __host__ __device__ __forceinline__ void
 find_fc_and_fcp_zbl(float r1, float r2, float d12, float& fc, float& fcp)
 {
   if (d12 < r1) {
@@ -103,7 +131,7 @@ find_fc_and_fcp_zbl(float r1, float r2, float d12, float& fc, float& fcp)
   }
 }
 
-static __device__ __forceinline__ void
+static __host__ __device__ __forceinline__ void
 find_phi_and_phip_zbl(float a, float b, float x, float& phi, float& phip)
 {
   float tmp = a * exp(-b * x);
@@ -111,7 +139,7 @@ find_phi_and_phip_zbl(float a, float b, float x, float& phi, float& phip)
   phip -= b * tmp;
 }
 
-static __device__ __forceinline__ void find_f_and_fp_zbl(
+static __host__ __device__ __forceinline__ void find_f_and_fp_zbl(
   const float zizj,
   const float a_inv,
   const float rc_inner,
@@ -139,7 +167,7 @@ static __device__ __forceinline__ void find_f_and_fp_zbl(
   f *= fc;
 }
 
-static __device__ __forceinline__ void find_f_and_fp_zbl(
+static __host__ __device__ __forceinline__ void find_f_and_fp_zbl(
   const float* zbl_para,
   const float zizj,
   const float a_inv,
@@ -164,7 +192,7 @@ static __device__ __forceinline__ void find_f_and_fp_zbl(
   f *= fc;
 }
 
-static __device__ __forceinline__ void
+static __host__ __device__ __forceinline__ void
 find_fn(const int n, const float rcinv, const float d12, const float fc12, float& fn)
 {
   if (n == 0) {
@@ -186,7 +214,7 @@ find_fn(const int n, const float rcinv, const float d12, const float fc12, float
   }
 }
 
-static __device__ __forceinline__ void find_fn_and_fnp(
+static __host__ __device__ __forceinline__ void find_fn_and_fnp(
   const int n,
   const float rcinv,
   const float d12,
@@ -226,7 +254,7 @@ static __device__ __forceinline__ void find_fn_and_fnp(
   }
 }
 
-static __device__ __forceinline__ void
+static __host__ __device__ __forceinline__ void
 find_fn(const int n_max, const float rcinv, const float d12, const float fc12, float* fn)
 {
   float x = 2.0f * (d12 * rcinv - 1.0f) * (d12 * rcinv - 1.0f) - 1.0f;
@@ -240,7 +268,7 @@ find_fn(const int n_max, const float rcinv, const float d12, const float fc12, f
   }
 }
 
-static __device__ __host__ __forceinline__ void find_fn_and_fnp(
+static __host__ __device__ __forceinline__ void find_fn_and_fnp(
   const int n_max,
   const float rcinv,
   const float d12,
@@ -272,7 +300,7 @@ static __device__ __host__ __forceinline__ void find_fn_and_fnp(
   }
 }
 
-static __device__ __forceinline__ void get_f12_1(
+static __host__ __device__ __forceinline__ void get_f12_1(
   const float d12inv,
   const float fn,
   const float fnp,
@@ -295,7 +323,7 @@ static __device__ __forceinline__ void get_f12_1(
   f12[2] += tmp * s[0];
 }
 
-static __device__ __forceinline__ void get_f12_2(
+static __host__ __device__ __forceinline__ void get_f12_2(
   const float d12,
   const float d12inv,
   const float fn,
@@ -321,7 +349,7 @@ static __device__ __forceinline__ void get_f12_2(
   f12[2] += tmp * (2.0f * s[0] * r12[2] + s[1] * r12[0] + s[2] * r12[1]);
 }
 
-static __device__ __forceinline__ void get_f12_4body(
+static __host__ __device__ __forceinline__ void get_f12_4body(
   const float d12,
   const float d12inv,
   const float fn,
@@ -377,7 +405,7 @@ static __device__ __forceinline__ void get_f12_4body(
   f12[2] += tmp1 * r12[2];
 }
 
-static __device__ __forceinline__ void get_f12_5body(
+static __host__ __device__ __forceinline__ void get_f12_5body(
   const float d12,
   const float d12inv,
   const float fn,
@@ -416,7 +444,7 @@ static __device__ __forceinline__ void get_f12_5body(
   f12[2] += tmp1 * r12[2];
 }
 
-static __device__ __forceinline__ void get_f12_3(
+static __host__ __device__ __forceinline__ void get_f12_3(
   const float d12,
   const float d12inv,
   const float fn,
@@ -477,7 +505,7 @@ static __device__ __forceinline__ void get_f12_3(
   f12[2] += tmp * Fp * fn * 2.0f;
 }
 
-static __device__ __forceinline__ void get_f12_4(
+static __host__ __device__ __forceinline__ void get_f12_4(
   const float x,
   const float y,
   const float z,
@@ -550,7 +578,7 @@ static __device__ __forceinline__ void get_f12_4(
   f12[2] += tmp * Fp * fn * 2.0f;
 }
 
-static __device__ __forceinline__ void accumulate_f12(
+static __host__ __device__ __forceinline__ void accumulate_f12(
   const int n,
   const int n_max_angular_plus_1,
   const float d12,
@@ -609,7 +637,7 @@ static __device__ __forceinline__ void accumulate_f12(
     r12[0], r12[1], r12[2], d12, d12inv, fn, fnp, Fp[3 * n_max_angular_plus_1 + n], s4, f12);
 }
 
-static __device__ __forceinline__ void accumulate_f12_with_4body(
+static __host__ __device__ __forceinline__ void accumulate_f12_with_4body(
   const int n,
   const int n_max_angular_plus_1,
   const float d12,
@@ -674,7 +702,7 @@ static __device__ __forceinline__ void accumulate_f12_with_4body(
     r12[0], r12[1], r12[2], d12, d12inv, fn, fnp, Fp[3 * n_max_angular_plus_1 + n], s4, f12);
 }
 
-static __device__ __forceinline__ void accumulate_f12_with_5body(
+static __host__ __device__ __forceinline__ void accumulate_f12_with_5body(
   const int n,
   const int n_max_angular_plus_1,
   const float d12,
@@ -741,7 +769,7 @@ static __device__ __forceinline__ void accumulate_f12_with_5body(
     r12[0], r12[1], r12[2], d12, d12inv, fn, fnp, Fp[3 * n_max_angular_plus_1 + n], s4, f12);
 }
 
-static __device__ __forceinline__ void
+static __host__ __device__ __forceinline__ void
 accumulate_s(const float d12, float x12, float y12, float z12, const float fn, float* s)
 {
   float d12inv = 1.0f / d12;
@@ -778,7 +806,7 @@ accumulate_s(const float d12, float x12, float y12, float z12, const float fn, f
   s[23] += (4.0f * x12 * y12 * x12sq_minus_y12sq) * fn;                         // Y44_imag
 }
 
-static __device__ __forceinline__ void
+static __host__ __device__ __forceinline__ void
 find_q(const int n_max_angular_plus_1, const int n, const float* s, float* q)
 {
   q[n] = C3B[0] * s[0] * s[0] + 2.0f * (C3B[1] * s[1] * s[1] + C3B[2] * s[2] * s[2]);
@@ -796,7 +824,7 @@ find_q(const int n_max_angular_plus_1, const int n, const float* s, float* q)
             C3B[22] * s[22] * s[22] + C3B[23] * s[23] * s[23]);
 }
 
-static __device__ __forceinline__ void
+static __host__ __device__ __forceinline__ void
 find_q_with_4body(const int n_max_angular_plus_1, const int n, const float* s, float* q)
 {
   find_q(n_max_angular_plus_1, n, s, q);
@@ -806,7 +834,7 @@ find_q_with_4body(const int n_max_angular_plus_1, const int n, const float* s, f
     C4B[4] * s[4] * s[5] * s[7];
 }
 
-static __device__ __forceinline__ void
+static __host__ __device__ __forceinline__ void
 find_q_with_5body(const int n_max_angular_plus_1, const int n, const float* s, float* q)
 {
   find_q_with_4body(n_max_angular_plus_1, n, s, q);
@@ -0,0 +1,203 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Wall-clock timing of the stages of the step loop.
+------------------------------------------------------------------------------*/
+
+#include "stage_timer.cuh"
+#include "utilities/error.cuh"
+#include "utilities/read_file.cuh"
+#include <chrono>
+#include <cstring>
+
+static double get_wall_time()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+void Stage_Timer::parse(const char** param, int num_param)
+{
+  if (num_param != 1 && num_param != 3) {
+    PRINT_INPUT_ERROR("timing should have 0 or 2 parameters.");
+  }
+  num_trace_steps_ = 0;
+  if (num_param == 3) {
+    if (strcmp(param[1], "trace") != 0) {
+      PRINT_INPUT_ERROR("The first parameter of timing can only be trace.");
+    }
+    if (!is_valid_int(param[2], &num_trace_steps_)) {
+      PRINT_INPUT_ERROR("Number of traced steps should be an integer.");
+    }
+    if (num_trace_steps_ <= 0) {
+      PRINT_INPUT_ERROR("Number of traced steps should > 0.");
+    }
+  }
+  is_enabled_ = true;
+  printf("Time the stages of the step loop.\n");
+  if (num_trace_steps_ > 0) {
+    printf("    and write the first %d steps into timing_trace.json.\n", num_trace_steps_);
+  }
+}
+
+void Stage_Timer::start_run()
+{
+  stages_.clear();
+  open_stages_.clear();
+  trace_events_.clear();
+  is_tracing_ = false;
+  is_running_ = is_enabled_;
+  if (is_running_) {
+    CHECK(cudaDeviceSynchronize());
+    run_begin_ = get_wall_time();
+  }
+}
+
+void Stage_Timer::start_step(const int step) { is_tracing_ = step < num_trace_steps_; }
+
+int Stage_Timer::find_stage(const char* name, const int parent)
+{
+  for (int k = 0; k < stages_.size(); ++k) {
+    if (stages_[k].parent == parent && stages_[k].name == name) {
+      return k;
+    }
+  }
+  Stage stage;
+  stage.name = name;
+  stage.parent = parent;
+  stage.depth = (parent < 0) ? 0 : stages_[parent].depth + 1;
+  stages_.push_back(stage);
+  return stages_.size() - 1;
+}
+
+int Stage_Timer::begin(const char* name)
+{
+  if (!is_running_) {
+    return -1;
+  }
+  const int parent = open_stages_.empty() ? -1 : open_stages_.back();
+  const int k = find_stage(name, parent);
+  CHECK(cudaDeviceSynchronize());
+  stages_[k].last_begin = get_wall_time();
+  open_stages_.push_back(k);
+  return k;
+}
+
+void Stage_Timer::end(const int stage)
+{
+  CHECK(cudaDeviceSynchronize());
+  const double time = get_wall_time() - stages_[stage].last_begin;
+  stages_[stage].total += time;
+  ++stages_[stage].calls;
+  open_stages_.pop_back();
+  if (is_tracing_) {
+    trace_events_.push_back({stage, stages_[stage].last_begin - run_begin_, time});
+  }
+}
+
+void Stage_Timer::print_table(
+  const double run_time, const int number_of_steps, const int number_of_atoms)
+{
+  printf("Wall time of the stages in the step loop:\n");
+  printf("    %-32s%10s%14s%16s%10s\n", "stage", "calls", "time (s)", "per step (ms)", "percent");
+
+  // children are registered after their parents, so a depth-first walk in the order of
+  // registration lists each stage below its parent
+  std::vector<int> stack;
+  for (int k = stages_.size() - 1; k >= 0; --k) {
+    if (stages_[k].parent < 0) {
+      stack.push_back(k);
+    }
+  }
+  double time_top_level = 0.0;
+  while (!stack.empty()) {
+    const int k = stack.back();
+    stack.pop_back();
+    const Stage& stage = stages_[k];
+    if (stage.parent < 0) {
+      time_top_level += stage.total;
+    }
+    std::string name = std::string(stage.depth * 2, ' ') + stage.name;
+    printf(
+      "    %-32s%10lld%14.4f%16.4f%10.2f\n",
+      name.c_str(),
+      stage.calls,
+      stage.total,
+      stage.total * 1000.0 / number_of_steps,
+      stage.total * 100.0 / run_time);
+    for (int child = stages_.size() - 1; child > k; --child) {
+      if (stages_[child].parent == k) {
+        stack.push_back(child);
+      }
+    }
+  }
+  const double time_other = run_time - time_top_level;
+  printf(
+    "    %-32s%10s%14.4f%16.4f%10.2f\n",
+    "other",
+    "",
+    time_other,
+    time_other * 1000.0 / number_of_steps,
+    time_other * 100.0 / run_time);
+  printf(
+    "    %-32s%10s%14.4f%16.4f%10.2f\n",
+    "total",
+    "",
+    run_time,
+    run_time * 1000.0 / number_of_steps,
+    100.0);
+  printf(
+    "Speed of the step loop = %g atom*step/second (with synchronization).\n",
+    number_of_atoms * (number_of_steps / run_time));
+}
+
+void Stage_Timer::write_trace()
+{
+  FILE* fid = my_fopen("timing_trace.json", "w");
+  fprintf(fid, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+  for (int n = 0; n < trace_events_.size(); ++n) {
+    const Trace_Event& event = trace_events_[n];
+    fprintf(
+      fid,
+      "{\"name\": \"%s\", \"cat\": \"gpumd\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, "
+      "\"pid\": 0, \"tid\": 0}%s\n",
+      stages_[event.stage].name.c_str(),
+      event.begin * 1.0e6,
+      event.duration * 1.0e6,
+      (n + 1 < trace_events_.size()) ? "," : "");
+  }
+  fprintf(fid, "]}\n");
+  fclose(fid);
+  printf("Wrote %d trace events into timing_trace.json.\n", int(trace_events_.size()));
+}
+
+void Stage_Timer::finish_run(const int number_of_steps, const int number_of_atoms)
+{
+  if (is_running_ && number_of_steps > 0) {
+    CHECK(cudaDeviceSynchronize());
+    const double run_time = get_wall_time() - run_begin_;
+    print_line_1();
+    print_table(run_time, number_of_steps, number_of_atoms);
+    if (num_trace_steps_ > 0) {
+      write_trace();
+    }
+    print_line_2();
+  }
+  is_enabled_ = false;
+  is_running_ = false;
+  is_tracing_ = false;
+  num_trace_steps_ = 0;
+}
@@ -0,0 +1,108 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Wall-clock timing of the stages of the step loop (keyword "timing"). A stage is
+timed by a Scoped_Stage object. Stages opened while another stage is open are
+registered as its children, and each (name, parent) pair is accumulated over the
+run. When timing is disabled, a Scoped_Stage only checks a flag. When enabled,
+the device is synchronized at the boundaries of the stages, such that the time
+of the kernels is attributed to the stage launching them. Optionally, the
+stages of the first steps are written in the trace-event format of Chrome
+(timing_trace.json, to be opened in chrome://tracing or ui.perfetto.dev).
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include <string>
+#include <vector>
+
+class Stage_Timer
+{
+public:
+  struct Stage {
+    std::string name;
+    int parent = -1;         // index of the enclosing stage, -1 for top-level stages
+    int depth = 0;           // number of enclosing stages
+    long long calls = 0;     // number of times the stage is timed
+    double total = 0.0;      // accumulated wall time (s)
+    double last_begin = 0.0; // wall time at the last begin() (s)
+  };
+
+  void parse(const char** param, int num_param);
+
+  // start timing the step loop of a run
+  void start_run();
+
+  // record the trace events of this step if it is one of the first num_trace_steps steps
+  void start_step(const int step);
+
+  // print the table of the stages, write the trace file and disable timing for the next run
+  void finish_run(const int number_of_steps, const int number_of_atoms);
+
+  bool is_enabled() const { return is_enabled_; }
+
+  // open a stage and return its index
+  int begin(const char* name);
+
+  // close the stage opened by the last begin()
+  void end(const int stage);
+
+  // the stages of the current (or last) run, in the order of registration
+  const std::vector<Stage>& get_stages() const { return stages_; }
+
+private:
+  struct Trace_Event {
+    int stage;       // index of the stage
+    double begin;    // wall time relative to the start of the run (s)
+    double duration; // wall time of the stage (s)
+  };
+
+  bool is_enabled_ = false;
+  bool is_running_ = false;
+  bool is_tracing_ = false;
+  int num_trace_steps_ = 0;
+  double run_begin_ = 0.0;
+  std::vector<Stage> stages_;
+  std::vector<int> open_stages_;
+  std::vector<Trace_Event> trace_events_;
+
+  int find_stage(const char* name, const int parent);
+  void print_table(const double run_time, const int number_of_steps, const int number_of_atoms);
+  void write_trace();
+};
+
+// time the enclosing scope as a stage of the given timer
+class Scoped_Stage
+{
+public:
+  Scoped_Stage(Stage_Timer& timer, const char* name) : timer_(timer)
+  {
+    if (timer_.is_enabled()) {
+      stage_ = timer_.begin(name);
+    }
+  }
+  ~Scoped_Stage()
+  {
+    if (stage_ >= 0) {
+      timer_.end(stage_);
+    }
+  }
+  Scoped_Stage(const Scoped_Stage&) = delete;
+  Scoped_Stage& operator=(const Scoped_Stage&) = delete;
+
+private:
+  Stage_Timer& timer_;
+  int stage_ = -1;
+};
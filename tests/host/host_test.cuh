@@ -0,0 +1,55 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Minimal checks for the host tests (make test_host in src). Each test is a
+program which returns 0 if all the checks pass.
+------------------------------------------------------------------------------*/
+
+#pragma once
+#include <cmath>
+#include <cstdio>
+
+static int num_failed_checks = 0;
+
+#define EXPECT(condition)                                                                          \
+  do {                                                                                             \
+    if (!(condition)) {                                                                            \
+      printf("    failed: %s (%s:%d)\n", #condition, __FILE__, __LINE__);                          \
+      ++num_failed_checks;                                                                         \
+    }                                                                                              \
+  } while (0)
+
+// |a - b| <= tolerance, printing the values on failure
+#define EXPECT_CLOSE(a, b, tolerance)                                                              \
+  do {                                                                                             \
+    const double a_ = (a);                                                                         \
+    const double b_ = (b);                                                                         \
+    if (!(std::fabs(a_ - b_) <= (tolerance))) {                                                    \
+      printf("    failed: %s = %.17g vs %s = %.17g", #a, a_, #b, b_);                              \
+      printf(" (%s:%d)\n", __FILE__, __LINE__);                                                    \
+      ++num_failed_checks;                                                                         \
+    }                                                                                              \
+  } while (0)
+
+inline int report_checks(const char* name)
+{
+  if (num_failed_checks == 0) {
+    printf("%-24s passed\n", name);
+    return 0;
+  }
+  printf("%-24s FAILED (%d checks)\n", name, num_failed_checks);
+  return 1;
+}
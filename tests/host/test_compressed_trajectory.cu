@@ -0,0 +1,283 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Round trip of the codec of dump_compressed (utilities/compressed_trajectory.cuh):
+the integers of single blocks with 0 to 64 bits, and a trajectory of key and
+delta frames, with velocities and with types changing in a key frame, which is
+encoded into a stream of frames and decoded as by ctraj2exyz, from the first
+frame and from the key frames. The decoded integers are bit-exact.
+------------------------------------------------------------------------------*/
+
+#include "host_test.cuh"
+#include "utilities/compressed_trajectory.cuh"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+const int N = 300; // not a multiple of CTRAJ_BLOCK_SIZE
+const int NUM_FRAMES = 20;
+const int KEY_INTERVAL = 6;
+const int TYPE_CHANGE_FRAME = 9; // a key frame between the regular ones
+const double PRECISION_POSITION = 1.0e-3;
+const double PRECISION_VELOCITY = 1.0e-5;
+
+struct Frame {
+  Ctraj_Frame_Header header;
+  std::vector<std::string> type_symbol;
+  std::vector<long long> type;
+  std::vector<long long> q_position;
+  std::vector<long long> q_velocity;
+  std::vector<unsigned char> payload;
+};
+
+// pack and unpack integers of the same bit width in all blocks, and check that truncated data
+// are rejected
+static void compare_integers(const std::vector<long long>& values, const int width)
+{
+  std::vector<unsigned char> out;
+  pack_integers(values.data(), values.size(), out);
+  size_t num_bytes = 0;
+  for (size_t begin = 0; begin < values.size(); begin += CTRAJ_BLOCK_SIZE) {
+    const size_t count = std::min(values.size() - begin, size_t(CTRAJ_BLOCK_SIZE));
+    EXPECT(out.size() > num_bytes && out[num_bytes] == width);
+    num_bytes += 1 + (count * width + 7) / 8;
+  }
+  EXPECT(out.size() == num_bytes);
+
+  std::vector<long long> decoded(values.size());
+  const unsigned char* in = out.data();
+  EXPECT(unpack_integers(in, out.data() + out.size(), decoded.size(), decoded.data()));
+  EXPECT(in == out.data() + out.size());
+  EXPECT(decoded == values);
+  if (!out.empty()) {
+    in = out.data();
+    EXPECT(!unpack_integers(in, out.data() + out.size() - 1, decoded.size(), decoded.data()));
+  }
+}
+
+// random walks in a box of 30 A with jumps over the box for a few atoms, and types and species
+// that change at TYPE_CHANGE_FRAME
+static std::vector<Frame> create_trajectory()
+{
+  std::mt19937 rng(12345);
+  std::uniform_real_distribution<double> uniform(0.0, 30.0);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  std::vector<double> position(N * 3), velocity(N * 3);
+  for (int i = 0; i < N * 3; ++i) {
+    position[i] = uniform(rng);
+  }
+  std::vector<std::string> type_symbol = {"Pb", "Te"};
+  std::vector<long long> type(N);
+  for (int n = 0; n < N; ++n) {
+    type[n] = n % 2;
+  }
+
+  std::vector<Frame> frames(NUM_FRAMES);
+  int frames_since_key = 0;
+  for (int frame = 0; frame < NUM_FRAMES; ++frame) {
+    for (int i = 0; i < N * 3; ++i) {
+      velocity[i] = 0.01 * normal(rng);
+      position[i] += 10.0 * velocity[i];
+    }
+    position[frame % N] -= 30.0;
+    if (frame == TYPE_CHANGE_FRAME) {
+      type_symbol.push_back("Sn");
+      for (int n = 0; n < N; n += 7) {
+        type[n] = 2;
+      }
+    }
+
+    Frame& f = frames[frame];
+    const bool is_type_changed = frame == 0 || frame == TYPE_CHANGE_FRAME;
+    f.header.is_key = (is_type_changed || frames_since_key >= KEY_INTERVAL) ? 1 : 0;
+    frames_since_key = f.header.is_key ? 1 : frames_since_key + 1;
+    f.header.step = (frame + 1) * 10;
+    f.header.number_of_atoms = N;
+    f.header.number_of_types = f.header.is_key ? type_symbol.size() : 0;
+    f.header.has_velocity = 1;
+    f.header.precision_position = PRECISION_POSITION;
+    f.header.precision_velocity = PRECISION_VELOCITY;
+    f.type_symbol = type_symbol;
+    f.type = type;
+    f.q_position.resize(N * 3);
+    f.q_velocity.resize(N * 3);
+    for (int i = 0; i < N * 3; ++i) {
+      f.q_position[i] = quantize(position[i], PRECISION_POSITION);
+      f.q_velocity[i] = quantize(velocity[i], PRECISION_VELOCITY);
+      const double error = std::fabs(f.q_position[i] * PRECISION_POSITION - position[i]);
+      EXPECT(error <= 0.5 * PRECISION_POSITION);
+    }
+  }
+  return frames;
+}
+
+// encode as in Dump_Compressed::write_frame() into one stream of headers and payloads
+static std::vector<unsigned char>
+encode(std::vector<Frame>& frames, std::vector<Ctraj_Index_Entry>& index)
+{
+  std::vector<unsigned char> stream;
+  std::vector<long long> work;
+  for (int frame = 0; frame < NUM_FRAMES; ++frame) {
+    Frame& f = frames[frame];
+    pack_frame(
+      f.header,
+      f.type_symbol,
+      f.type.data(),
+      f.q_position.data(),
+      frame > 0 ? frames[frame - 1].q_position.data() : nullptr,
+      f.q_velocity.data(),
+      work,
+      f.payload);
+    f.header.payload_size = f.payload.size();
+    Ctraj_Index_Entry entry;
+    entry.step = f.header.step;
+    entry.offset = stream.size();
+    entry.is_key = f.header.is_key;
+    index.push_back(entry);
+    const unsigned char* header_bytes = reinterpret_cast<const unsigned char*>(&f.header);
+    stream.insert(stream.end(), header_bytes, header_bytes + sizeof(f.header));
+    stream.insert(stream.end(), f.payload.begin(), f.payload.end());
+  }
+  return stream;
+}
+
+// decode as in ctraj2exyz from a key frame to the end of the stream and compare with the frames
+static void decode_and_compare(
+  const std::vector<unsigned char>& stream,
+  const std::vector<Ctraj_Index_Entry>& index,
+  const std::vector<Frame>& frames,
+  const int key_frame)
+{
+  std::vector<std::string> type_symbol;
+  std::vector<long long> type, q_position, q_position_previous, q_velocity;
+  long long offset = index[key_frame].offset;
+  for (int frame = key_frame; frame < NUM_FRAMES; ++frame) {
+    EXPECT(offset == index[frame].offset);
+    Ctraj_Frame_Header header;
+    memcpy(&header, stream.data() + offset, sizeof(header));
+    const unsigned char* in = stream.data() + offset + sizeof(header);
+    offset += sizeof(header) + header.payload_size;
+    EXPECT(header.is_valid() && header.step == index[frame].step);
+    EXPECT(header.is_key == index[frame].is_key);
+
+    q_position_previous.swap(q_position);
+    EXPECT(unpack_frame(
+      header,
+      in,
+      in + header.payload_size,
+      type_symbol,
+      type,
+      q_position_previous,
+      q_position,
+      q_velocity));
+    const Frame& f = frames[frame];
+    EXPECT(type_symbol == f.type_symbol);
+    EXPECT(type == f.type);
+    EXPECT(q_position == f.q_position);
+    EXPECT(q_velocity == f.q_velocity);
+
+    // a payload with missing or extra bytes is rejected
+    std::vector<long long> q_position_corrupt, q_velocity_corrupt;
+    std::vector<std::string> type_symbol_corrupt = type_symbol;
+    std::vector<long long> type_corrupt = type;
+    EXPECT(!unpack_frame(
+      header,
+      in,
+      in + header.payload_size - 1,
+      type_symbol_corrupt,
+      type_corrupt,
+      q_position_previous,
+      q_position_corrupt,
+      q_velocity_corrupt));
+    std::vector<unsigned char> payload(in, in + header.payload_size);
+    payload.push_back(0);
+    EXPECT(!unpack_frame(
+      header,
+      payload.data(),
+      payload.data() + payload.size(),
+      type_symbol_corrupt,
+      type_corrupt,
+      q_position_previous,
+      q_position_corrupt,
+      q_velocity_corrupt));
+  }
+  EXPECT(offset == (long long)stream.size());
+}
+
+int main()
+{
+  // single blocks with all the bit widths, and counts around the block size
+  std::mt19937_64 rng(54321);
+  for (int width = 0; width <= 64; ++width) {
+    std::vector<long long> values(CTRAJ_BLOCK_SIZE);
+    for (auto& value : values) {
+      const unsigned long long bits = (width == 64) ? rng() : rng() & ((1ULL << width) - 1);
+      value = zigzag_decode(bits);
+    }
+    if (width > 0) {
+      values[width % CTRAJ_BLOCK_SIZE] = zigzag_decode(1ULL << (width - 1)); // the largest one
+    }
+    compare_integers(values, width);
+  }
+  compare_integers({LLONG_MIN, LLONG_MAX, -1, 0, 1}, 64);
+  for (const int count : {0, 1, 127, 128, 129, 1000}) {
+    std::vector<long long> values(count);
+    for (int i = 0; i < count; ++i) {
+      values[i] = (i % 2 == 0) ? -1 : 0; // one bit in all blocks
+    }
+    compare_integers(values, count > 0 ? 1 : 0);
+  }
+
+  std::vector<Frame> frames = create_trajectory();
+  std::vector<Ctraj_Index_Entry> index;
+  const std::vector<unsigned char> stream = encode(frames, index);
+
+  int num_key_frames = 0;
+  for (int frame = 0; frame < NUM_FRAMES; ++frame) {
+    if (index[frame].is_key) {
+      decode_and_compare(stream, index, frames, frame);
+      ++num_key_frames;
+    }
+  }
+  EXPECT(num_key_frames == 4); // frames 0, 6, 9 (changed types), and 15
+  EXPECT(index[TYPE_CHANGE_FRAME].is_key == 1);
+  EXPECT(frames[TYPE_CHANGE_FRAME - 1].type_symbol.size() == 2);
+
+  // a delta frame cannot be decoded without the previous positions
+  std::vector<std::string> type_symbol;
+  std::vector<long long> type, q_position_previous, q_position, q_velocity;
+  const Frame& delta = frames[1];
+  EXPECT(!unpack_frame(
+    delta.header,
+    delta.payload.data(),
+    delta.payload.data() + delta.payload.size(),
+    type_symbol,
+    type,
+    q_position_previous,
+    q_position,
+    q_velocity));
+
+  printf(
+    "    %d frames of %d atoms with %d key frames: %.2f bytes per atom per frame\n",
+    NUM_FRAMES,
+    N,
+    num_key_frames,
+    double(stream.size()) / (NUM_FRAMES * N));
+  return report_checks("compressed_trajectory");
+}
@@ -0,0 +1,154 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Test of the blocked FFT correlation (Correlation) of compute_hac and
+compute_viscosity against the direct sum, with the series added in chunks of
+irregular sizes, with small block sizes, and with more lags than samples.
+------------------------------------------------------------------------------*/
+
+#include "host_test.cuh"
+#include "utilities/correlation.cuh"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+const int NUM_CHANNELS = 3;
+
+// a[c * Nd + n] with a nonzero mean, and b[n] correlated with a[n - 3]
+static void create_series(const int Nd, std::vector<double>& a, std::vector<double>& b)
+{
+  std::mt19937 rng(12345);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  a.resize(NUM_CHANNELS * Nd);
+  b.resize(NUM_CHANNELS * Nd);
+  for (int c = 0; c < NUM_CHANNELS; ++c) {
+    for (int n = 0; n < Nd; ++n) {
+      a[c * Nd + n] = 0.5 * c + normal(rng);
+    }
+    for (int n = 0; n < Nd; ++n) {
+      b[c * Nd + n] = (n >= 3 ? a[c * Nd + n - 3] : 0.0) + 0.5 * normal(rng);
+    }
+  }
+}
+
+// add samples [n_start, n_end) of the series, in the channel-major layout of a chunk
+static void add_chunk(
+  Correlation& correlation,
+  const int Nd,
+  const std::vector<double>& a,
+  const std::vector<double>& b,
+  const int n_start,
+  const int n_end)
+{
+  const int num_samples = n_end - n_start;
+  std::vector<double> a_chunk(NUM_CHANNELS * num_samples);
+  std::vector<double> b_chunk(NUM_CHANNELS * num_samples);
+  for (int c = 0; c < NUM_CHANNELS; ++c) {
+    std::copy(a.begin() + c * Nd + n_start, a.begin() + c * Nd + n_end, &a_chunk[c * num_samples]);
+    std::copy(b.begin() + c * Nd + n_start, b.begin() + c * Nd + n_end, &b_chunk[c * num_samples]);
+  }
+  correlation.add(a_chunk.data(), b_chunk.data(), num_samples);
+}
+
+// the largest difference from the direct sum over the first num_samples samples
+static double find_error(
+  Correlation& correlation,
+  const int Nd,
+  const int Nc,
+  const std::vector<double>& a,
+  const std::vector<double>& b,
+  const int num_samples)
+{
+  // the direct sum takes a contiguous series per channel
+  std::vector<double> a_prefix(NUM_CHANNELS * num_samples);
+  std::vector<double> b_prefix(NUM_CHANNELS * num_samples);
+  for (int c = 0; c < NUM_CHANNELS; ++c) {
+    std::copy(a.begin() + c * Nd, a.begin() + c * Nd + num_samples, &a_prefix[c * num_samples]);
+    std::copy(b.begin() + c * Nd, b.begin() + c * Nd + num_samples, &b_prefix[c * num_samples]);
+  }
+  std::vector<double> c_direct(NUM_CHANNELS * Nc);
+  Correlation::find_correlation_direct(
+    NUM_CHANNELS, Nc, num_samples, a_prefix.data(), b_prefix.data(), c_direct.data());
+
+  std::vector<double> c_fft(NUM_CHANNELS * Nc);
+  correlation.get_correlation(c_fft.data());
+  double error = 0.0;
+  for (int index = 0; index < NUM_CHANNELS * Nc; ++index) {
+    error = std::max(error, std::fabs(c_fft[index] - c_direct[index]));
+  }
+  return error;
+}
+
+// stream Nd samples in chunks of 1 to max_chunk samples (all at once for max_chunk = 0) and
+// compare with the direct sum, also at an intermediate point of the series
+static void compare(const int Nd, const int Nc, const int block_size, const int max_chunk)
+{
+  std::vector<double> a, b;
+  create_series(Nd, a, b);
+  Correlation correlation(NUM_CHANNELS, Nc, block_size);
+
+  std::mt19937 rng(54321);
+  std::uniform_int_distribution<int> chunk_size(1, std::max(max_chunk, 1));
+  const int n_middle = Nd / 2;
+  double error = 0.0;
+  int n = 0;
+  while (n < Nd) {
+    int n_end = (max_chunk > 0) ? std::min(Nd, n + chunk_size(rng)) : Nd;
+    if (n < n_middle && n_end > n_middle) {
+      // get_correlation in the middle of a block should not disturb the rest of the series
+      add_chunk(correlation, Nd, a, b, n, n_middle);
+      error = std::max(error, find_error(correlation, Nd, Nc, a, b, n_middle));
+      n = n_middle;
+    }
+    add_chunk(correlation, Nd, a, b, n, n_end);
+    n = n_end;
+  }
+  error = std::max(error, find_error(correlation, Nd, Nc, a, b, Nd));
+
+  EXPECT(error < 1.0e-12);
+  printf(
+    "    Nd = %5d, Nc = %4d, block size %4d, chunks of <= %4d: error %.1e\n",
+    Nd,
+    Nc,
+    correlation.block_size(),
+    max_chunk > 0 ? max_chunk : Nd,
+    error);
+}
+
+int main()
+{
+  // the default block size, with the series in one piece and in irregular chunks
+  compare(5000, 200, 0, 0);
+  compare(5000, 200, 0, 97);
+  compare(5000, 200, 0, 3000);
+
+  // small block sizes, down to one sample per block
+  compare(1000, 64, 1, 13);
+  compare(1000, 50, 7, 5);
+  compare(1000, 64, 65, 100);
+
+  // a single lag, where the history of a is empty
+  compare(300, 1, 0, 17);
+  compare(300, 1, 1, 17);
+
+  // more lags than samples: the lags k >= Nd have no time origin
+  compare(50, 200, 0, 9);
+  compare(50, 200, 3, 9);
+  compare(1, 10, 0, 0);
+
+  return report_checks("correlation");
+}
@@ -0,0 +1,111 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Test and benchmark of Cosine_Sum (chirp-z transform) against the direct sum,
+with the parameters of compute_dos (n0 = 0) and compute_shc (n0 = 1 - Nc).
+------------------------------------------------------------------------------*/
+
+#include "host_test.cuh"
+#include "utilities/fft.cuh"
+#include <chrono>
+#include <vector>
+
+static double get_wall_time()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+// a damped oscillation like a windowed correlation function
+static std::vector<double> create_input(const int num_inputs, const double n0)
+{
+  std::vector<double> x(num_inputs);
+  for (int n = 0; n < num_inputs; ++n) {
+    const double t = n + n0;
+    x[n] = exp(-std::fabs(t) * 0.01) * (cos(0.3 * t) + 0.5 * cos(1.7 * t + 0.2));
+  }
+  return x;
+}
+
+// compare the transform with the direct sum, relative to sum_n |x[n]|, and return the speedup
+static double compare(
+  const char* name,
+  const int num_inputs,
+  const int num_outputs,
+  const double theta_0,
+  const double d_theta,
+  const double n0,
+  const double tolerance)
+{
+  const Cosine_Sum cosine_sum(num_inputs, num_outputs, theta_0, d_theta, n0);
+  const std::vector<double> x = create_input(num_inputs, n0);
+  std::vector<double> y(num_outputs);
+  std::vector<double> y_direct(num_outputs);
+
+  const double time_0 = get_wall_time();
+  cosine_sum.transform(x.data(), y.data());
+  const double time_1 = get_wall_time();
+  cosine_sum.transform_direct(x.data(), y_direct.data());
+  const double time_2 = get_wall_time();
+
+  double norm = 0.0;
+  for (int n = 0; n < num_inputs; ++n) {
+    norm += std::fabs(x[n]);
+  }
+  double error = 0.0;
+  for (int k = 0; k < num_outputs; ++k) {
+    error = std::fmax(error, std::fabs(y[k] - y_direct[k]));
+  }
+  EXPECT(error <= tolerance * norm);
+  printf(
+    "    %-4s N = %6d, K = %6d: relative error %.2e, transform (%s) %.4f s, direct sum %.4f s\n",
+    name,
+    num_inputs,
+    num_outputs,
+    error / norm,
+    cosine_sum.uses_fft() ? "chirp-z" : "direct",
+    time_1 - time_0,
+    time_2 - time_1);
+  return (time_2 - time_1) / (time_1 - time_0);
+}
+
+int main()
+{
+  // small sizes use the direct sum
+  compare("dos", 10, 10, 0.01, 0.01, 0.0, 1.0e-15);
+  EXPECT(!Cosine_Sum(10, 10, 0.01, 0.01).uses_fft());
+
+  // compute_dos: omega = d_omega, 2 d_omega, ... with d_omega * dt = 2 pi * 400 THz / K * 5 fs
+  for (const int num_correlation_steps : {250, 1000, 4097}) {
+    const int num_dos_points = 1000;
+    const double d_theta = 2.0 * 3.141592653589793 * 400.0 / num_dos_points * 0.005;
+    compare("dos", num_correlation_steps, num_dos_points, d_theta, d_theta, 0.0, 1.0e-11);
+  }
+
+  // compute_shc: the correlation has 2 Nc - 1 points, from nc = 1 - Nc to Nc - 1
+  for (const int Nc : {100, 250, 1000}) {
+    const int num_omega = 1000;
+    const double d_theta = 2.0 * 3.141592653589793 * 400.0 / num_omega * 0.01;
+    compare("shc", 2 * Nc - 1, num_omega, d_theta, d_theta, 1 - Nc, 1.0e-11);
+  }
+
+  // benchmark: a long correlation with many frequencies
+  const double speedup = compare("dos", 8000, 8000, 1.0e-3, 1.0e-3, 0.0, 1.0e-10);
+  EXPECT(Cosine_Sum(8000, 8000, 1.0e-3, 1.0e-3).uses_fft());
+  printf("    speedup of the chirp-z transform: %.1f\n", speedup);
+
+  return report_checks("cosine_sum");
+}
@@ -0,0 +1,174 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Test of the factorized C6 of DFT-D3 (find_cn_weights and find_c6) against the
+Gaussian-weighted sum over all pairs of references it replaced, on a grid of
+coordination numbers for several element pairs, including the fallback to the
+last references for a vanishing weight sum.
+------------------------------------------------------------------------------*/
+
+#include "force/dftd3_c6.cuh"
+#include "host_test.cuh"
+#include <algorithm>
+#include <cmath>
+
+// C6 and dC6/dCN_1 of the direct sum in double precision, and the log of the weight sum
+static void find_c6_direct(
+  const int z1,
+  const int z2,
+  const double cn1,
+  const double cn2,
+  const float* c6_ref,
+  double& c6,
+  double& dc6,
+  double& log_weight_sum)
+{
+  const int num_references_1 = get_dftd3_num_references(z1);
+  const int num_references_2 = get_dftd3_num_references(z2);
+  double W = 0.0, dW = 0.0, Z = 0.0, dZ = 0.0;
+  for (int i = 0; i < num_references_1; ++i) {
+    for (int j = 0; j < num_references_2; ++j) {
+      const double diff_i = cn1 - cn_ref[z1 * max_cn + i];
+      const double diff_j = cn2 - cn_ref[z2 * max_cn + j];
+      const double L_ij = exp(-4.0 * (diff_i * diff_i + diff_j * diff_j));
+      W += L_ij;
+      dW += L_ij * (-8.0 * diff_i);
+      Z += c6_ref[i * max_cn + j] * L_ij;
+      dZ += c6_ref[i * max_cn + j] * L_ij * (-8.0 * diff_i);
+    }
+  }
+  log_weight_sum = log(W);
+  if (num_references_1 == 1 && num_references_2 == 1) {
+    c6 = c6_ref[0];
+    dc6 = 0.0;
+  } else if (W < 1.0e-30) {
+    c6 = c6_ref[(num_references_1 - 1) * max_cn + num_references_2 - 1];
+    dc6 = 0.0;
+  } else {
+    c6 = Z / W;
+    dc6 = dZ / W - c6 * dW / W;
+  }
+}
+
+// C6 and dC6/dCN_1 of the factorized form, as in the force kernels
+static void find_c6_factorized(
+  const int z1,
+  const int z2,
+  const float cn1,
+  const float cn2,
+  const float* c6_ref,
+  float& c6,
+  float& dc6)
+{
+  const int N = 2; // atom 1 and atom 2
+  float weight[max_cn * N];
+  float weight_derivative[max_cn * N];
+  float log_weight_sum[N];
+  const int num_references_1 = get_dftd3_num_references(z1);
+  const int num_references_2 = get_dftd3_num_references(z2);
+  find_cn_weights(z1, num_references_1, cn1, N, 0, weight, weight_derivative, log_weight_sum);
+  find_cn_weights(z2, num_references_2, cn2, N, 1, weight, weight_derivative, log_weight_sum);
+
+  float weight_1[max_cn];
+  float weight_derivative_1[max_cn];
+  for (int i = 0; i < num_references_1; ++i) {
+    weight_1[i] = weight[i * N + 0];
+    weight_derivative_1[i] = weight_derivative[i * N + 0];
+  }
+  find_c6(
+    num_references_1,
+    num_references_2,
+    c6_ref,
+    weight_1,
+    weight_derivative_1,
+    log_weight_sum[0],
+    N,
+    1,
+    weight,
+    log_weight_sum,
+    c6,
+    dc6);
+}
+
+static void compare(const int z1, const int z2)
+{
+  float c6_ref[max_cn2];
+  float c6_ref_swapped[max_cn2];
+  get_dftd3_c6_references(z1, z2, c6_ref);
+  get_dftd3_c6_references(z2, z1, c6_ref_swapped);
+  for (int i = 0; i < max_cn; ++i) {
+    for (int j = 0; j < max_cn; ++j) {
+      EXPECT(c6_ref[i * max_cn + j] == c6_ref_swapped[j * max_cn + i]);
+    }
+  }
+
+  double max_c6 = 0.0;
+  for (int k = 0; k < max_cn2; ++k) {
+    max_c6 = std::max(max_c6, double(c6_ref[k]));
+  }
+
+  double error_c6 = 0.0;
+  double error_dc6 = 0.0;
+  int num_fallbacks = 0;
+  for (int m1 = 0; m1 <= 60; ++m1) {
+    for (int m2 = 0; m2 <= 60; ++m2) {
+      const float cn1 = 0.2f * m1;
+      const float cn2 = 0.2f * m2;
+      double c6_direct, dc6_direct, log_weight_sum;
+      find_c6_direct(z1, z2, cn1, cn2, c6_ref, c6_direct, dc6_direct, log_weight_sum);
+      if (std::fabs(log_weight_sum - LOG_MIN_WEIGHT_SUM) < 1.0e-3) {
+        continue; // float and double may choose differently at the threshold
+      }
+      const bool has_weights = get_dftd3_num_references(z1) * get_dftd3_num_references(z2) > 1;
+      num_fallbacks += (has_weights && log_weight_sum < LOG_MIN_WEIGHT_SUM);
+
+      float c6, dc6;
+      find_c6_factorized(z1, z2, cn1, cn2, c6_ref, c6, dc6);
+      error_c6 = std::max(error_c6, std::fabs(c6 - c6_direct) / max_c6);
+      error_dc6 = std::max(error_dc6, std::fabs(dc6 - dc6_direct) / max_c6);
+
+      // the same pair seen from atom 2 has the same C6
+      float c6_swapped, dc6_swapped;
+      find_c6_factorized(z2, z1, cn2, cn1, c6_ref_swapped, c6_swapped, dc6_swapped);
+      error_c6 = std::max(error_c6, std::fabs(c6_swapped - c6_direct) / max_c6);
+    }
+  }
+
+  // relative to the largest reference C6 of the pair
+  EXPECT(error_c6 < 1.0e-5);
+  EXPECT(error_dc6 < 1.0e-4);
+  printf(
+    "    z = %2d, %2d (%d x %d references): error of C6 %.1e, of dC6/dCN %.1e, %d fallbacks\n",
+    z1 + 1,
+    z2 + 1,
+    get_dftd3_num_references(z1),
+    get_dftd3_num_references(z2),
+    error_c6,
+    error_dc6,
+    num_fallbacks);
+}
+
+int main()
+{
+  compare(0, 0);   // H-H
+  compare(5, 7);   // C-O
+  compare(5, 5);   // C-C
+  compare(1, 9);   // He-Ne, one reference each
+  compare(13, 25); // Si-Fe
+  compare(0, 93);  // H-Pu
+  compare(4, 80);  // B-Tl, five and four references
+  return report_checks("dftd3");
+}
@@ -0,0 +1,146 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Test of the grouping of atoms by a counting sort (Group::update_size and
+Group::find_contents) against the nested loops it replaced, on random labels
+with empty groups and for several numbers of threads, and of the bin labels of
+regroup (find_bin_label) in orthogonal and triclinic boxes.
+------------------------------------------------------------------------------*/
+
+#include "host_test.cuh"
+#include "main_gpumd/regroup.cuh"
+#include "model/group.cuh"
+#include <algorithm>
+#include <cmath>
+#include <omp.h>
+#include <random>
+#include <vector>
+
+// the sizes and contents as found by the nested loops before the counting sort
+static void find_group_direct(
+  const int N,
+  const int number,
+  const std::vector<int>& label,
+  std::vector<int>& size,
+  std::vector<int>& size_sum,
+  std::vector<int>& contents)
+{
+  size.assign(number, 0);
+  size_sum.assign(number, 0);
+  contents.assign(N, -1);
+  for (int n = 0; n < N; n++) {
+    size[label[n]]++;
+  }
+  for (int m = 1; m < number; m++) {
+    for (int n = 0; n < m; n++) {
+      size_sum[m] += size[n];
+    }
+  }
+  std::vector<int> offset(number, 0);
+  for (int n = 0; n < N; n++) {
+    for (int m = 0; m < number; m++) {
+      if (label[n] == m) {
+        contents[size_sum[m] + offset[m]++] = n;
+      }
+    }
+  }
+}
+
+// random labels, leaving every third group empty
+static void compare_group(const int N, const int number, const int num_threads)
+{
+  std::mt19937 rng(N + number);
+  std::uniform_int_distribution<int> random_group(0, number - 1);
+  Group group;
+  group.number = number;
+  group.cpu_label.resize(N);
+  for (int n = 0; n < N; ++n) {
+    int m = random_group(rng);
+    group.cpu_label[n] = (number > 1 && m % 3 == 1) ? m - 1 : m;
+  }
+
+  std::vector<int> size, size_sum, contents;
+  find_group_direct(N, number, group.cpu_label, size, size_sum, contents);
+
+  omp_set_num_threads(num_threads);
+  group.update_size(N);
+  group.find_contents(N);
+  EXPECT(group.cpu_size == size);
+  EXPECT(group.cpu_size_sum == size_sum);
+  EXPECT(group.cpu_contents == contents);
+}
+
+// positions r = h s from fractional coordinates s in [-0.5, 1.5), away from the bin edges, and
+// the expected bins of s along each direction
+static void compare_bin_label(Box& box, const int num_bins)
+{
+  std::mt19937 rng(54321);
+  std::uniform_real_distribution<double> uniform(-0.5, 1.5);
+  box.get_inverse();
+  for (int sample = 0; sample < 10000; ++sample) {
+    double s[3];
+    for (int d = 0; d < 3; ++d) {
+      do {
+        s[d] = uniform(rng);
+      } while (std::fabs(s[d] * num_bins - std::round(s[d] * num_bins)) < 1.0e-8);
+    }
+    double r[3];
+    for (int d = 0; d < 3; ++d) {
+      r[d] = (box.triclinic == 0) ? box.cpu_h[d] * s[d]
+                                  : box.cpu_h[d * 3] * s[0] + box.cpu_h[d * 3 + 1] * s[1] +
+                                      box.cpu_h[d * 3 + 2] * s[2];
+    }
+    const int pbc[3] = {box.pbc_x, box.pbc_y, box.pbc_z};
+    for (int d = 0; d < 3; ++d) {
+      int bin;
+      if (pbc[d]) {
+        bin = int(std::floor((s[d] - std::floor(s[d])) * num_bins));
+      } else {
+        bin = std::min(std::max(int(std::floor(s[d] * num_bins)), 0), num_bins - 1);
+      }
+      EXPECT(find_bin_label(box, d, num_bins, r[0], r[1], r[2]) == bin);
+    }
+  }
+}
+
+int main()
+{
+  for (const int num_threads : {1, 3, 8}) {
+    compare_group(1000, 7, num_threads);
+    compare_group(100000, 50, num_threads);
+    compare_group(10, 20, num_threads); // fewer atoms than groups
+    compare_group(1, 1, num_threads);
+  }
+
+  Box box;
+  box.triclinic = 0;
+  box.pbc_y = 0;
+  box.cpu_h[0] = 10.0;
+  box.cpu_h[1] = 20.0;
+  box.cpu_h[2] = 30.0;
+  compare_bin_label(box, 7);
+
+  const double h[9] = {10.0, 3.0, 1.0, 0.0, 12.0, 2.0, 0.0, 0.0, 15.0};
+  box.triclinic = 1;
+  box.pbc_y = 1;
+  box.pbc_z = 0;
+  for (int n = 0; n < 9; ++n) {
+    box.cpu_h[n] = h[n];
+  }
+  compare_bin_label(box, 5);
+
+  return report_checks("group");
+}
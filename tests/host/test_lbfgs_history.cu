@@ -0,0 +1,331 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Test of LBFGS_History (the two-loop recursion in terms of dot products) on
+analytic potentials: the search direction is compared with the usual two-loop
+recursion on explicit vectors, including after the history wraps around, and
+the minimizer built on it converges on an SPD quadratic and on the Rosenbrock
+function.
+------------------------------------------------------------------------------*/
+
+#include "host_test.cuh"
+#include "minimize/lbfgs_history.cuh"
+#include <random>
+#include <vector>
+
+typedef std::vector<double> Vector;
+
+static double dot(const Vector& a, const Vector& b)
+{
+  double sum = 0.0;
+  for (int n = 0; n < a.size(); ++n) {
+    sum += a[n] * b[n];
+  }
+  return sum;
+}
+
+class Potential
+{
+public:
+  virtual ~Potential() {}
+  virtual double find_energy_and_gradient(const Vector& x, Vector& gradient) const = 0;
+};
+
+// 0.5 x^T A x - b^T x with A = H D H, where H is a Householder reflection and the eigenvalues
+// D are from 1 to 50, such that the minimum is at x_min = A^{-1} b
+class Quadratic : public Potential
+{
+public:
+  Quadratic(const int n) : n_(n), a_(n * n), b_(n), x_min_(n)
+  {
+    std::mt19937 rng(2024);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    Vector v(n);
+    for (int i = 0; i < n; ++i) {
+      v[i] = uniform(rng);
+      x_min_[i] = uniform(rng);
+    }
+    const double v2 = dot(v, v);
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        double sum = 0.0;
+        for (int k = 0; k < n; ++k) {
+          const double h_ik = (i == k ? 1.0 : 0.0) - 2.0 * v[i] * v[k] / v2;
+          const double h_kj = (k == j ? 1.0 : 0.0) - 2.0 * v[k] * v[j] / v2;
+          sum += h_ik * (1.0 + 49.0 * k / (n - 1)) * h_kj;
+        }
+        a_[i * n + j] = sum;
+      }
+    }
+    for (int i = 0; i < n; ++i) {
+      b_[i] = 0.0;
+      for (int j = 0; j < n; ++j) {
+        b_[i] += a_[i * n + j] * x_min_[j];
+      }
+    }
+  }
+
+  const Vector& get_minimum() const { return x_min_; }
+
+  double find_energy_and_gradient(const Vector& x, Vector& gradient) const
+  {
+    double energy = 0.0;
+    gradient.resize(n_);
+    for (int i = 0; i < n_; ++i) {
+      double ax = 0.0;
+      for (int j = 0; j < n_; ++j) {
+        ax += a_[i * n_ + j] * x[j];
+      }
+      gradient[i] = ax - b_[i];
+      energy += 0.5 * x[i] * ax - b_[i] * x[i];
+    }
+    return energy;
+  }
+
+private:
+  int n_;
+  Vector a_;
+  Vector b_;
+  Vector x_min_;
+};
+
+// sum_i 100 (x_{i+1} - x_i^2)^2 + (1 - x_i)^2, minimum 0 at x = (1, ..., 1)
+class Rosenbrock : public Potential
+{
+public:
+  double find_energy_and_gradient(const Vector& x, Vector& gradient) const
+  {
+    const int n = x.size();
+    double energy = 0.0;
+    gradient.assign(n, 0.0);
+    for (int i = 0; i + 1 < n; ++i) {
+      const double u = x[i + 1] - x[i] * x[i];
+      const double v = 1.0 - x[i];
+      energy += 100.0 * u * u + v * v;
+      gradient[i] += -400.0 * x[i] * u - 2.0 * v;
+      gradient[i + 1] += 200.0 * u;
+    }
+    return energy;
+  }
+};
+
+// the usual two-loop recursion, with the pairs from the oldest to the newest
+static Vector find_direction_reference(
+  const std::vector<Vector>& s,
+  const std::vector<Vector>& y,
+  const std::vector<int>& order,
+  const Vector& force)
+{
+  const int k = order.size();
+  Vector q = force;
+  Vector alpha(k);
+  for (int i = k - 1; i >= 0; --i) {
+    const Vector& s_i = s[order[i]];
+    const Vector& y_i = y[order[i]];
+    alpha[i] = dot(s_i, q) / dot(s_i, y_i);
+    for (int n = 0; n < q.size(); ++n) {
+      q[n] -= alpha[i] * y_i[n];
+    }
+  }
+  if (k > 0) {
+    const Vector& s_newest = s[order[k - 1]];
+    const Vector& y_newest = y[order[k - 1]];
+    const double gamma = dot(s_newest, y_newest) / dot(y_newest, y_newest);
+    for (auto& v : q) {
+      v *= gamma;
+    }
+  }
+  for (int i = 0; i < k; ++i) {
+    const Vector& s_i = s[order[i]];
+    const Vector& y_i = y[order[i]];
+    const double beta = dot(y_i, q) / dot(s_i, y_i);
+    for (int n = 0; n < q.size(); ++n) {
+      q[n] += s_i[n] * (alpha[i] - beta);
+    }
+  }
+  return q;
+}
+
+// L-BFGS with a backtracking (Armijo) line search, keeping the vectors on the host as the
+// minimizer keeps them on the device; returns the number of iterations
+static int minimize(
+  const Potential& potential,
+  const int history_size,
+  const int maximum_iterations,
+  const double force_tolerance,
+  Vector& x,
+  int& num_wrapped)
+{
+  const int m = history_size;
+  const int dim = x.size();
+  LBFGS_History history;
+  history.resize(m);
+  std::vector<Vector> basis(history.get_number_of_basis(), Vector(dim, 0.0));
+  std::vector<Vector> s(m), y(m);
+
+  Vector gradient;
+  double energy = potential.find_energy_and_gradient(x, gradient);
+  num_wrapped = 0;
+  for (int iteration = 0; iteration < maximum_iterations; ++iteration) {
+    Vector& force = basis[history.get_force_slot()];
+    for (int n = 0; n < dim; ++n) {
+      force[n] = -gradient[n];
+    }
+    if (sqrt(dot(force, force)) < force_tolerance) {
+      return iteration;
+    }
+    for (int i = 0; i < history.get_number_of_basis(); ++i) {
+      history.set_dot(i, history.get_force_slot(), dot(basis[i], force));
+    }
+
+    // the direction from the dot products agrees with the explicit two-loop recursion
+    std::vector<double> delta;
+    history.find_coefficients(delta);
+    Vector direction(dim, 0.0);
+    for (int i = 0; i < history.get_number_of_basis(); ++i) {
+      for (int n = 0; n < dim; ++n) {
+        direction[n] += delta[i] * basis[i][n];
+      }
+    }
+    std::vector<int> order;
+    for (int k = 0; k < history.get_number_of_pairs(); ++k) {
+      order.push_back(history.get_slot(k));
+      s[order.back()] = basis[order.back()];
+      y[order.back()] = basis[m + order.back()];
+    }
+    const Vector reference = find_direction_reference(s, y, order, force);
+    const double scale = sqrt(dot(reference, reference));
+    for (int n = 0; n < dim; ++n) {
+      EXPECT_CLOSE(direction[n], reference[n], 1.0e-10 * scale);
+    }
+    if (dot(direction, force) <= 0.0) {
+      direction = force; // not a descent direction: restart
+      history.reset();
+    }
+
+    double step = 1.0;
+    Vector x_new(dim), gradient_new;
+    double energy_new = 0.0;
+    for (int trial = 0; trial < 60; ++trial) {
+      for (int n = 0; n < dim; ++n) {
+        x_new[n] = x[n] + step * direction[n];
+      }
+      energy_new = potential.find_energy_and_gradient(x_new, gradient_new);
+      if (energy_new <= energy - 1.0e-4 * step * dot(direction, force)) {
+        break;
+      }
+      step *= 0.5;
+    }
+
+    if (history.get_number_of_pairs() == m) {
+      ++num_wrapped;
+    }
+    const int slot = history.get_new_slot();
+    for (int n = 0; n < dim; ++n) {
+      basis[slot][n] = x_new[n] - x[n];
+      basis[m + slot][n] = gradient_new[n] - gradient[n];
+    }
+    for (int i = 0; i < history.get_number_of_basis(); ++i) {
+      history.set_dot(i, slot, dot(basis[i], basis[slot]));
+      history.set_dot(i, m + slot, dot(basis[i], basis[m + slot]));
+    }
+    history.push(slot);
+    x = x_new;
+    gradient = gradient_new;
+    energy = energy_new;
+  }
+  return maximum_iterations;
+}
+
+static void test_ring_buffer()
+{
+  LBFGS_History history;
+  history.resize(3);
+  EXPECT(history.get_number_of_basis() == 7 && history.get_force_slot() == 6);
+  for (int k = 0; k < 5; ++k) {
+    const int slot = history.get_new_slot();
+    EXPECT(slot == k % 3); // the oldest slot is reused once the history is full
+    history.set_dot(slot, 3 + slot, 1.0);
+    EXPECT(history.push(slot));
+  }
+  EXPECT(history.get_number_of_pairs() == 3);
+  EXPECT(history.get_slot(0) == 2 && history.get_slot(1) == 0 && history.get_slot(2) == 1);
+
+  // a pair with s * y <= 0 is dropped, and its slot is the next free one
+  const int slot = history.get_new_slot();
+  EXPECT(slot == 2);
+  history.set_dot(slot, 3 + slot, -1.0);
+  EXPECT(!history.push(slot));
+  EXPECT(history.get_number_of_pairs() == 2);
+  EXPECT(history.get_new_slot() == 2);
+
+  history.reset();
+  EXPECT(history.get_number_of_pairs() == 0);
+}
+
+static void test_quadratic()
+{
+  const int dim = 20;
+  const Quadratic quadratic(dim);
+
+  // a small history wraps around many times
+  Vector x(dim, 0.0);
+  int num_wrapped = 0;
+  const int num_iterations = minimize(quadratic, 3, 2000, 1.0e-6, x, num_wrapped);
+  EXPECT(num_iterations < 2000);
+  EXPECT(num_wrapped > 0);
+  Vector gradient;
+  quadratic.find_energy_and_gradient(x, gradient);
+  EXPECT(sqrt(dot(gradient, gradient)) < 1.0e-6);
+  for (int n = 0; n < dim; ++n) {
+    EXPECT_CLOSE(x[n], quadratic.get_minimum()[n], 1.0e-5);
+  }
+
+  // with as many pairs as dimensions, fewer iterations are needed
+  Vector x_full(dim, 0.0);
+  const int num_iterations_full = minimize(quadratic, dim, 2000, 1.0e-6, x_full, num_wrapped);
+  EXPECT(num_iterations_full <= num_iterations);
+  for (int n = 0; n < dim; ++n) {
+    EXPECT_CLOSE(x_full[n], quadratic.get_minimum()[n], 1.0e-5);
+  }
+  printf(
+    "    quadratic: %d iterations with 3 pairs, %d with %d pairs\n",
+    num_iterations,
+    num_iterations_full,
+    dim);
+}
+
+static void test_rosenbrock()
+{
+  const int dim = 10;
+  Vector x(dim, -1.0);
+  int num_wrapped = 0;
+  const int num_iterations = minimize(Rosenbrock(), 5, 5000, 1.0e-8, x, num_wrapped);
+  EXPECT(num_iterations < 5000);
+  EXPECT(num_wrapped > 0);
+  for (int n = 0; n < dim; ++n) {
+    EXPECT_CLOSE(x[n], 1.0, 1.0e-6);
+  }
+  printf("    rosenbrock: %d iterations with 5 pairs\n", num_iterations);
+}
+
+int main()
+{
+  test_ring_buffer();
+  test_quadratic();
+  test_rosenbrock();
+  return report_checks("lbfgs_history");
+}
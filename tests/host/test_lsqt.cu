@@ -0,0 +1,190 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Test of the block Chebyshev moments of LSQT (find_moments_chebyshev_host) on a
+small random Hermitian matrix in the CSR format: the moments of a block of R = 4
+states equal those of four runs with R = 1, and the R = 1 moments equal those
+of a dense Chebyshev recursion.
+------------------------------------------------------------------------------*/
+
+#include "host_test.cuh"
+#include "measure/lsqt_utilities.cuh"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+const int N = 30;  // number of orbitals
+const int R = 4;   // number of states in a block
+const int Nm = 40; // number of moments
+
+struct CSR_Matrix {
+  std::vector<int> row_ptr;
+  std::vector<int> col;
+  std::vector<double> Hr;
+  std::vector<double> Hi;
+  std::vector<double> U;
+  std::vector<std::complex<double>> dense; // dense[n * N + m] including U on the diagonal
+  double Em;
+};
+
+static CSR_Matrix create_hermitian_matrix(std::mt19937& rng)
+{
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  CSR_Matrix H;
+  H.dense.assign(N * N, 0.0);
+  for (int n = 0; n < N; ++n) {
+    for (int m = n + 1; m < N; ++m) {
+      if (uniform(rng) < -0.6) {
+        const std::complex<double> h(uniform(rng), uniform(rng));
+        H.dense[n * N + m] = h;
+        H.dense[m * N + n] = std::conj(h);
+      }
+    }
+  }
+
+  H.row_ptr.push_back(0);
+  H.U.resize(N);
+  double max_row_sum = 0.0;
+  for (int n = 0; n < N; ++n) {
+    H.U[n] = uniform(rng);
+    double row_sum = std::abs(H.U[n]);
+    for (int m = 0; m < N; ++m) {
+      if (m != n && H.dense[n * N + m] != 0.0) {
+        H.col.push_back(m);
+        H.Hr.push_back(H.dense[n * N + m].real());
+        H.Hi.push_back(H.dense[n * N + m].imag());
+        row_sum += std::abs(H.dense[n * N + m]);
+      }
+    }
+    H.dense[n * N + n] = H.U[n];
+    H.row_ptr.push_back(H.col.size());
+    max_row_sum = std::max(max_row_sum, row_sum);
+  }
+  H.Em = 1.1 * max_row_sum; // the spectrum of H / Em is within (-1, 1)
+  return H;
+}
+
+// moments[m] = Re <sl|T_m(H / Em)|sr> from a dense recursion of complex vectors
+static std::vector<double> find_moments_dense(
+  const CSR_Matrix& H,
+  const std::vector<std::complex<double>>& sl,
+  const std::vector<std::complex<double>>& sr)
+{
+  std::vector<double> moments(Nm);
+  std::vector<std::complex<double>> s0 = sr, s1(N), s2(N);
+  for (int m = 0; m < Nm; ++m) {
+    if (m >= 1) {
+      for (int n = 0; n < N; ++n) {
+        std::complex<double> hs = 0.0;
+        for (int k = 0; k < N; ++k) {
+          hs += H.dense[n * N + k] * (m == 1 ? s0[k] : s1[k]);
+        }
+        s2[n] = (m == 1) ? hs / H.Em : 2.0 * hs / H.Em - s0[n];
+      }
+      if (m >= 2) {
+        s0.swap(s1);
+      }
+      s1.swap(s2);
+    }
+    const std::vector<std::complex<double>>& s = (m == 0) ? s0 : s1;
+    std::complex<double> moment = 0.0;
+    for (int n = 0; n < N; ++n) {
+      moment += std::conj(sl[n]) * s[n];
+    }
+    moments[m] = moment.real();
+  }
+  return moments;
+}
+
+int main()
+{
+  std::mt19937 rng(12345);
+  CSR_Matrix H = create_hermitian_matrix(rng);
+  EXPECT(H.col.size() > N); // not a trivially sparse matrix
+
+  // R states stored as s[n * R + r], with a different left and right state
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  std::vector<double> slr(N * R), sli(N * R), srr(N * R), sri(N * R);
+  for (int index = 0; index < N * R; ++index) {
+    slr[index] = uniform(rng);
+    sli[index] = uniform(rng);
+    srr[index] = uniform(rng);
+    sri[index] = uniform(rng);
+  }
+
+  std::vector<double> moments_block(Nm * R);
+  find_moments_chebyshev_host(
+    N,
+    R,
+    Nm,
+    H.Em,
+    H.row_ptr.data(),
+    H.col.data(),
+    H.U.data(),
+    H.Hr.data(),
+    H.Hi.data(),
+    slr.data(),
+    sli.data(),
+    srr.data(),
+    sri.data(),
+    moments_block.data());
+
+  double error_block = 0.0;
+  double error_dense = 0.0;
+  for (int r = 0; r < R; ++r) {
+    std::vector<double> slr_r(N), sli_r(N), srr_r(N), sri_r(N);
+    std::vector<std::complex<double>> sl(N), sr(N);
+    for (int n = 0; n < N; ++n) {
+      slr_r[n] = slr[n * R + r];
+      sli_r[n] = sli[n * R + r];
+      srr_r[n] = srr[n * R + r];
+      sri_r[n] = sri[n * R + r];
+      sl[n] = std::complex<double>(slr_r[n], sli_r[n]);
+      sr[n] = std::complex<double>(srr_r[n], sri_r[n]);
+    }
+
+    std::vector<double> moments_single(Nm);
+    find_moments_chebyshev_host(
+      N,
+      1,
+      Nm,
+      H.Em,
+      H.row_ptr.data(),
+      H.col.data(),
+      H.U.data(),
+      H.Hr.data(),
+      H.Hi.data(),
+      slr_r.data(),
+      sli_r.data(),
+      srr_r.data(),
+      sri_r.data(),
+      moments_single.data());
+    std::vector<double> moments_dense = find_moments_dense(H, sl, sr);
+
+    for (int m = 0; m < Nm; ++m) {
+      // the same operations in the same order: the block path is bit-exact
+      error_block = std::max(error_block, std::abs(moments_block[m * R + r] - moments_single[m]));
+      error_dense = std::max(error_dense, std::abs(moments_single[m] - moments_dense[m]));
+    }
+  }
+
+  printf("    block vs single %.1e, single vs dense %.1e\n", error_block, error_dense);
+  EXPECT(error_block == 0.0);
+  EXPECT(error_dense < 1.0e-12);
+  return report_checks("lsqt");
+}
@@ -0,0 +1,156 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Test of the multi-tau scheduling (Multi_Tau) of compute_msd and compute_sdc on
+a random walk: with one level it reproduces the linear method, and with several
+levels each lag is the direct average over the time origins of its level.
+------------------------------------------------------------------------------*/
+
+#include "host_test.cuh"
+#include "measure/multi_tau.cuh"
+#include <random>
+#include <vector>
+
+const int NUM_PARTICLES = 20;
+
+// positions[s * NUM_PARTICLES + i] of a 1D random walk with unit steps
+static std::vector<double> create_random_walk(const int num_samples)
+{
+  std::mt19937 rng(12345);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  std::vector<double> positions(num_samples * NUM_PARTICLES);
+  for (int i = 0; i < NUM_PARTICLES; ++i) {
+    positions[i] = 0.0;
+    for (int s = 1; s < num_samples; ++s) {
+      positions[s * NUM_PARTICLES + i] = positions[(s - 1) * NUM_PARTICLES + i] + normal(rng);
+    }
+  }
+  return positions;
+}
+
+static double
+find_square_displacement(const std::vector<double>& positions, const int s, const int t)
+{
+  double sum = 0.0;
+  for (int i = 0; i < NUM_PARTICLES; ++i) {
+    const double dx = positions[s * NUM_PARTICLES + i] - positions[t * NUM_PARTICLES + i];
+    sum += dx * dx;
+  }
+  return sum;
+}
+
+// the MSD as accumulated by compute_msd: a ring buffer of Nc frames per level, and each new
+// frame of a full level is correlated with the Nc frames of the level
+static std::vector<double> find_msd_multi_tau(
+  Multi_Tau& multi_tau,
+  const int num_correlation_steps,
+  const int num_samples,
+  const std::vector<double>& positions)
+{
+  const int Nc = num_correlation_steps;
+  multi_tau.initialize(Nc);
+  std::vector<int> ring(Nc * multi_tau.num_levels(), -1); // the sample held by each slot
+  std::vector<double> msd(Nc * multi_tau.num_levels(), 0.0);
+  std::vector<Multi_Tau::Update> updates;
+  for (int s = 0; s < num_samples; ++s) {
+    multi_tau.get_updates(s, updates);
+    for (const auto& update : updates) {
+      int* ring_level = ring.data() + update.level * Nc;
+      ring_level[update.slot] = s;
+      if (update.is_full) {
+        for (int j = 0; j < Nc; ++j) {
+          const int t = ring_level[(update.slot - j + Nc) % Nc];
+          EXPECT(s - t == multi_tau.get_lag(update.level, j));
+          msd[update.level * Nc + j] += find_square_displacement(positions, s, t);
+        }
+      }
+    }
+  }
+  for (int level = 0; level < multi_tau.num_levels(); ++level) {
+    for (int j = 0; j < Nc; ++j) {
+      msd[level * Nc + j] /= NUM_PARTICLES * double(multi_tau.num_time_origins(level));
+    }
+  }
+  return msd;
+}
+
+static void test_one_level()
+{
+  const int Nc = 50;
+  const int num_samples = 1000;
+  const std::vector<double> positions = create_random_walk(num_samples);
+  Multi_Tau multi_tau; // one level by default
+  const std::vector<double> msd = find_msd_multi_tau(multi_tau, Nc, num_samples, positions);
+
+  // the linear method: every sample from Nc - 1 on is a time origin for all the lags
+  EXPECT(multi_tau.num_levels() == 1);
+  EXPECT(multi_tau.num_time_origins(0) == num_samples - Nc + 1);
+  for (int k = 0; k < Nc; ++k) {
+    double msd_linear = 0.0;
+    for (int s = Nc - 1; s < num_samples; ++s) {
+      msd_linear += find_square_displacement(positions, s, s - k);
+    }
+    msd_linear /= NUM_PARTICLES * double(num_samples - Nc + 1);
+    EXPECT_CLOSE(msd[k], msd_linear, 1.0e-12 * (msd_linear + 1.0));
+  }
+}
+
+static void test_levels()
+{
+  const int Nc = 10;
+  const int num_levels = 4;
+  const int num_samples = 25000;
+  const std::vector<double> positions = create_random_walk(num_samples);
+
+  Multi_Tau multi_tau;
+  const char* param[] = {"compute_msd", "1", "10", "multi_tau", "4"};
+  int k = 3;
+  multi_tau.parse(param, 5, k, Nc);
+  EXPECT(k == 4);
+  EXPECT(multi_tau.num_levels() == num_levels);
+  const std::vector<double> msd = find_msd_multi_tau(multi_tau, Nc, num_samples, positions);
+  EXPECT(multi_tau.get_lag(num_levels - 1, Nc - 1) == 9000);
+
+  // level l: the samples which are multiples of Nc^l, once Nc frames of the level are stored
+  long long stride = 1;
+  for (int level = 0; level < num_levels; ++level) {
+    int num_time_origins = 0;
+    for (int s = (Nc - 1) * stride; s < num_samples; s += stride) {
+      ++num_time_origins;
+    }
+    EXPECT(multi_tau.num_time_origins(level) == num_time_origins);
+    for (int j = multi_tau.first_lag_index(level); j < Nc; ++j) {
+      double msd_direct = 0.0;
+      for (int s = (Nc - 1) * stride; s < num_samples; s += stride) {
+        msd_direct += find_square_displacement(positions, s, s - j * stride);
+      }
+      msd_direct /= NUM_PARTICLES * double(num_time_origins);
+      EXPECT_CLOSE(msd[level * Nc + j], msd_direct, 1.0e-12 * (msd_direct + 1.0));
+    }
+    stride *= Nc;
+  }
+
+  // a random walk with unit steps: MSD = lag, within the statistical error
+  const double msd_per_lag = msd[(num_levels - 1) * Nc + 1] / multi_tau.get_lag(num_levels - 1, 1);
+  EXPECT(msd_per_lag > 0.5 && msd_per_lag < 1.5);
+}
+
+int main()
+{
+  test_one_level();
+  test_levels();
+  return report_checks("multi_tau");
+}
@@ -0,0 +1,172 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Test of the host evaluator of nep (NEP3_CPU, prediction 2) against the GPU:
+the first structures of examples/11_NEP_potential_PbTe are evaluated with the
+nep.txt of the example, in two batches, and the energies, forces and virials
+are compared with the energy_train.out, force_train.out and virial_train.out
+written by the GPU version and shipped with the example. These are printed
+with 6 significant digits, which sets the tolerances.
+------------------------------------------------------------------------------*/
+
+#include "host_test.cuh"
+#include "main_nep/nep3_cpu.cuh"
+#include "main_nep/parameters.cuh"
+#include "main_nep/structure.cuh"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+const std::string EXAMPLE = "../../examples/11_NEP_potential_PbTe/";
+const char* WORK_DIRECTORY = "nep_cpu_work";
+const int NUM_EXAMPLE_STRUCTURES = 25; // virial_train.out of the GPU has 25 xx, then 25 yy, ...
+const int NUM_STRUCTURES = 4;          // the first structures of the example, of 250 atoms each
+const double ENERGY_TOLERANCE = 5.0e-5;   // eV/atom
+const double FORCE_TOLERANCE = 5.0e-4;    // eV/A
+const double VIRIAL_TOLERANCE = 5.0e-5;   // eV/atom
+
+static std::vector<std::vector<double>> read_table(const std::string& file_name)
+{
+  std::vector<std::vector<double>> table;
+  std::ifstream input(file_name);
+  std::string line;
+  while (std::getline(input, line)) {
+    std::istringstream stream(line);
+    std::vector<double> row;
+    double value;
+    while (stream >> value) {
+      row.push_back(value);
+    }
+    table.push_back(row);
+  }
+  return table;
+}
+
+// nep.in, nep.txt, and the first NUM_STRUCTURES structures of train.xyz in the work directory
+static void prepare_inputs()
+{
+  const std::string work = std::string(WORK_DIRECTORY) + "/";
+  std::ofstream nep_in(work + "nep.in");
+  nep_in << "type 2 Te Pb\nprediction 2\nbatch 3\n";
+  nep_in.close();
+
+  std::ifstream nep_txt_in(EXAMPLE + "nep.txt");
+  std::ofstream nep_txt_out(work + "nep.txt");
+  nep_txt_out << nep_txt_in.rdbuf();
+  nep_txt_out.close();
+
+  std::ifstream train_in(EXAMPLE + "train.xyz");
+  std::ofstream train_out(work + "train.xyz");
+  std::string line;
+  for (int n = 0; n < NUM_STRUCTURES; ++n) {
+    std::getline(train_in, line);
+    const int num_atoms = std::stoi(line);
+    train_out << line << "\n";
+    for (int m = 0; m < num_atoms + 1; ++m) {
+      std::getline(train_in, line);
+      train_out << line << "\n";
+    }
+  }
+}
+
+static void remove_files()
+{
+  for (const char* file : {"nep.in",
+                           "nep.txt",
+                           "train.xyz",
+                           "energy_train.out",
+                           "force_train.out",
+                           "virial_train.out",
+                           "stress_train.out"}) {
+    remove(file);
+  }
+}
+
+int main()
+{
+  const auto energy_gpu = read_table(EXAMPLE + "energy_train.out");
+  const auto force_gpu = read_table(EXAMPLE + "force_train.out");
+  const auto virial_gpu = read_table(EXAMPLE + "virial_train.out");
+  EXPECT(energy_gpu.size() == NUM_EXAMPLE_STRUCTURES);
+  EXPECT(virial_gpu.size() == 6 * NUM_EXAMPLE_STRUCTURES);
+
+  mkdir(WORK_DIRECTORY, 0755);
+  prepare_inputs();
+  if (chdir(WORK_DIRECTORY) != 0) {
+    printf("    cannot create %s\n", WORK_DIRECTORY);
+    return 1;
+  }
+  {
+    Parameters para;
+    std::vector<Structure> structures;
+    read_structures(true, para, structures);
+    std::vector<float> parameters(para.number_of_variables);
+    para.read_nep_txt(parameters.data());
+    NEP3_CPU potential(para);
+    potential.predict(para, parameters.data(), structures);
+  }
+  const auto energy_cpu = read_table("energy_train.out");
+  const auto force_cpu = read_table("force_train.out");
+  const auto virial_cpu = read_table("virial_train.out");
+  remove_files();
+  if (chdir("..") != 0 || rmdir(WORK_DIRECTORY) != 0) {
+    printf("    cannot remove %s\n", WORK_DIRECTORY);
+  }
+
+  // the first column is the prediction and the others are the reference data
+  EXPECT(energy_cpu.size() == NUM_STRUCTURES);
+  double error_energy = 0.0;
+  for (int n = 0; n < energy_cpu.size() && n < NUM_STRUCTURES; ++n) {
+    error_energy = std::fmax(error_energy, std::fabs(energy_cpu[n][0] - energy_gpu[n][0]));
+  }
+
+  int num_atoms = 0;
+  double error_force = 0.0;
+  for (int n = 0; n < force_cpu.size() && n < force_gpu.size(); ++n) {
+    for (int d = 0; d < 3; ++d) {
+      error_force = std::fmax(error_force, std::fabs(force_cpu[n][d] - force_gpu[n][d]));
+    }
+    ++num_atoms;
+  }
+  EXPECT(num_atoms == force_cpu.size() && num_atoms == NUM_STRUCTURES * 250);
+
+  // virial_train.out of nep_cpu has one structure per line (xx, yy, zz, xy, yz, zx)
+  EXPECT(virial_cpu.size() == NUM_STRUCTURES);
+  double error_virial = 0.0;
+  for (int n = 0; n < virial_cpu.size() && n < NUM_STRUCTURES; ++n) {
+    for (int d = 0; d < 6; ++d) {
+      const double gpu = virial_gpu[d * NUM_EXAMPLE_STRUCTURES + n][0];
+      error_virial = std::fmax(error_virial, std::fabs(virial_cpu[n][d] - gpu));
+    }
+  }
+
+  printf(
+    "    %d structures, %d atoms: error of energy %.1e eV/atom, force %.1e eV/A, "
+    "virial %.1e eV/atom\n",
+    NUM_STRUCTURES,
+    num_atoms,
+    error_energy,
+    error_force,
+    error_virial);
+  EXPECT(error_energy < ENERGY_TOLERANCE);
+  EXPECT(error_force < FORCE_TOLERANCE);
+  EXPECT(error_virial < VIRIAL_TOLERANCE);
+  return report_checks("nep_cpu");
+}
@@ -0,0 +1,117 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Test of the normal-mode transform of PIMD (PIMD_Normal_Modes): the real FFT
+agrees with the matrix form in both directions for P = 2, 4, ..., 128 beads,
+and the matrix form is orthogonal for all even P.
+------------------------------------------------------------------------------*/
+
+#include "host_test.cuh"
+#include "integrate/pimd_normal_modes.cuh"
+#include <random>
+#include <vector>
+
+// PI in utilities/common.cuh has 15 digits, which limits the accuracy of the phases 2 pi j k / P
+// of the matrix form, and the FFT (using phases 2 pi m / P) agrees with it to about 1e-12 for
+// P = 128 only
+const double TOLERANCE = 1.0e-11;
+
+static double find_max_difference(const std::vector<double>& a, const std::vector<double>& b)
+{
+  double difference = 0.0;
+  for (int n = 0; n < a.size(); ++n) {
+    difference = std::fmax(difference, std::fabs(a[n] - b[n]));
+  }
+  return difference;
+}
+
+static void test_number_of_beads(const int P, std::mt19937& rng)
+{
+  std::vector<double> transformation_matrix(P * P);
+  std::vector<double> twiddle(P * 2);
+  PIMD_Normal_Modes::find_transformation_matrix(P, transformation_matrix.data());
+  PIMD_Normal_Modes::find_twiddle(P, twiddle.data());
+
+  PIMD_Normal_Modes matrix;
+  matrix.number_of_beads = P;
+  matrix.use_fft = false;
+  matrix.transformation_matrix = transformation_matrix.data();
+  matrix.twiddle = twiddle.data();
+
+  // C^T C = I
+  double orthogonality_error = 0.0;
+  for (int k1 = 0; k1 < P; ++k1) {
+    for (int k2 = 0; k2 < P; ++k2) {
+      double sum = 0.0;
+      for (int j = 0; j < P; ++j) {
+        sum += transformation_matrix[j * P + k1] * transformation_matrix[j * P + k2];
+      }
+      orthogonality_error = std::fmax(orthogonality_error, std::fabs(sum - (k1 == k2)));
+    }
+  }
+  EXPECT(orthogonality_error < TOLERANCE);
+
+  // the normal modes are written with the stride of the 3 directions, as in Ensemble_PIMD
+  const int stride = 3;
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  std::vector<double> x(P), q(P * stride), x_back(P);
+  for (auto& v : x) {
+    v = uniform(rng);
+  }
+  matrix.to_normal_modes(x.data(), q.data() + 1, stride);
+  matrix.from_normal_modes(q.data() + 1, stride, x_back.data());
+  EXPECT(find_max_difference(x, x_back) < TOLERANCE);
+
+  if ((P & (P - 1)) != 0) {
+    return;
+  }
+  PIMD_Normal_Modes fft = matrix;
+  fft.use_fft = true;
+  EXPECT(PIMD_Normal_Modes::is_fft_faster(P) == (P >= 16));
+
+  // q = C^T x
+  std::vector<double> q_matrix(P), q_fft(P);
+  for (int k = 0; k < P; ++k) {
+    q_matrix[k] = q[k * stride + 1];
+  }
+  fft.to_normal_modes(x.data(), q.data() + 1, stride);
+  for (int k = 0; k < P; ++k) {
+    q_fft[k] = q[k * stride + 1];
+  }
+  const double error_to = find_max_difference(q_fft, q_matrix);
+  EXPECT(error_to < TOLERANCE);
+
+  // x = C q, for random normal modes
+  for (auto& v : q) {
+    v = uniform(rng);
+  }
+  std::vector<double> x_matrix(P), x_fft(P);
+  matrix.from_normal_modes(q.data() + 1, stride, x_matrix.data());
+  fft.from_normal_modes(q.data() + 1, stride, x_fft.data());
+  const double error_from = find_max_difference(x_fft, x_matrix);
+  EXPECT(error_from < TOLERANCE);
+
+  printf("    P = %3d: FFT vs matrix %.1e (to), %.1e (from)\n", P, error_to, error_from);
+}
+
+int main()
+{
+  std::mt19937 rng(7);
+  for (int P = 2; P <= MAX_NUM_BEADS; P += 2) {
+    test_number_of_beads(P, rng);
+  }
+  return report_checks("pimd_normal_modes");
+}
@@ -0,0 +1,239 @@
+/*
+    Copyright 2017 Zheyong Fan, Ville Vierimaa, Mikko Ervasti, and Ari Harju
+    This file is part of GPUMD.
+    GPUMD is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    GPUMD is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with GPUMD.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*----------------------------------------------------------------------------80
+Test of Stage_Timer and Scoped_Stage: accumulation of nested stages, call
+counts, the disabled path and the trace file.
+------------------------------------------------------------------------------*/
+
+#include "host_test.cuh"
+#include "utilities/stage_timer.cuh"
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+
+static void wait_ms(const int ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+static int find(const Stage_Timer& timer, const char* name, const int parent)
+{
+  const std::vector<Stage_Timer::Stage>& stages = timer.get_stages();
+  for (int k = 0; k < stages.size(); ++k) {
+    if (stages[k].name == name && stages[k].parent == parent) {
+      return k;
+    }
+  }
+  return -1;
+}
+
+// a minimal JSON parser, which only checks the syntax
+struct Json_Checker {
+  const char* p;
+
+  void skip_space()
+  {
+    while (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t') {
+      ++p;
+    }
+  }
+  bool string()
+  {
+    if (*p != '"') {
+      return false;
+    }
+    for (++p; *p != '"'; ++p) {
+      if (*p == '\0' || *p == '\n') {
+        return false;
+      }
+      if (*p == '\\') {
+        ++p;
+      }
+    }
+    ++p;
+    return true;
+  }
+  bool number()
+  {
+    char* end;
+    strtod(p, &end);
+    if (end == p) {
+      return false;
+    }
+    p = end;
+    return true;
+  }
+  bool sequence(const char close, const bool is_object)
+  {
+    ++p;
+    skip_space();
+    if (*p == close) {
+      ++p;
+      return true;
+    }
+    while (true) {
+      if (is_object) {
+        skip_space();
+        if (!string()) {
+          return false;
+        }
+        skip_space();
+        if (*p++ != ':') {
+          return false;
+        }
+      }
+      if (!value()) {
+        return false;
+      }
+      skip_space();
+      if (*p == ',') {
+        ++p;
+      } else if (*p == close) {
+        ++p;
+        return true;
+      } else {
+        return false;
+      }
+    }
+  }
+  bool value()
+  {
+    skip_space();
+    if (*p == '{') {
+      return sequence('}', true);
+    }
+    if (*p == '[') {
+      return sequence(']', false);
+    }
+    if (*p == '"') {
+      return string();
+    }
+    return number();
+  }
+  bool document()
+  {
+    if (!value()) {
+      return false;
+    }
+    skip_space();
+    return *p == '\0';
+  }
+};
+
+static std::string read_file(const char* filename)
+{
+  std::string content;
+  FILE* fid = fopen(filename, "r");
+  if (fid == NULL) {
+    return content;
+  }
+  char buffer[4096];
+  size_t count;
+  while ((count = fread(buffer, 1, sizeof(buffer), fid)) > 0) {
+    content.append(buffer, count);
+  }
+  fclose(fid);
+  return content;
+}
+
+static int count(const std::string& text, const std::string& pattern)
+{
+  int n = 0;
+  for (size_t k = text.find(pattern); k != std::string::npos; k = text.find(pattern, k + 1)) {
+    ++n;
+  }
+  return n;
+}
+
+static void test_disabled()
+{
+  Stage_Timer timer;
+  timer.start_run();
+  for (int step = 0; step < 3; ++step) {
+    timer.start_step(step);
+    Scoped_Stage stage(timer, "force");
+  }
+  EXPECT(!timer.is_enabled());
+  EXPECT(timer.get_stages().empty());
+  EXPECT(timer.begin("force") == -1);
+}
+
+static void test_nested_stages()
+{
+  const int num_steps = 4;
+  const int num_trace_steps = 2;
+  Stage_Timer timer;
+  const char* param[] = {"timing", "trace", "2"};
+  timer.parse(param, 3);
+  timer.start_run();
+  for (int step = 0; step < num_steps; ++step) {
+    timer.start_step(step);
+    {
+      Scoped_Stage force(timer, "force");
+      {
+        Scoped_Stage neighbor(timer, "neighbor");
+        wait_ms(2);
+      }
+      {
+        Scoped_Stage neighbor(timer, "neighbor"); // the same stage, timed twice per step
+        wait_ms(1);
+      }
+      wait_ms(1);
+    }
+    Scoped_Stage neighbor(timer, "neighbor"); // a top-level stage with the same name
+  }
+
+  const std::vector<Stage_Timer::Stage>& stages = timer.get_stages();
+  EXPECT(stages.size() == 3);
+  const int force = find(timer, "force", -1);
+  const int neighbor_in_force = find(timer, "neighbor", force);
+  const int neighbor = find(timer, "neighbor", -1);
+  EXPECT(force >= 0 && neighbor_in_force >= 0 && neighbor >= 0);
+  if (force < 0 || neighbor_in_force < 0 || neighbor < 0) {
+    return;
+  }
+  EXPECT(stages[force].calls == num_steps);
+  EXPECT(stages[neighbor_in_force].calls == 2 * num_steps);
+  EXPECT(stages[neighbor].calls == num_steps);
+  EXPECT(stages[force].depth == 0 && stages[neighbor_in_force].depth == 1);
+  // sleep_for waits at least the given time
+  EXPECT(stages[neighbor_in_force].total >= 3.0e-3 * num_steps);
+  EXPECT(stages[force].total >= stages[neighbor_in_force].total + 1.0e-3 * num_steps);
+
+  remove("timing_trace.json");
+  timer.finish_run(num_steps, 1);
+  EXPECT(!timer.is_enabled());
+
+  // 4 events in each traced step
+  const std::string trace = read_file("timing_trace.json");
+  Json_Checker checker = {trace.c_str()};
+  EXPECT(checker.document());
+  EXPECT(count(trace, "\"ph\": \"X\"") == 4 * num_trace_steps);
+  EXPECT(count(trace, "\"name\": \"neighbor\"") == 3 * num_trace_steps);
+  remove("timing_trace.json");
+
+  // timing is only effective for one run
+  timer.start_run();
+  {
+    Scoped_Stage stage(timer, "force");
+  }
+  EXPECT(timer.get_stages().empty());
+}
+
+int main()
+{
+  test_disabled();
+  test_nested_stages();
+  return report_checks("stage_timer");
+}
@@ -1,3 +1,6 @@
+echo "#### host tests"
+make -s -C ../src test_host
+
 cd gpumd/graphene_dos
 echo "#### graphene_dos"
 ../../../src/gpumd > /dev/null
@@ -0,0 +1,185 @@
+/*
+    Convert the compressed trajectory (dump.ctraj) written by the dump_compressed
+    keyword of gpumd into the extended XYZ format.
+
+    Compile with "g++ -O3 -I../../src ctraj2exyz.cpp -o ctraj2exyz" and run with
+        ./ctraj2exyz dump.ctraj dump.xyz [first_frame [last_frame]]
+    where the frames are counted from 0 and last_frame is included. If the index
+    file (dump.ctraj.idx) exists, the reader seeks directly to the key frame
+    preceding first_frame; otherwise it skips the frame headers one by one.
+*/
+
+#include "utilities/compressed_trajectory.cuh"
+#include <cmath>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+static void seek(FILE* fid, const long long offset)
+{
+#ifdef _WIN32
+  _fseeki64(fid, offset, SEEK_SET);
+#else
+  fseeko(fid, offset, SEEK_SET);
+#endif
+}
+
+// offsets of all the frames, from the index file or by skipping the payloads
+static void find_frames(
+  const std::string& filename, std::vector<long long>& offsets, std::vector<int>& is_key)
+{
+  FILE* fid_index = fopen((filename + ".idx").c_str(), "rb");
+  if (fid_index != NULL) {
+    Ctraj_Index_Entry entry;
+    while (fread(&entry, sizeof(entry), 1, fid_index) == 1) {
+      offsets.push_back(entry.offset);
+      is_key.push_back(entry.is_key);
+    }
+    fclose(fid_index);
+    return;
+  }
+
+  FILE* fid = fopen(filename.c_str(), "rb");
+  if (fid == NULL) {
+    printf("Failed to open %s.\n", filename.c_str());
+    exit(1);
+  }
+  Ctraj_Frame_Header header;
+  long long offset = 0;
+  while (fread(&header, sizeof(header), 1, fid) == 1) {
+    if (!header.is_valid()) {
+      printf("Frame %d of %s is corrupt.\n", int(offsets.size()), filename.c_str());
+      exit(1);
+    }
+    offsets.push_back(offset);
+    is_key.push_back(header.is_key);
+    offset += sizeof(header) + header.payload_size;
+    seek(fid, offset);
+  }
+  fclose(fid);
+}
+
+static int get_num_digits(const double precision)
+{
+  const int num_digits = int(std::ceil(-std::log10(precision) - 1.0e-6));
+  return (num_digits < 0) ? 0 : num_digits;
+}
+
+static void write_frame(
+  FILE* fid,
+  const Ctraj_Frame_Header& header,
+  const std::vector<std::string>& type_symbol,
+  const std::vector<long long>& type,
+  const std::vector<long long>& q_position,
+  const std::vector<long long>& q_velocity)
+{
+  const int N = header.number_of_atoms;
+  fprintf(fid, "%d\n", N);
+  fprintf(fid, "Time=%.8f", header.time);
+  fprintf(
+    fid,
+    " pbc=\"%c %c %c\"",
+    header.pbc[0] ? 'T' : 'F',
+    header.pbc[1] ? 'T' : 'F',
+    header.pbc[2] ? 'T' : 'F');
+  fprintf(fid, " Lattice=\"");
+  for (int k = 0; k < 9; ++k) {
+    fprintf(fid, (k == 0) ? "%.8f" : " %.8f", header.lattice[k]);
+  }
+  fprintf(fid, "\" Properties=species:S:1:pos:R:3%s\n", header.has_velocity ? ":vel:R:3" : "");
+
+  const int digits_position = get_num_digits(header.precision_position);
+  const int digits_velocity = header.has_velocity ? get_num_digits(header.precision_velocity) : 0;
+  for (int n = 0; n < N; ++n) {
+    fprintf(fid, "%s", type_symbol[type[n]].c_str());
+    for (int d = 0; d < 3; ++d) {
+      fprintf(fid, " %.*f", digits_position, q_position[n + N * d] * header.precision_position);
+    }
+    if (header.has_velocity) {
+      for (int d = 0; d < 3; ++d) {
+        fprintf(fid, " %.*f", digits_velocity, q_velocity[n + N * d] * header.precision_velocity);
+      }
+    }
+    fprintf(fid, "\n");
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 3 || argc > 5) {
+    printf("Usage: %s dump.ctraj dump.xyz [first_frame [last_frame]]\n", argv[0]);
+    return 1;
+  }
+  const std::string filename_input = argv[1];
+  const long long first_frame = (argc > 3) ? atoll(argv[3]) : 0;
+  long long last_frame = (argc > 4) ? atoll(argv[4]) : -1;
+
+  std::vector<long long> offsets;
+  std::vector<int> is_key;
+  find_frames(filename_input, offsets, is_key);
+  const long long num_frames = offsets.size();
+  if (last_frame < 0 || last_frame >= num_frames) {
+    last_frame = num_frames - 1;
+  }
+  if (first_frame < 0 || first_frame > last_frame) {
+    printf("There are %lld frames; nothing to convert.\n", num_frames);
+    return 1;
+  }
+  long long key_frame = first_frame;
+  while (key_frame > 0 && !is_key[key_frame]) {
+    --key_frame;
+  }
+
+  FILE* fid_input = fopen(filename_input.c_str(), "rb");
+  FILE* fid_output = fopen(argv[2], "w");
+  if (fid_input == NULL || fid_output == NULL) {
+    printf("Failed to open %s or %s.\n", filename_input.c_str(), argv[2]);
+    return 1;
+  }
+  seek(fid_input, offsets[key_frame]);
+
+  Ctraj_Frame_Header header;
+  std::vector<unsigned char> payload;
+  std::vector<std::string> type_symbol;
+  std::vector<long long> type, q_position, q_position_previous, q_velocity;
+  bool has_key_frame = false;
+  for (long long frame = key_frame; frame <= last_frame; ++frame) {
+    if (fread(&header, sizeof(header), 1, fid_input) != 1 || !header.is_valid()) {
+      printf("Frame %lld is corrupt.\n", frame);
+      return 1;
+    }
+    payload.resize(header.payload_size);
+    if (fread(payload.data(), 1, payload.size(), fid_input) != payload.size()) {
+      printf("Frame %lld is truncated.\n", frame);
+      return 1;
+    }
+
+    // a delta frame needs the key frame it refers to
+    q_position_previous.swap(q_position);
+    bool is_ok = header.is_key || has_key_frame;
+    is_ok = is_ok && unpack_frame(
+                       header,
+                       payload.data(),
+                       payload.data() + payload.size(),
+                       type_symbol,
+                       type,
+                       q_position_previous,
+                       q_position,
+                       q_velocity);
+    has_key_frame = has_key_frame || header.is_key;
+    if (!is_ok) {
+      printf("Frame %lld cannot be decoded.\n", frame);
+      return 1;
+    }
+
+    if (frame >= first_frame) {
+      write_frame(fid_output, header, type_symbol, type, q_position, q_velocity);
+    }
+  }
+
+  fclose(fid_input);
+  fclose(fid_output);
+  printf("Converted frames %lld to %lld into %s.\n", first_frame, last_frame, argv[2]);
+  return 0;
+}
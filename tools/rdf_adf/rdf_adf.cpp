@@ -0,0 +1,811 @@
+/*
+    Radial distribution functions (RDF) and bond-angle distribution functions
+    (ADF) from trajectories in the extended XYZ format (dump.xyz, movie.xyz,
+    or any file with Lattice and Properties in the second line of each frame).
+
+    Compile with "g++ -O3 -fopenmp rdf_adf.cpp -o rdf_adf" and run with
+        ./rdf_adf dump.xyz [options]
+    See readme.md for the options and the output files.
+
+    The frames are read in batches, such that the memory does not depend on the
+    length of the trajectory. The frames of a batch are analyzed in parallel over
+    frames and atoms. Neighbors are found by cell lists in fractional
+    coordinates, which work for triclinic boxes and for boxes thinner than the
+    cutoff (in which case several periodic images of an atom are counted).
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <omp.h>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+const double PI = 3.14159265358979323846;
+
+struct Frame {
+  int N = 0;
+  double lattice[3][3]; // lattice[v] is the v-th lattice vector
+  bool pbc[3] = {true, true, true};
+  std::vector<int> type;
+  std::vector<double> r; // x, y, z of each atom, wrapped into the box along periodic directions
+
+  // cell list
+  int num_cells[3];
+  int stencil[3];            // number of neighboring cells to visit on each side
+  std::vector<int> cell;     // cell index of each atom
+  std::vector<int> cell_ijk; // cell indices along a, b and c of each atom
+  std::vector<int> cell_start;
+  std::vector<int> cell_atoms;
+  double volume = 0.0;
+};
+
+struct Rdf_Pair {
+  int type1;
+  int type2;
+  std::string name;
+};
+
+struct Adf_Triple {
+  int type1; // end atom
+  int type2; // central atom
+  int type3; // end atom
+  double rc12;
+  double rc23;
+  int num_bins;
+  std::string name;
+};
+
+struct Neighbor {
+  int atom;
+  double d[3];
+  double distance;
+};
+
+static void print_usage()
+{
+  printf("Usage: ./rdf_adf trajectory.xyz [options]\n");
+  printf("    -rdf <r_cut> <num_bins>           RDF cutoff (A) and number of bins [8 100]\n");
+  printf("    -pair <A> <B>                     add a partial RDF between species A and B\n");
+  printf("    -adf <A> <B> <C> <rc_BA> <rc_BC> <num_bins>\n");
+  printf("                                      add an ADF of A-B-C angles centered at B\n");
+  printf("    -frames <first> <last>            analyze frames first to last (from 0) [all]\n");
+  printf("    -every <stride>                   analyze every stride-th frame [1]\n");
+  printf("    -batch <num_frames>               frames held in memory [4 x threads]\n");
+  printf("    -no_rdf                           only compute the ADFs\n");
+  exit(1);
+}
+
+static double to_double(const char* text)
+{
+  char* end;
+  const double value = strtod(text, &end);
+  if (*end != '\0') {
+    printf("%s is not a number.\n", text);
+    exit(1);
+  }
+  return value;
+}
+
+static int to_int(const char* text)
+{
+  char* end;
+  const long value = strtol(text, &end, 10);
+  if (*end != '\0') {
+    printf("%s is not an integer.\n", text);
+    exit(1);
+  }
+  return int(value);
+}
+
+// species are numbered in the order of their first appearance in the trajectory or the options
+static int get_type(std::map<std::string, int>& species, const std::string& symbol)
+{
+  auto it = species.find(symbol);
+  if (it != species.end()) {
+    return it->second;
+  }
+  const int type = species.size();
+  species[symbol] = type;
+  return type;
+}
+
+// key=value pairs of the second line, where values can be quoted
+static std::map<std::string, std::string> parse_line_2(const std::string& line)
+{
+  std::map<std::string, std::string> pairs;
+  size_t i = 0;
+  while (i < line.size()) {
+    while (i < line.size() && isspace(line[i])) {
+      ++i;
+    }
+    size_t key_begin = i;
+    while (i < line.size() && line[i] != '=' && !isspace(line[i])) {
+      ++i;
+    }
+    std::string key = line.substr(key_begin, i - key_begin);
+    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+    std::string value;
+    if (i < line.size() && line[i] == '=') {
+      ++i;
+      if (i < line.size() && line[i] == '"') {
+        size_t value_end = line.find('"', i + 1);
+        if (value_end == std::string::npos) {
+          value_end = line.size();
+        }
+        value = line.substr(i + 1, value_end - i - 1);
+        i = value_end + 1;
+      } else {
+        size_t value_begin = i;
+        while (i < line.size() && !isspace(line[i])) {
+          ++i;
+        }
+        value = line.substr(value_begin, i - value_begin);
+      }
+    }
+    if (!key.empty()) {
+      pairs[key] = value;
+    }
+  }
+  return pairs;
+}
+
+class Xyz_Reader
+{
+public:
+  explicit Xyz_Reader(const char* filename) : input_(filename)
+  {
+    if (!input_.is_open()) {
+      printf("Failed to open %s.\n", filename);
+      exit(1);
+    }
+  }
+
+  // read the next frame; returns false at the end of the file
+  bool read(Frame& frame, std::map<std::string, int>& species)
+  {
+    if (!read_number_of_atoms(frame.N)) {
+      return false;
+    }
+    std::string line;
+    std::getline(input_, line);
+    const auto pairs = parse_line_2(line);
+    parse_lattice(pairs, frame);
+    parse_pbc(pairs, frame);
+    const auto columns = parse_properties(pairs);
+
+    frame.type.resize(frame.N);
+    frame.r.resize(frame.N * 3);
+    std::vector<std::string> tokens;
+    for (int n = 0; n < frame.N; ++n) {
+      if (!std::getline(input_, line)) {
+        printf("The last frame is incomplete.\n");
+        exit(1);
+      }
+      split(line, tokens);
+      if (tokens.size() < columns.second + 3 || tokens.size() <= columns.first) {
+        printf("Line %d of a frame has too few columns.\n", n + 1);
+        exit(1);
+      }
+      frame.type[n] = get_type(species, tokens[columns.first]);
+      for (int d = 0; d < 3; ++d) {
+        frame.r[n * 3 + d] = strtod(tokens[columns.second + d].c_str(), nullptr);
+      }
+    }
+    return true;
+  }
+
+  // skip the next frame; returns false at the end of the file
+  bool skip()
+  {
+    int N;
+    if (!read_number_of_atoms(N)) {
+      return false;
+    }
+    std::string line;
+    for (int n = 0; n < N + 1; ++n) {
+      if (!std::getline(input_, line)) {
+        printf("The last frame is incomplete.\n");
+        exit(1);
+      }
+    }
+    return true;
+  }
+
+private:
+  std::ifstream input_;
+
+  bool read_number_of_atoms(int& N)
+  {
+    std::string line;
+    while (std::getline(input_, line)) {
+      if (line.find_first_not_of(" \t\r") != std::string::npos) {
+        N = to_int(line.substr(0, line.find_last_not_of(" \t\r") + 1).c_str());
+        if (N <= 0) {
+          printf("Number of atoms should be positive.\n");
+          exit(1);
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static void split(const std::string& line, std::vector<std::string>& tokens)
+  {
+    tokens.clear();
+    std::istringstream stream(line);
+    std::string token;
+    while (stream >> token) {
+      tokens.push_back(token);
+    }
+  }
+
+  static void parse_lattice(const std::map<std::string, std::string>& pairs, Frame& frame)
+  {
+    auto it = pairs.find("lattice");
+    if (it == pairs.end()) {
+      printf("Each frame should have a Lattice.\n");
+      exit(1);
+    }
+    std::istringstream stream(it->second);
+    for (int v = 0; v < 3; ++v) {
+      for (int d = 0; d < 3; ++d) {
+        if (!(stream >> frame.lattice[v][d])) {
+          printf("Lattice should have 9 numbers.\n");
+          exit(1);
+        }
+      }
+    }
+  }
+
+  static void parse_pbc(const std::map<std::string, std::string>& pairs, Frame& frame)
+  {
+    auto it = pairs.find("pbc");
+    if (it == pairs.end()) {
+      return;
+    }
+    std::istringstream stream(it->second);
+    for (int d = 0; d < 3; ++d) {
+      std::string flag;
+      if (!(stream >> flag)) {
+        printf("pbc should have 3 values.\n");
+        exit(1);
+      }
+      frame.pbc[d] = (flag == "T" || flag == "t" || flag == "1");
+    }
+  }
+
+  // columns of the species and of the first position component
+  static std::pair<size_t, size_t> parse_properties(const std::map<std::string, std::string>& pairs)
+  {
+    auto it = pairs.find("properties");
+    if (it == pairs.end()) {
+      return {0, 1}; // species x y z
+    }
+    std::vector<std::string> fields;
+    std::istringstream stream(it->second);
+    std::string field;
+    while (std::getline(stream, field, ':')) {
+      fields.push_back(field);
+    }
+    size_t column = 0;
+    size_t species_column = std::string::npos;
+    size_t position_column = std::string::npos;
+    for (size_t k = 0; k + 2 < fields.size(); k += 3) {
+      std::string name = fields[k];
+      std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+      if (name == "species") {
+        species_column = column;
+      } else if (name == "pos") {
+        position_column = column;
+      }
+      column += to_int(fields[k + 2].c_str());
+    }
+    if (species_column == std::string::npos || position_column == std::string::npos) {
+      printf("Properties should contain species and pos.\n");
+      exit(1);
+    }
+    return {species_column, position_column};
+  }
+};
+
+static void invert_3x3(const double m[3][3], double inv[3][3], double& det)
+{
+  det = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+        m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+        m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+  inv[0][0] = (m[1][1] * m[2][2] - m[1][2] * m[2][1]) / det;
+  inv[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) / det;
+  inv[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) / det;
+  inv[1][0] = (m[1][2] * m[2][0] - m[1][0] * m[2][2]) / det;
+  inv[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) / det;
+  inv[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) / det;
+  inv[2][0] = (m[1][0] * m[2][1] - m[1][1] * m[2][0]) / det;
+  inv[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) / det;
+  inv[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) / det;
+}
+
+// wrap the atoms into the box and sort them into cells of a thickness of at least rc
+static void build_cell_list(Frame& frame, const double rc)
+{
+  // m[d][v] = component d of the lattice vector v, such that r = m s
+  double m[3][3], g[3][3], det;
+  for (int d = 0; d < 3; ++d) {
+    for (int v = 0; v < 3; ++v) {
+      m[d][v] = frame.lattice[v][d];
+    }
+  }
+  invert_3x3(m, g, det);
+  frame.volume = std::abs(det);
+
+  const int N = frame.N;
+  std::vector<double> s(N * 3);
+  double s_min[3] = {0.0, 0.0, 0.0};
+  double s_span[3] = {1.0, 1.0, 1.0};
+  for (int v = 0; v < 3; ++v) {
+    for (int n = 0; n < N; ++n) {
+      double value = 0.0;
+      for (int d = 0; d < 3; ++d) {
+        value += g[v][d] * frame.r[n * 3 + d];
+      }
+      if (frame.pbc[v]) {
+        value -= std::floor(value);
+        if (value >= 1.0) {
+          value = 0.0;
+        }
+      }
+      s[n * 3 + v] = value;
+    }
+    if (!frame.pbc[v]) {
+      double s_max = s[v];
+      s_min[v] = s[v];
+      for (int n = 1; n < N; ++n) {
+        s_min[v] = std::min(s_min[v], s[n * 3 + v]);
+        s_max = std::max(s_max, s[n * 3 + v]);
+      }
+      s_span[v] = std::max(s_max - s_min[v], 1.0e-10);
+    }
+  }
+
+  for (int n = 0; n < N; ++n) {
+    for (int d = 0; d < 3; ++d) {
+      double value = 0.0;
+      for (int v = 0; v < 3; ++v) {
+        value += m[d][v] * s[n * 3 + v];
+      }
+      frame.r[n * 3 + d] = value;
+    }
+  }
+
+  // the thickness of the box along v is the volume over the area spanned by the other vectors
+  long long total_cells = 1;
+  for (int v = 0; v < 3; ++v) {
+    const double* a = frame.lattice[(v + 1) % 3];
+    const double* b = frame.lattice[(v + 2) % 3];
+    const double cross[3] = {
+      a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    const double area = std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+    const double extent = frame.volume / area * s_span[v];
+    frame.num_cells[v] = std::max(1, std::min(int(extent / rc), 1000));
+    frame.stencil[v] = int(std::ceil(rc / (extent / frame.num_cells[v]) - 1.0e-10));
+    total_cells *= frame.num_cells[v];
+  }
+
+  const int num_cells = total_cells;
+  frame.cell.resize(N);
+  frame.cell_ijk.resize(N * 3);
+  frame.cell_start.assign(num_cells + 1, 0);
+  for (int n = 0; n < N; ++n) {
+    int index = 0;
+    for (int v = 2; v >= 0; --v) {
+      int c = int((s[n * 3 + v] - s_min[v]) / s_span[v] * frame.num_cells[v]);
+      c = std::min(std::max(c, 0), frame.num_cells[v] - 1);
+      frame.cell_ijk[n * 3 + v] = c;
+      index = index * frame.num_cells[v] + c;
+    }
+    frame.cell[n] = index;
+    ++frame.cell_start[index + 1];
+  }
+  for (int c = 0; c < num_cells; ++c) {
+    frame.cell_start[c + 1] += frame.cell_start[c];
+  }
+  frame.cell_atoms.resize(N);
+  std::vector<int> filled(frame.cell_start.begin(), frame.cell_start.end() - 1);
+  for (int n = 0; n < N; ++n) {
+    frame.cell_atoms[filled[frame.cell[n]]++] = n;
+  }
+}
+
+// all the neighbors (including periodic images) of atom n1 within rc
+static void find_neighbors(
+  const Frame& frame, const int n1, const double rc, std::vector<Neighbor>& neighbors)
+{
+  neighbors.clear();
+  const double rc2 = rc * rc;
+  const double* r1 = &frame.r[n1 * 3];
+  const int* c1 = &frame.cell_ijk[n1 * 3];
+  for (int oc = -frame.stencil[2]; oc <= frame.stencil[2]; ++oc) {
+    for (int ob = -frame.stencil[1]; ob <= frame.stencil[1]; ++ob) {
+      for (int oa = -frame.stencil[0]; oa <= frame.stencil[0]; ++oa) {
+        const int offset[3] = {oa, ob, oc};
+        int c2[3];
+        int image[3];
+        bool is_valid = true;
+        for (int v = 0; v < 3; ++v) {
+          const int n = frame.num_cells[v];
+          const int c = c1[v] + offset[v];
+          if (frame.pbc[v]) {
+            image[v] = (c >= 0) ? c / n : -((-c - 1) / n + 1);
+            c2[v] = c - image[v] * n;
+          } else {
+            image[v] = 0;
+            c2[v] = c;
+            is_valid = is_valid && c >= 0 && c < n;
+          }
+        }
+        if (!is_valid) {
+          continue;
+        }
+        const bool is_home = image[0] == 0 && image[1] == 0 && image[2] == 0;
+        double shift[3];
+        for (int d = 0; d < 3; ++d) {
+          shift[d] = image[0] * frame.lattice[0][d] + image[1] * frame.lattice[1][d] +
+                     image[2] * frame.lattice[2][d];
+        }
+        const int cell = (c2[2] * frame.num_cells[1] + c2[1]) * frame.num_cells[0] + c2[0];
+        for (int k = frame.cell_start[cell]; k < frame.cell_start[cell + 1]; ++k) {
+          const int n2 = frame.cell_atoms[k];
+          if (n2 == n1 && is_home) {
+            continue;
+          }
+          Neighbor neighbor;
+          double d2 = 0.0;
+          for (int d = 0; d < 3; ++d) {
+            neighbor.d[d] = frame.r[n2 * 3 + d] + shift[d] - r1[d];
+            d2 += neighbor.d[d] * neighbor.d[d];
+          }
+          if (d2 < rc2) {
+            neighbor.atom = n2;
+            neighbor.distance = std::sqrt(d2);
+            neighbors.push_back(neighbor);
+          }
+        }
+      }
+    }
+  }
+}
+
+// histograms of one thread
+struct Histograms {
+  std::vector<double> rdf; // (1 + num_pairs) * num_rdf_bins, normalized per frame
+  std::vector<std::vector<double>> adf;
+};
+
+static void analyze_atom(
+  const Frame& frame,
+  const int n1,
+  const double rc,
+  const bool compute_rdf,
+  const double r_cut,
+  const int num_rdf_bins,
+  const std::vector<Rdf_Pair>& pairs,
+  const std::vector<double>& rdf_weight,
+  const std::vector<Adf_Triple>& triples,
+  std::vector<Neighbor>& neighbors,
+  Histograms& histograms)
+{
+  find_neighbors(frame, n1, rc, neighbors);
+  const int type1 = frame.type[n1];
+  const double r_step = r_cut / num_rdf_bins;
+
+  if (compute_rdf) {
+    for (const auto& neighbor : neighbors) {
+      if (neighbor.distance > r_cut || neighbor.distance == 0.0) {
+        continue;
+      }
+      // the bins are (w * r_step, (w + 1) * r_step], as in compute_rdf
+      int w = int(neighbor.distance / r_step);
+      if (w * r_step >= neighbor.distance) {
+        --w;
+      }
+      if (w < 0 || w >= num_rdf_bins) {
+        continue;
+      }
+      const double r_mid = (w + 0.5) * r_step;
+      const double inv_shell = 1.0 / (r_mid * r_mid);
+      histograms.rdf[w] += rdf_weight[0] * inv_shell;
+      const int type2 = frame.type[neighbor.atom];
+      for (int p = 0; p < int(pairs.size()); ++p) {
+        if (type1 == pairs[p].type1 && type2 == pairs[p].type2) {
+          histograms.rdf[(p + 1) * num_rdf_bins + w] += rdf_weight[p + 1] * inv_shell;
+        }
+      }
+    }
+  }
+
+  for (int t = 0; t < int(triples.size()); ++t) {
+    const Adf_Triple& triple = triples[t];
+    if (type1 != triple.type2) {
+      continue;
+    }
+    const double d_angle = 180.0 / triple.num_bins;
+    for (int i = 0; i < int(neighbors.size()); ++i) {
+      const Neighbor& a = neighbors[i];
+      if (frame.type[a.atom] != triple.type1 || a.distance >= triple.rc12) {
+        continue;
+      }
+      // with identical end species, each unordered pair is counted once
+      const int j_begin = (triple.type1 == triple.type3) ? i + 1 : 0;
+      for (int j = j_begin; j < int(neighbors.size()); ++j) {
+        const Neighbor& c = neighbors[j];
+        if (j == i || frame.type[c.atom] != triple.type3 || c.distance >= triple.rc23) {
+          continue;
+        }
+        double cos_angle = (a.d[0] * c.d[0] + a.d[1] * c.d[1] + a.d[2] * c.d[2]) /
+                           (a.distance * c.distance);
+        cos_angle = std::min(1.0, std::max(-1.0, cos_angle));
+        int bin = int(std::acos(cos_angle) * 180.0 / PI / d_angle);
+        bin = std::min(bin, triple.num_bins - 1);
+        histograms.adf[t][bin] += 1.0;
+      }
+    }
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    print_usage();
+  }
+
+  bool compute_rdf = true;
+  double r_cut = 8.0;
+  int num_rdf_bins = 100;
+  int first_frame = 0;
+  int last_frame = -1;
+  int frame_stride = 1;
+  int batch_size = 4 * omp_get_max_threads();
+  std::map<std::string, int> species;
+  std::vector<Rdf_Pair> pairs;
+  std::vector<Adf_Triple> triples;
+
+  for (int k = 2; k < argc; ++k) {
+    const std::string option = argv[k];
+    auto require = [&](const int n) {
+      if (k + n >= argc) {
+        printf("%s should have %d parameters.\n", option.c_str(), n);
+        exit(1);
+      }
+    };
+    if (option == "-rdf") {
+      require(2);
+      r_cut = to_double(argv[k + 1]);
+      num_rdf_bins = to_int(argv[k + 2]);
+      k += 2;
+    } else if (option == "-no_rdf") {
+      compute_rdf = false;
+    } else if (option == "-pair") {
+      require(2);
+      Rdf_Pair pair;
+      pair.type1 = get_type(species, argv[k + 1]);
+      pair.type2 = get_type(species, argv[k + 2]);
+      pair.name = std::string(argv[k + 1]) + "_" + argv[k + 2];
+      pairs.push_back(pair);
+      k += 2;
+    } else if (option == "-adf") {
+      require(6);
+      Adf_Triple triple;
+      triple.type1 = get_type(species, argv[k + 1]);
+      triple.type2 = get_type(species, argv[k + 2]);
+      triple.type3 = get_type(species, argv[k + 3]);
+      triple.rc12 = to_double(argv[k + 4]);
+      triple.rc23 = to_double(argv[k + 5]);
+      triple.num_bins = to_int(argv[k + 6]);
+      triple.name = std::string(argv[k + 1]) + "_" + argv[k + 2] + "_" + argv[k + 3];
+      if (triple.rc12 <= 0.0 || triple.rc23 <= 0.0 || triple.num_bins <= 0) {
+        printf("ADF cutoffs and number of bins should be positive.\n");
+        exit(1);
+      }
+      triples.push_back(triple);
+      k += 6;
+    } else if (option == "-frames") {
+      require(2);
+      first_frame = to_int(argv[k + 1]);
+      last_frame = to_int(argv[k + 2]);
+      k += 2;
+    } else if (option == "-every") {
+      require(1);
+      frame_stride = to_int(argv[k + 1]);
+      k += 1;
+    } else if (option == "-batch") {
+      require(1);
+      batch_size = to_int(argv[k + 1]);
+      k += 1;
+    } else {
+      print_usage();
+    }
+  }
+  if (r_cut <= 0.0 || num_rdf_bins <= 0 || frame_stride <= 0 || batch_size <= 0) {
+    printf("Cutoff, number of bins, stride and batch size should be positive.\n");
+    exit(1);
+  }
+  if (first_frame < 0) {
+    printf("First frame should be non-negative.\n");
+    exit(1);
+  }
+  if (!compute_rdf && triples.empty()) {
+    printf("Nothing to compute.\n");
+    exit(1);
+  }
+
+  double rc = compute_rdf ? r_cut : 0.0;
+  for (const auto& triple : triples) {
+    rc = std::max(rc, std::max(triple.rc12, triple.rc23));
+  }
+
+  const int num_threads = omp_get_max_threads();
+  std::vector<Histograms> histograms(num_threads);
+  for (auto& h : histograms) {
+    h.rdf.assign((1 + pairs.size()) * num_rdf_bins, 0.0);
+    h.adf.resize(triples.size());
+    for (int t = 0; t < int(triples.size()); ++t) {
+      h.adf[t].assign(triples[t].num_bins, 0.0);
+    }
+  }
+
+  Xyz_Reader reader(argv[1]);
+  std::vector<Frame> batch(batch_size);
+  int frame_index = 0;
+  int num_frames = 0;
+  bool is_end = false;
+  const int atoms_per_task = 256;
+  while (!is_end) {
+    // read a batch of frames
+    int num_batch = 0;
+    while (num_batch < batch_size) {
+      if (last_frame >= 0 && frame_index > last_frame) {
+        is_end = true;
+        break;
+      }
+      const bool is_selected =
+        frame_index >= first_frame && (frame_index - first_frame) % frame_stride == 0;
+      const bool has_frame = is_selected ? reader.read(batch[num_batch], species) : reader.skip();
+      if (!has_frame) {
+        is_end = true;
+        break;
+      }
+      ++frame_index;
+      if (is_selected) {
+        ++num_batch;
+      }
+    }
+    if (num_batch == 0) {
+      break;
+    }
+
+    // cell lists and the RDF weights of each frame
+    std::vector<std::vector<double>> rdf_weight(num_batch);
+#pragma omp parallel for schedule(dynamic)
+    for (int f = 0; f < num_batch; ++f) {
+      Frame& frame = batch[f];
+      build_cell_list(frame, rc);
+      // 1 / (N1 * rho2 * 4 pi dr), which becomes the RDF after dividing by r^2
+      std::vector<int> count(species.size(), 0);
+      for (int n = 0; n < frame.N; ++n) {
+        ++count[frame.type[n]];
+      }
+      const double r_step = r_cut / num_rdf_bins;
+      rdf_weight[f].resize(1 + pairs.size(), 0.0);
+      rdf_weight[f][0] = frame.volume / (double(frame.N) * frame.N * 4.0 * PI * r_step);
+      for (int p = 0; p < int(pairs.size()); ++p) {
+        const double n1 = count[pairs[p].type1];
+        const double n2 = count[pairs[p].type2];
+        rdf_weight[f][p + 1] =
+          (n1 > 0 && n2 > 0) ? frame.volume / (n1 * n2 * 4.0 * PI * r_step) : 0.0;
+      }
+    }
+
+    // tasks of atoms_per_task atoms in each frame
+    std::vector<std::pair<int, int>> tasks;
+    for (int f = 0; f < num_batch; ++f) {
+      for (int n = 0; n < batch[f].N; n += atoms_per_task) {
+        tasks.push_back({f, n});
+      }
+    }
+#pragma omp parallel
+    {
+      Histograms& h = histograms[omp_get_thread_num()];
+      std::vector<Neighbor> neighbors;
+#pragma omp for schedule(dynamic)
+      for (int t = 0; t < int(tasks.size()); ++t) {
+        const Frame& frame = batch[tasks[t].first];
+        const int n_end = std::min(frame.N, tasks[t].second + atoms_per_task);
+        for (int n = tasks[t].second; n < n_end; ++n) {
+          analyze_atom(
+            frame,
+            n,
+            rc,
+            compute_rdf,
+            r_cut,
+            num_rdf_bins,
+            pairs,
+            rdf_weight[tasks[t].first],
+            triples,
+            neighbors,
+            h);
+        }
+      }
+    }
+
+    num_frames += num_batch;
+    printf("Analyzed %d frames.\n", num_frames);
+    fflush(stdout);
+  }
+
+  if (num_frames == 0) {
+    printf("No frame is selected.\n");
+    exit(1);
+  }
+
+  for (int t = 1; t < num_threads; ++t) {
+    for (int k = 0; k < int(histograms[0].rdf.size()); ++k) {
+      histograms[0].rdf[k] += histograms[t].rdf[k];
+    }
+    for (int a = 0; a < int(triples.size()); ++a) {
+      for (int k = 0; k < triples[a].num_bins; ++k) {
+        histograms[0].adf[a][k] += histograms[t].adf[a][k];
+      }
+    }
+  }
+
+  if (compute_rdf) {
+    // the columns of rdf.out of compute_rdf, but the partial RDFs are named by the species, as the
+    // types of gpumd are not known here
+    FILE* fid = fopen("rdf.out", "w");
+    fprintf(fid, "#radius total");
+    for (const auto& pair : pairs) {
+      fprintf(fid, " %s", pair.name.c_str());
+    }
+    fprintf(fid, "\n");
+    const double r_step = r_cut / num_rdf_bins;
+    for (int w = 0; w < num_rdf_bins; ++w) {
+      fprintf(fid, "%.5f", w * r_step + r_step / 2);
+      for (int p = 0; p <= int(pairs.size()); ++p) {
+        fprintf(fid, " %.5f", histograms[0].rdf[p * num_rdf_bins + w] / num_frames);
+      }
+      fprintf(fid, "\n");
+    }
+    fclose(fid);
+    printf("Wrote rdf.out.\n");
+  }
+
+  for (int t = 0; t < int(triples.size()); ++t) {
+    const Adf_Triple& triple = triples[t];
+    const std::vector<double>& adf = histograms[0].adf[t];
+    double total = 0.0;
+    for (int k = 0; k < triple.num_bins; ++k) {
+      total += adf[k];
+    }
+    const double d_angle = 180.0 / triple.num_bins;
+    const std::string filename = "adf_" + triple.name + ".out";
+    FILE* fid = fopen(filename.c_str(), "w");
+    fprintf(fid, "#angle adf angles_per_frame\n");
+    for (int k = 0; k < triple.num_bins; ++k) {
+      fprintf(
+        fid,
+        "%.5f %.8f %.5f\n",
+        (k + 0.5) * d_angle,
+        (total > 0.0) ? adf[k] / (total * d_angle) : 0.0,
+        adf[k] / num_frames);
+    }
+    fclose(fid);
+    printf("Wrote %s.\n", filename.c_str());
+  }
+
+  return 0;
+}
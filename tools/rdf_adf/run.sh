@@ -8,3 +8,7 @@ set -u
 
 # You can then use Python to output the PDF.
 # python plot_rdf_adf.py
+
+# Alternatively, compile the standalone tool (see readme.md), which needs no OVITO:
+# g++ -O3 -fopenmp rdf_adf.cpp -o rdf_adf
+# ./rdf_adf Ex_xyz/water.xyz -rdf 6 60 -pair O O -pair O H -adf H O H 1.2 1.2 180